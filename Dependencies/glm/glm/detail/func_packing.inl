@@ -5,126 +5,224 @@
 #include "type_half.hpp"
 #include "../fwd.hpp"
 
-namespace glm
+namespace glm{
+namespace detail
 {
-	GLM_FUNC_QUALIFIER uint packUnorm2x16(vec2 const & v)
+	template <bool Simd>
+	struct compute_unorm2x16
 	{
-		union
+		GLM_FUNC_QUALIFIER static uint pack(vec2 const & v)
 		{
-			u16  in[2];
-			uint out;
-		} u;
+			union
+			{
+				u16  in[2];
+				uint out;
+			} u;
 
-		u16vec2 result(round(clamp(v, 0.0f, 1.0f) * 65535.0f));
+			u16vec2 result(round(clamp(v, 0.0f, 1.0f) * 65535.0f));
 
-		u.in[0] = result[0];
-		u.in[1] = result[1];
+			u.in[0] = result[0];
+			u.in[1] = result[1];
 
-		return u.out;
-	}
+			return u.out;
+		}
 
-	GLM_FUNC_QUALIFIER vec2 unpackUnorm2x16(uint p)
-	{
-		union
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint p)
 		{
-			uint in;
-			u16  out[2];
-		} u;
+			union
+			{
+				uint in;
+				u16  out[2];
+			} u;
 
-		u.in = p;
+			u.in = p;
 
-		return vec2(u.out[0], u.out[1]) * 1.5259021896696421759365224689097e-5f;
-	}
+			return vec2(u.out[0], u.out[1]) * 1.5259021896696421759365224689097e-5f;
+		}
+	};
 
-	GLM_FUNC_QUALIFIER uint packSnorm2x16(vec2 const & v)
+	template <bool Simd>
+	struct compute_snorm2x16
 	{
-		union
+		GLM_FUNC_QUALIFIER static uint pack(vec2 const & v)
 		{
-			i16  in[2];
-			uint out;
-		} u;
+			union
+			{
+				i16  in[2];
+				uint out;
+			} u;
 
-		i16vec2 result(round(clamp(v, -1.0f, 1.0f) * 32767.0f));
+			i16vec2 result(round(clamp(v, -1.0f, 1.0f) * 32767.0f));
 
-		u.in[0] = result[0];
-		u.in[1] = result[1];
+			u.in[0] = result[0];
+			u.in[1] = result[1];
 
-		return u.out;
-	}
+			return u.out;
+		}
 
-	GLM_FUNC_QUALIFIER vec2 unpackSnorm2x16(uint p)
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint p)
+		{
+			union
+			{
+				uint in;
+				i16  out[2];
+			} u;
+
+			u.in = p;
+
+			return clamp(vec2(u.out[0], u.out[1]) * 3.0518509475997192297128208258309e-5f, -1.0f, 1.0f);
+		}
+	};
+
+	template <bool Simd>
+	struct compute_unorm4x8
 	{
-		union
+		GLM_FUNC_QUALIFIER static uint pack(vec4 const & v)
 		{
-			uint in;
-			i16  out[2];
-		} u;
+			union
+			{
+				u8   in[4];
+				uint out;
+			} u;
 
-		u.in = p;
+			u8vec4 result(round(clamp(v, 0.0f, 1.0f) * 255.0f));
 
-		return clamp(vec2(u.out[0], u.out[1]) * 3.0518509475997192297128208258309e-5f, -1.0f, 1.0f);
-	}
+			u.in[0] = result[0];
+			u.in[1] = result[1];
+			u.in[2] = result[2];
+			u.in[3] = result[3];
 
-	GLM_FUNC_QUALIFIER uint packUnorm4x8(vec4 const & v)
+			return u.out;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint p)
+		{
+			union
+			{
+				uint in;
+				u8   out[4];
+			} u;
+
+			u.in = p;
+
+			return vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0039215686274509803921568627451f;
+		}
+	};
+
+	template <bool Simd>
+	struct compute_snorm4x8
 	{
-		union
+		GLM_FUNC_QUALIFIER static uint pack(vec4 const & v)
 		{
-			u8   in[4];
-			uint out;
-		} u;
+			union
+			{
+				i8   in[4];
+				uint out;
+			} u;
 
-		u8vec4 result(round(clamp(v, 0.0f, 1.0f) * 255.0f));
+			i8vec4 result(round(clamp(v, -1.0f, 1.0f) * 127.0f));
 
-		u.in[0] = result[0];
-		u.in[1] = result[1];
-		u.in[2] = result[2];
-		u.in[3] = result[3];
+			u.in[0] = result[0];
+			u.in[1] = result[1];
+			u.in[2] = result[2];
+			u.in[3] = result[3];
 
-		return u.out;
-	}
+			return u.out;
+		}
 
-	GLM_FUNC_QUALIFIER vec4 unpackUnorm4x8(uint p)
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint p)
+		{
+			union
+			{
+				uint in;
+				i8   out[4];
+			} u;
+
+			u.in = p;
+
+			return clamp(vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0078740157480315f, -1.0f, 1.0f);
+		}
+	};
+
+	template <bool Simd>
+	struct compute_half2x16
 	{
-		union
+		GLM_FUNC_QUALIFIER static uint pack(vec2 const & v)
 		{
-			uint in;
-			u8   out[4];
-		} u;
+			union
+			{
+				i16  in[2];
+				uint out;
+			} u;
+
+			u.in[0] = detail::toFloat16(v.x);
+			u.in[1] = detail::toFloat16(v.y);
+
+			return u.out;
+		}
+
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint p)
+		{
+			union
+			{
+				uint in;
+				i16  out[2];
+			} u;
+
+			u.in = p;
+
+			return vec2(
+				detail::toFloat32(u.out[0]),
+				detail::toFloat32(u.out[1]));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_UNRESTRICTED_UNIONS
+#	include "func_packing_simd.inl"
+#endif
 
-		u.in = p;
+namespace glm
+{
+	GLM_FUNC_QUALIFIER uint packUnorm2x16(vec2 const & v)
+	{
+		return detail::compute_unorm2x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
+	}
 
-		return vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0039215686274509803921568627451f;
+	GLM_FUNC_QUALIFIER vec2 unpackUnorm2x16(uint p)
+	{
+		return detail::compute_unorm2x16<GLM_ARCH != GLM_ARCH_PURE>::unpack(p);
 	}
-	
-	GLM_FUNC_QUALIFIER uint packSnorm4x8(vec4 const & v)
+
+	GLM_FUNC_QUALIFIER uint packSnorm2x16(vec2 const & v)
 	{
-		union
-		{
-			i8   in[4];
-			uint out;
-		} u;
+		return detail::compute_snorm2x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
+	}
 
-		i8vec4 result(round(clamp(v, -1.0f, 1.0f) * 127.0f));
+	GLM_FUNC_QUALIFIER vec2 unpackSnorm2x16(uint p)
+	{
+		return detail::compute_snorm2x16<GLM_ARCH != GLM_ARCH_PURE>::unpack(p);
+	}
 
-		u.in[0] = result[0];
-		u.in[1] = result[1];
-		u.in[2] = result[2];
-		u.in[3] = result[3];
+	GLM_FUNC_QUALIFIER uint packUnorm4x8(vec4 const & v)
+	{
+		return detail::compute_unorm4x8<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
+	}
 
-		return u.out;
+	GLM_FUNC_QUALIFIER vec4 unpackUnorm4x8(uint p)
+	{
+		return detail::compute_unorm4x8<GLM_ARCH != GLM_ARCH_PURE>::unpack(p);
+	}
+	
+	GLM_FUNC_QUALIFIER uint packSnorm4x8(vec4 const & v)
+	{
+		return detail::compute_snorm4x8<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
 	}
 	
 	GLM_FUNC_QUALIFIER glm::vec4 unpackSnorm4x8(uint p)
 	{
-		union
-		{
-			uint in;
-			i8   out[4];
-		} u;
-
-		u.in = p;
-
-		return clamp(vec4(u.out[0], u.out[1], u.out[2], u.out[3]) * 0.0078740157480315f, -1.0f, 1.0f);
+		return detail::compute_snorm4x8<GLM_ARCH != GLM_ARCH_PURE>::unpack(p);
 	}
 
 	GLM_FUNC_QUALIFIER double packDouble2x32(uvec2 const & v)
@@ -156,35 +254,11 @@ namespace glm
 
 	GLM_FUNC_QUALIFIER uint packHalf2x16(vec2 const & v)
 	{
-		union
-		{
-			i16  in[2];
-			uint out;
-		} u;
-
-		u.in[0] = detail::toFloat16(v.x);
-		u.in[1] = detail::toFloat16(v.y);
-
-		return u.out;
+		return detail::compute_half2x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
 	}
 
-	GLM_FUNC_QUALIFIER vec2 unpackHalf2x16(uint v)
+	GLM_FUNC_QUALIFIER vec2 unpackHalf2x16(uint p)
 	{
-		union
-		{
-			uint in;
-			i16  out[2];
-		} u;
-
-		u.in = v;
-
-		return vec2(
-			detail::toFloat32(u.out[0]),
-			detail::toFloat32(u.out[1]));
+		return detail::compute_half2x16<GLM_ARCH != GLM_ARCH_PURE>::unpack(p);
 	}
 }//namespace glm
-
-#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_UNRESTRICTED_UNIONS
-#	include "func_packing_simd.inl"
-#endif
-
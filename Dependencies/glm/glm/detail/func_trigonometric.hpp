@@ -60,6 +60,18 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_DECL vecType<T, P> cos(vecType<T, P> const & angle);
 
+	/// Computes the sine and the cosine of angle in a single pass sharing the range reduction.
+	/// This is a GLM extension, not a GLSL function.
+	///
+	/// @tparam genType Floating-point scalar or vector types.
+	///
+	/// @see core_func_trigonometric
+	template <typename genType>
+	GLM_FUNC_DECL void sincos(genType angle, genType & s, genType & c);
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_DECL void sincos(vecType<T, P> const & angle, vecType<T, P> & s, vecType<T, P> & c);
+
 	/// The standard trigonometric tangent function.
 	///
 	/// @tparam genType Floating-point scalar or vector types.
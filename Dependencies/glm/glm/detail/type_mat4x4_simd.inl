@@ -1,7 +1,143 @@
 /// @ref core
-/// @file glm/detail/type_mat4x4_sse2.inl
+/// @file glm/detail/type_mat4x4_simd.inl
 
-namespace glm
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
 {
+	template <precision P>
+	struct compute_mat4_add<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			glm_mat4_add(
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_vec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_sub<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			glm_mat4_sub(
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_vec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul_vec4<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tmat4x4<float, P> const & m, tvec4<float, P> const & v)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_mat4_mul_vec4(*reinterpret_cast<glm_vec4 const(*)[4]>(&m[0].data), v.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mul_mat4<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v, tmat4x4<float, P> const & m)
+		{
+			tvec4<float, P> Result(uninitialize);
+			Result.data = glm_vec4_mul_mat4(v.data, *reinterpret_cast<glm_vec4 const(*)[4]>(&m[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<float, P> call(tmat4x4<float, P> const & m1, tmat4x4<float, P> const & m2)
+		{
+			tmat4x4<float, P> Result(uninitialize);
+			glm_mat4_mul(
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_vec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_vec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
 
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template <precision P>
+	struct compute_mat4_add<double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<double, P> call(tmat4x4<double, P> const & m1, tmat4x4<double, P> const & m2)
+		{
+			tmat4x4<double, P> Result(uninitialize);
+			glm_dmat4_add(
+				*reinterpret_cast<glm_dvec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_dvec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_dvec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_sub<double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<double, P> call(tmat4x4<double, P> const & m1, tmat4x4<double, P> const & m2)
+		{
+			tmat4x4<double, P> Result(uninitialize);
+			glm_dmat4_sub(
+				*reinterpret_cast<glm_dvec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_dvec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_dvec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul_vec4<double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tmat4x4<double, P> const & m, tvec4<double, P> const & v)
+		{
+			tvec4<double, P> Result(uninitialize);
+			Result.data = glm_dmat4_mul_dvec4(*reinterpret_cast<glm_dvec4 const(*)[4]>(&m[0].data), v.data);
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_vec4_mul_mat4<double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<double, P> call(tvec4<double, P> const & v, tmat4x4<double, P> const & m)
+		{
+			tvec4<double, P> Result(uninitialize);
+			Result.data = glm_dvec4_mul_dmat4(v.data, *reinterpret_cast<glm_dvec4 const(*)[4]>(&m[0].data));
+			return Result;
+		}
+	};
+
+	template <precision P>
+	struct compute_mat4_mul<double, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<double, P> call(tmat4x4<double, P> const & m1, tmat4x4<double, P> const & m2)
+		{
+			tmat4x4<double, P> Result(uninitialize);
+			glm_dmat4_mul(
+				*reinterpret_cast<glm_dvec4 const(*)[4]>(&m1[0].data),
+				*reinterpret_cast<glm_dvec4 const(*)[4]>(&m2[0].data),
+				*reinterpret_cast<glm_dvec4(*)[4]>(&Result[0].data));
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -21,6 +21,7 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../mat4x4.hpp"
 #include "../gtc/vec1.hpp"
 
 namespace glm
@@ -29,6 +30,7 @@ namespace glm
 	template <typename T, precision P> struct tvec2;
 	template <typename T, precision P> struct tvec3;
 	template <typename T, precision P> struct tvec4;
+	template <typename T, precision P> struct tmat4x4;
 	/// @addtogroup gtc_type_aligned
 	/// @{
 
@@ -234,6 +236,26 @@ namespace glm
 	/// 4 components vector of low precision bool numbers.
 	typedef tvec4<bool, aligned_lowp>		aligned_lowp_bvec4;
 
+	// -- *mat4 --
+
+	/// 4 columns of 4 components matrix of high single-precision floating-point numbers.
+	typedef tmat4x4<float, aligned_highp>	aligned_highp_mat4;
+
+	/// 4 columns of 4 components matrix of medium single-precision floating-point numbers.
+	typedef tmat4x4<float, aligned_mediump>	aligned_mediump_mat4;
+
+	/// 4 columns of 4 components matrix of low single-precision floating-point numbers.
+	typedef tmat4x4<float, aligned_lowp>	aligned_lowp_mat4;
+
+	/// 4 columns of 4 components matrix of high double-precision floating-point numbers.
+	typedef tmat4x4<double, aligned_highp>	aligned_highp_dmat4;
+
+	/// 4 columns of 4 components matrix of medium double-precision floating-point numbers.
+	typedef tmat4x4<double, aligned_mediump>	aligned_mediump_dmat4;
+
+	/// 4 columns of 4 components matrix of low double-precision floating-point numbers.
+	typedef tmat4x4<double, aligned_lowp>	aligned_lowp_dmat4;
+
 	// -- default --
 
 #if(defined(GLM_PRECISION_LOWP_FLOAT))
@@ -241,11 +263,13 @@ namespace glm
 	typedef aligned_lowp_vec2			aligned_vec2;
 	typedef aligned_lowp_vec3			aligned_vec3;
 	typedef aligned_lowp_vec4			aligned_vec4;
+	typedef aligned_lowp_mat4			aligned_mat4;
 #elif(defined(GLM_PRECISION_MEDIUMP_FLOAT))
 	typedef aligned_mediump_vec1		aligned_vec1;
 	typedef aligned_mediump_vec2		aligned_vec2;
 	typedef aligned_mediump_vec3		aligned_vec3;
 	typedef aligned_mediump_vec4		aligned_vec4;
+	typedef aligned_mediump_mat4		aligned_mat4;
 #else //defined(GLM_PRECISION_HIGHP_FLOAT)
 	/// 1 component vector of floating-point numbers.
 	typedef aligned_highp_vec1			aligned_vec1;
@@ -258,6 +282,9 @@ namespace glm
 
 	/// 4 components vector of floating-point numbers.
 	typedef aligned_highp_vec4			aligned_vec4;
+
+	/// 4 columns of 4 components matrix of floating-point numbers.
+	typedef aligned_highp_mat4			aligned_mat4;
 #endif//GLM_PRECISION
 
 #if(defined(GLM_PRECISION_LOWP_DOUBLE))
@@ -265,11 +292,13 @@ namespace glm
 	typedef aligned_lowp_dvec2			aligned_dvec2;
 	typedef aligned_lowp_dvec3			aligned_dvec3;
 	typedef aligned_lowp_dvec4			aligned_dvec4;
+	typedef aligned_lowp_dmat4			aligned_dmat4;
 #elif(defined(GLM_PRECISION_MEDIUMP_DOUBLE))
 	typedef aligned_mediump_dvec1		aligned_dvec1;
 	typedef aligned_mediump_dvec2		aligned_dvec2;
 	typedef aligned_mediump_dvec3		aligned_dvec3;
 	typedef aligned_mediump_dvec4		aligned_dvec4;
+	typedef aligned_mediump_dmat4		aligned_dmat4;
 #else //defined(GLM_PRECISION_HIGHP_DOUBLE)
 	/// 1 component vector of double-precision floating-point numbers.
 	typedef aligned_highp_dvec1			aligned_dvec1;
@@ -282,6 +311,9 @@ namespace glm
 
 	/// 4 components vector of double-precision floating-point numbers.
 	typedef aligned_highp_dvec4			aligned_dvec4;
+
+	/// 4 columns of 4 components matrix of double-precision floating-point numbers.
+	typedef aligned_highp_dmat4			aligned_dmat4;
 #endif//GLM_PRECISION
 
 #if(defined(GLM_PRECISION_LOWP_INT))
@@ -0,0 +1,141 @@
+/// @ref gtx_transform_array
+/// @file glm/gtx/transform_array.inl
+
+#include "../matrix.hpp"
+
+namespace glm{
+namespace detail
+{
+	template <typename T, precision P, bool Simd>
+	struct compute_transform_vec4
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m, tvec4<T, P> const * v, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * v[i];
+		}
+	};
+
+	template <typename T, precision P, bool Simd>
+	struct compute_transform_vec3
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat3x3<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * v[i];
+		}
+	};
+
+	template <typename T, precision P, bool Simd>
+	struct compute_transform_position3
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = tvec3<T, P>(m * tvec4<T, P>(v[i], static_cast<T>(1)));
+		}
+	};
+
+	template <typename T, precision P, bool Simd>
+	struct compute_transform_position4
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec4<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * tvec4<T, P>(v[i], static_cast<T>(1));
+		}
+	};
+
+	template <typename T, precision P, bool Simd>
+	struct compute_transform_position2
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat3x3<T, P> const & m, tvec2<T, P> const * v, tvec2<T, P> * out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = tvec2<T, P>(m * tvec3<T, P>(v[i], static_cast<T>(1)));
+		}
+	};
+
+	// Vectors per chunk when OpenMP splits an array, a multiple of every SIMD block size
+	static std::size_t const transform_array_chunk = 16384;
+
+	template <typename matType, typename inType, typename outType>
+	GLM_FUNC_QUALIFIER void transform_array(
+		void (*Kernel)(matType const &, inType const *, outType *, std::size_t),
+		matType const & m, inType const * v, outType * out, std::size_t count)
+	{
+#		if GLM_HAS_OPENMP
+			if(count >= transform_array_chunk * 2)
+			{
+				int const Chunks = static_cast<int>((count + transform_array_chunk - 1) / transform_array_chunk);
+
+#				pragma omp parallel for
+				for(int i = 0; i < Chunks; ++i)
+				{
+					std::size_t const First = static_cast<std::size_t>(i) * transform_array_chunk;
+					std::size_t const Last = First + transform_array_chunk < count ? First + transform_array_chunk : count;
+					Kernel(m, v + First, out + First, Last - First);
+				}
+				return;
+			}
+#		endif
+
+		Kernel(m, v, out, count);
+	}
+}//namespace detail
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "transform_array_simd.inl"
+#endif
+
+namespace glm
+{
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform(tmat4x4<T, P> const & m, tvec4<T, P> const * v, tvec4<T, P> * out, std::size_t count)
+	{
+		detail::transform_array(detail::compute_transform_vec4<T, P, GLM_ARCH != GLM_ARCH_PURE>::call, m, v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transform(tmat3x3<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+	{
+		detail::transform_array(detail::compute_transform_vec3<T, P, GLM_ARCH != GLM_ARCH_PURE>::call, m, v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPositions(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+	{
+		detail::transform_array(detail::compute_transform_position3<T, P, GLM_ARCH != GLM_ARCH_PURE>::call, m, v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPositions(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec4<T, P> * out, std::size_t count)
+	{
+		detail::transform_array(detail::compute_transform_position4<T, P, GLM_ARCH != GLM_ARCH_PURE>::call, m, v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformPositions(tmat3x3<T, P> const & m, tvec2<T, P> const * v, tvec2<T, P> * out, std::size_t count)
+	{
+		detail::transform_array(detail::compute_transform_position2<T, P, GLM_ARCH != GLM_ARCH_PURE>::call, m, v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformDirections(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+	{
+		transform(tmat3x3<T, P>(m), v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformNormals(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+	{
+		transformNormals(tmat3x3<T, P>(m), v, out, count);
+	}
+
+	template <typename T, precision P>
+	GLM_FUNC_QUALIFIER void transformNormals(tmat3x3<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count)
+	{
+		transform(transpose(inverse(m)), v, out, count);
+	}
+}//namespace glm
@@ -0,0 +1,390 @@
+/// @ref gtx_transform_array
+/// @file glm/gtx/transform_array_simd.inl
+
+#include "../simd/platform.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Blocks of vectors are loaded 128 bits at a time, each 128 bits lane of a wide register holding 4 vectors.
+	// The in-lane shuffles then split the components the same way for every register width.
+	struct transform_array_sse
+	{
+		typedef glm_vec4 type;
+		static std::size_t const size = 4;
+
+		GLM_FUNC_QUALIFIER static type set1(float s){return _mm_set1_ps(s);}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type unpacklo(type a, type b){return _mm_unpacklo_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type unpackhi(type a, type b){return _mm_unpackhi_ps(a, b);}
+
+		template <int Mask>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b){return _mm_shuffle_ps(a, b, Mask);}
+
+		// a * b + c
+		GLM_FUNC_QUALIFIER static type madd(type a, type b, type c)
+		{
+#			if GLM_HAS_FMA
+				return _mm_fmadd_ps(a, b, c);
+#			else
+				return _mm_add_ps(_mm_mul_ps(a, b), c);
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static type load(float const * p, std::size_t)
+		{
+			return _mm_loadu_ps(p);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float * p, std::size_t, type v)
+		{
+			_mm_storeu_ps(p, v);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct transform_array_avx
+	{
+		typedef __m256 type;
+		static std::size_t const size = 8;
+
+		GLM_FUNC_QUALIFIER static type set1(float s){return _mm256_set1_ps(s);}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm256_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm256_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type unpacklo(type a, type b){return _mm256_unpacklo_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type unpackhi(type a, type b){return _mm256_unpackhi_ps(a, b);}
+
+		template <int Mask>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b){return _mm256_shuffle_ps(a, b, Mask);}
+
+		GLM_FUNC_QUALIFIER static type madd(type a, type b, type c)
+		{
+#			if GLM_HAS_FMA
+				return _mm256_fmadd_ps(a, b, c);
+#			else
+				return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static type load(float const * p, std::size_t stride)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + stride), 1);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float * p, std::size_t stride, type v)
+		{
+			_mm_storeu_ps(p, _mm256_castps256_ps128(v));
+			_mm_storeu_ps(p + stride, _mm256_extractf128_ps(v, 1));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	struct transform_array_avx512
+	{
+		typedef __m512 type;
+		static std::size_t const size = 16;
+
+		GLM_FUNC_QUALIFIER static type set1(float s){return _mm512_set1_ps(s);}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm512_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm512_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type unpacklo(type a, type b){return _mm512_unpacklo_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type unpackhi(type a, type b){return _mm512_unpackhi_ps(a, b);}
+
+		template <int Mask>
+		GLM_FUNC_QUALIFIER static type shuffle(type a, type b){return _mm512_shuffle_ps(a, b, Mask);}
+
+		GLM_FUNC_QUALIFIER static type madd(type a, type b, type c){return _mm512_fmadd_ps(a, b, c);}
+
+		GLM_FUNC_QUALIFIER static type load(float const * p, std::size_t stride)
+		{
+			type v = _mm512_zextps128_ps512(_mm_loadu_ps(p));
+			v = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride), 1);
+			v = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride * 2), 2);
+			return _mm512_insertf32x4(v, _mm_loadu_ps(p + stride * 3), 3);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float * p, std::size_t stride, type v)
+		{
+			_mm_storeu_ps(p, _mm512_castps512_ps128(v));
+			_mm_storeu_ps(p + stride, _mm512_extractf32x4_ps(v, 1));
+			_mm_storeu_ps(p + stride * 2, _mm512_extractf32x4_ps(v, 2));
+			_mm_storeu_ps(p + stride * 3, _mm512_extractf32x4_ps(v, 3));
+		}
+	};
+
+	typedef transform_array_avx512 transform_array_wide;
+#	elif GLM_ARCH & GLM_ARCH_AVX_BIT
+	typedef transform_array_avx transform_array_wide;
+#	else
+	typedef transform_array_sse transform_array_wide;
+#	endif
+
+	// Structure of arrays view of a block of vectors
+	template <typename W, int C>
+	struct transform_array_block
+	{
+		typename W::type x, y, z, w;
+
+		// Each 128 bits lane covers 4 vectors, that is 4 * C floats
+		GLM_FUNC_QUALIFIER void load(float const * p)
+		{
+			std::size_t const Stride = 4 * C;
+
+			if(C == 2)
+			{
+				typename W::type const a = W::load(p + 0, Stride);	// x0 y0 x1 y1
+				typename W::type const b = W::load(p + 4, Stride);	// x2 y2 x3 y3
+				x = W::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(a, b);
+				y = W::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(a, b);
+			}
+			else if(C == 3)
+			{
+				typename W::type const a = W::load(p + 0, Stride);	// x0 y0 z0 x1
+				typename W::type const b = W::load(p + 4, Stride);	// y1 z1 x2 y2
+				typename W::type const c = W::load(p + 8, Stride);	// z2 x3 y3 z3
+				x = W::template shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(a, W::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b, c));
+				y = W::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(
+					W::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a, b),
+					W::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b, c));
+				z = W::template shuffle<_MM_SHUFFLE(3, 0, 2, 0)>(W::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a, b), c);
+			}
+			else
+			{
+				typename W::type const a = W::load(p + 0, Stride);
+				typename W::type const b = W::load(p + 4, Stride);
+				typename W::type const c = W::load(p + 8, Stride);
+				typename W::type const d = W::load(p + 12, Stride);
+				transpose(a, b, c, d);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER void store(float * p) const
+		{
+			std::size_t const Stride = 4 * C;
+
+			if(C == 2)
+			{
+				W::store(p + 0, Stride, W::unpacklo(x, y));
+				W::store(p + 4, Stride, W::unpackhi(x, y));
+			}
+			else if(C == 3)
+			{
+				W::store(p + 0, Stride, W::template shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(
+					W::unpacklo(x, y),
+					W::template shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(z, x)));
+				W::store(p + 4, Stride, W::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(
+					W::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(y, z),
+					W::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(x, y)));
+				W::store(p + 8, Stride, W::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(
+					W::template shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(z, x),
+					W::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(y, z)));
+			}
+			else
+			{
+				transform_array_block Result;
+				Result.transpose(x, y, z, w);
+				W::store(p + 0, Stride, Result.x);
+				W::store(p + 4, Stride, Result.y);
+				W::store(p + 8, Stride, Result.z);
+				W::store(p + 12, Stride, Result.w);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER void transpose(typename W::type a, typename W::type b, typename W::type c, typename W::type d)
+		{
+			typename W::type const t0 = W::unpacklo(a, b);
+			typename W::type const t1 = W::unpacklo(c, d);
+			typename W::type const t2 = W::unpackhi(a, b);
+			typename W::type const t3 = W::unpackhi(c, d);
+			x = W::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+			y = W::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+			z = W::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+			w = W::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+		}
+	};
+
+	// Rows of a matrix broadcast to every lane
+	template <typename W, int C, int R>
+	struct transform_array_matrix
+	{
+		typename W::type m[C][R];
+
+		template <typename matType>
+		GLM_FUNC_QUALIFIER explicit transform_array_matrix(matType const & Source)
+		{
+			for(int i = 0; i < C; ++i)
+			for(int j = 0; j < R; ++j)
+				m[i][j] = W::set1(Source[i][j]);
+		}
+
+		// Same operation order as the scalar matrix products when FMA is not available
+		GLM_FUNC_QUALIFIER typename W::type dot(int j, typename W::type x, typename W::type y, typename W::type z, typename W::type w) const
+		{
+#			if GLM_HAS_FMA
+				return W::madd(x, m[0][j], W::madd(y, m[1][j], W::madd(z, m[2][j], W::mul(w, m[3][j]))));
+#			else
+				return W::add(W::add(W::mul(x, m[0][j]), W::mul(y, m[1][j])), W::add(W::mul(z, m[2][j]), W::mul(w, m[3][j])));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER typename W::type dot_point(int j, typename W::type x, typename W::type y, typename W::type z) const
+		{
+#			if GLM_HAS_FMA
+				return W::madd(x, m[0][j], W::madd(y, m[1][j], W::madd(z, m[2][j], m[3][j])));
+#			else
+				return W::add(W::add(W::mul(x, m[0][j]), W::mul(y, m[1][j])), W::add(W::mul(z, m[2][j]), m[3][j]));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER typename W::type dot(int j, typename W::type x, typename W::type y, typename W::type z) const
+		{
+#			if GLM_HAS_FMA
+				return W::madd(z, m[2][j], W::madd(y, m[1][j], W::mul(x, m[0][j])));
+#			else
+				return W::add(W::add(W::mul(x, m[0][j]), W::mul(y, m[1][j])), W::mul(z, m[2][j]));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER typename W::type dot_point(int j, typename W::type x, typename W::type y) const
+		{
+#			if GLM_HAS_FMA
+				return W::madd(y, m[1][j], W::madd(x, m[0][j], m[2][j]));
+#			else
+				return W::add(W::add(W::mul(x, m[0][j]), W::mul(y, m[1][j])), m[2][j]);
+#			endif
+		}
+	};
+
+	template <precision P>
+	struct compute_transform_vec4<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m, tvec4<float, P> const * v, tvec4<float, P> * out, std::size_t count)
+		{
+			typedef transform_array_wide W;
+			transform_array_matrix<W, 4, 4> const Matrix(m);
+
+			std::size_t i = 0;
+			for(; i + W::size <= count; i += W::size)
+			{
+				transform_array_block<W, 4> In;
+				In.load(&v[i][0]);
+
+				transform_array_block<W, 4> Out;
+				Out.x = Matrix.dot(0, In.x, In.y, In.z, In.w);
+				Out.y = Matrix.dot(1, In.x, In.y, In.z, In.w);
+				Out.z = Matrix.dot(2, In.x, In.y, In.z, In.w);
+				Out.w = Matrix.dot(3, In.x, In.y, In.z, In.w);
+				Out.store(&out[i][0]);
+			}
+
+			compute_transform_vec4<float, P, false>::call(m, v + i, out + i, count - i);
+		}
+	};
+
+	template <precision P>
+	struct compute_transform_vec3<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat3x3<float, P> const & m, tvec3<float, P> const * v, tvec3<float, P> * out, std::size_t count)
+		{
+			typedef transform_array_wide W;
+			transform_array_matrix<W, 3, 3> const Matrix(m);
+
+			std::size_t i = 0;
+			for(; i + W::size <= count; i += W::size)
+			{
+				transform_array_block<W, 3> In;
+				In.load(&v[i][0]);
+
+				transform_array_block<W, 3> Out;
+				Out.x = Matrix.dot(0, In.x, In.y, In.z);
+				Out.y = Matrix.dot(1, In.x, In.y, In.z);
+				Out.z = Matrix.dot(2, In.x, In.y, In.z);
+				Out.store(&out[i][0]);
+			}
+
+			compute_transform_vec3<float, P, false>::call(m, v + i, out + i, count - i);
+		}
+	};
+
+	template <precision P>
+	struct compute_transform_position3<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m, tvec3<float, P> const * v, tvec3<float, P> * out, std::size_t count)
+		{
+			typedef transform_array_wide W;
+			transform_array_matrix<W, 4, 3> const Matrix(m);
+
+			std::size_t i = 0;
+			for(; i + W::size <= count; i += W::size)
+			{
+				transform_array_block<W, 3> In;
+				In.load(&v[i][0]);
+
+				transform_array_block<W, 3> Out;
+				Out.x = Matrix.dot_point(0, In.x, In.y, In.z);
+				Out.y = Matrix.dot_point(1, In.x, In.y, In.z);
+				Out.z = Matrix.dot_point(2, In.x, In.y, In.z);
+				Out.store(&out[i][0]);
+			}
+
+			compute_transform_position3<float, P, false>::call(m, v + i, out + i, count - i);
+		}
+	};
+
+	template <precision P>
+	struct compute_transform_position4<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat4x4<float, P> const & m, tvec3<float, P> const * v, tvec4<float, P> * out, std::size_t count)
+		{
+			typedef transform_array_wide W;
+			transform_array_matrix<W, 4, 4> const Matrix(m);
+
+			std::size_t i = 0;
+			for(; i + W::size <= count; i += W::size)
+			{
+				transform_array_block<W, 3> In;
+				In.load(&v[i][0]);
+
+				transform_array_block<W, 4> Out;
+				Out.x = Matrix.dot_point(0, In.x, In.y, In.z);
+				Out.y = Matrix.dot_point(1, In.x, In.y, In.z);
+				Out.z = Matrix.dot_point(2, In.x, In.y, In.z);
+				Out.w = Matrix.dot_point(3, In.x, In.y, In.z);
+				Out.store(&out[i][0]);
+			}
+
+			compute_transform_position4<float, P, false>::call(m, v + i, out + i, count - i);
+		}
+	};
+
+	template <precision P>
+	struct compute_transform_position2<float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tmat3x3<float, P> const & m, tvec2<float, P> const * v, tvec2<float, P> * out, std::size_t count)
+		{
+			typedef transform_array_wide W;
+			transform_array_matrix<W, 3, 2> const Matrix(m);
+
+			std::size_t i = 0;
+			for(; i + W::size <= count; i += W::size)
+			{
+				transform_array_block<W, 2> In;
+				In.load(&v[i][0]);
+
+				transform_array_block<W, 2> Out;
+				Out.x = Matrix.dot_point(0, In.x, In.y);
+				Out.y = Matrix.dot_point(1, In.x, In.y);
+				Out.store(&out[i][0]);
+			}
+
+			compute_transform_position2<float, P, false>::call(m, v + i, out + i, count - i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
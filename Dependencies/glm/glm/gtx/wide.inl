@@ -0,0 +1,1307 @@
+/// @ref gtx_wide
+/// @file glm/gtx/wide.inl
+
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	template <typename T, length_t L>
+	struct compute_wide
+	{
+		typedef wide_array<T, L> type;
+		typedef wide_array<bool, L> mask_type;
+
+		GLM_FUNC_QUALIFIER static type set1(T s)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = s;
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type load(T const * p)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = p[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(T * p, type const & v)
+		{
+			for(length_t i = 0; i < L; ++i)
+				p[i] = v.data[i];
+		}
+
+		GLM_FUNC_QUALIFIER static T lane(type const & v, length_t i)
+		{
+			return v.data[i];
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type const & a)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = -a.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type const & a, type const & b)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] + b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type sub(type const & a, type const & b)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] - b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type mul(type const & a, type const & b)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] * b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type div(type const & a, type const & b)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] / b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type min(type const & a, type const & b)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = b.data[i] < a.data[i] ? b.data[i] : a.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type max(type const & a, type const & b)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] < b.data[i] ? b.data[i] : a.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type const & a)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] < static_cast<T>(0) ? -a.data[i] : a.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type sqrt(type const & a)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = std::sqrt(a.data[i]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type lessThan(type const & a, type const & b)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] < b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type lessThanEqual(type const & a, type const & b)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] <= b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type equal(type const & a, type const & b)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] == b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type notEqual(type const & a, type const & b)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] != b.data[i];
+			return Result;
+		}
+
+		// t in the lanes where m is true, f otherwise
+		GLM_FUNC_QUALIFIER static type select(mask_type const & m, type const & t, type const & f)
+		{
+			type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = m.data[i] ? t.data[i] : f.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_set1(bool b)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = b;
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static bool mask_lane(mask_type const & m, length_t i)
+		{
+			return m.data[i];
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type const & a, mask_type const & b)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] && b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type const & a, mask_type const & b)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = a.data[i] || b.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type const & a)
+		{
+			mask_type Result;
+			for(length_t i = 0; i < L; ++i)
+				Result.data[i] = !a.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static bool mask_any(mask_type const & a)
+		{
+			bool Result = false;
+			for(length_t i = 0; i < L; ++i)
+				Result = Result || a.data[i];
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static bool mask_all(mask_type const & a)
+		{
+			bool Result = true;
+			for(length_t i = 0; i < L; ++i)
+				Result = Result && a.data[i];
+			return Result;
+		}
+	};
+
+	// Arrays of structures of C components from and to C wide registers
+	template <typename T, length_t L, int C>
+	struct compute_wide_aos
+	{
+		typedef typename compute_wide<T, L>::type type;
+
+		GLM_FUNC_QUALIFIER static void load(T const * p, type * v)
+		{
+			T Lanes[C][L];
+			for(length_t i = 0; i < L; ++i)
+			for(int c = 0; c < C; ++c)
+				Lanes[c][i] = p[i * C + c];
+
+			for(int c = 0; c < C; ++c)
+				v[c] = compute_wide<T, L>::load(Lanes[c]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(T * p, type const * v)
+		{
+			T Lanes[C][L];
+			for(int c = 0; c < C; ++c)
+				compute_wide<T, L>::store(Lanes[c], v[c]);
+
+			for(length_t i = 0; i < L; ++i)
+			for(int c = 0; c < C; ++c)
+				p[i * C + c] = Lanes[c][i];
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_ARCH != GLM_ARCH_PURE
+#	include "wide_simd.inl"
+#endif
+
+namespace glm
+{
+	// -- twide --
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L>::twide()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(detail::compute_wide<T, L>::set1(static_cast<T>(0)))
+#		endif
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L>::twide(ctor)
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L>::twide(T const & scalar)
+		: data(detail::compute_wide<T, L>::set1(scalar))
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L>::twide(storage_type const & d)
+		: data(d)
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER T twide<T, L>::operator[](length_type i) const
+	{
+		assert(i >= 0 && i < L);
+		return detail::compute_wide<T, L>::lane(this->data, i);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> & twide<T, L>::operator+=(twide<T, L> const & v)
+	{
+		this->data = detail::compute_wide<T, L>::add(this->data, v.data);
+		return *this;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> & twide<T, L>::operator-=(twide<T, L> const & v)
+	{
+		this->data = detail::compute_wide<T, L>::sub(this->data, v.data);
+		return *this;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> & twide<T, L>::operator*=(twide<T, L> const & v)
+	{
+		this->data = detail::compute_wide<T, L>::mul(this->data, v.data);
+		return *this;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> & twide<T, L>::operator/=(twide<T, L> const & v)
+	{
+		this->data = detail::compute_wide<T, L>::div(this->data, v.data);
+		return *this;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator-(twide<T, L> const & v)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::neg(v.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator+(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::add(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator+(twide<T, L> const & a, typename twide<T, L>::value_type const & b)
+	{
+		return a + twide<T, L>(b);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator+(typename twide<T, L>::value_type const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(a) + b;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator-(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::sub(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator-(twide<T, L> const & a, typename twide<T, L>::value_type const & b)
+	{
+		return a - twide<T, L>(b);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator-(typename twide<T, L>::value_type const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(a) - b;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator*(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::mul(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator*(twide<T, L> const & a, typename twide<T, L>::value_type const & b)
+	{
+		return a * twide<T, L>(b);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator*(typename twide<T, L>::value_type const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(a) * b;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator/(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::div(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator/(twide<T, L> const & a, typename twide<T, L>::value_type const & b)
+	{
+		return a / twide<T, L>(b);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> operator/(typename twide<T, L>::value_type const & a, twide<T, L> const & b)
+	{
+		return twide<T, L>(a) / b;
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> lessThan(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::lessThan(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> lessThanEqual(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::lessThanEqual(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> greaterThan(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::lessThan(b.data, a.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> greaterThanEqual(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::lessThanEqual(b.data, a.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> equal(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::equal(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> notEqual(twide<T, L> const & a, twide<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::notEqual(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> abs(twide<T, L> const & x)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::abs(x.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> min(twide<T, L> const & x, twide<T, L> const & y)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::min(x.data, y.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> min(twide<T, L> const & x, T y)
+	{
+		return min(x, twide<T, L>(y));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> max(twide<T, L> const & x, twide<T, L> const & y)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::max(x.data, y.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> max(twide<T, L> const & x, T y)
+	{
+		return max(x, twide<T, L>(y));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> clamp(twide<T, L> const & x, twide<T, L> const & minVal, twide<T, L> const & maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> clamp(twide<T, L> const & x, T minVal, T maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> mix(twide<T, L> const & x, twide<T, L> const & y, twide<T, L> const & a)
+	{
+		return x + a * (y - x);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> mix(twide<T, L> const & x, twide<T, L> const & y, T a)
+	{
+		return x + a * (y - x);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> mix(twide<T, L> const & x, twide<T, L> const & y, twmask<T, L> const & a)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::select(a.data, y.data, x.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> sqrt(twide<T, L> const & x)
+	{
+		return twide<T, L>(detail::compute_wide<T, L>::sqrt(x.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twide<T, L> inversesqrt(twide<T, L> const & x)
+	{
+		return static_cast<T>(1) / sqrt(x);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER void load(twide<T, L> & v, T const * p)
+	{
+		v.data = detail::compute_wide<T, L>::load(p);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER void store(twide<T, L> const & v, T * p)
+	{
+		detail::compute_wide<T, L>::store(p, v.data);
+	}
+
+	// -- twmask --
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L>::twmask()
+#		ifndef GLM_FORCE_NO_CTOR_INIT
+			: data(detail::compute_wide<T, L>::mask_set1(false))
+#		endif
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L>::twmask(ctor)
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L>::twmask(bool b)
+		: data(detail::compute_wide<T, L>::mask_set1(b))
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L>::twmask(storage_type const & d)
+		: data(d)
+	{}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER bool twmask<T, L>::operator[](length_type i) const
+	{
+		assert(i >= 0 && i < L);
+		return detail::compute_wide<T, L>::mask_lane(this->data, i);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> operator&&(twmask<T, L> const & a, twmask<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::mask_and(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> operator||(twmask<T, L> const & a, twmask<T, L> const & b)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::mask_or(a.data, b.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER twmask<T, L> not_(twmask<T, L> const & m)
+	{
+		return twmask<T, L>(detail::compute_wide<T, L>::mask_not(m.data));
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER bool any(twmask<T, L> const & m)
+	{
+		return detail::compute_wide<T, L>::mask_any(m.data);
+	}
+
+	template <typename T, length_t L>
+	GLM_FUNC_QUALIFIER bool all(twmask<T, L> const & m)
+	{
+		return detail::compute_wide<T, L>::mask_all(m.data);
+	}
+
+	// -- twvec2 --
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W>::twvec2()
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W>::twvec2(ctor)
+		: x(uninitialize), y(uninitialize)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W>::twvec2(W const & scalar)
+		: x(scalar), y(scalar)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W>::twvec2(W const & a, W const & b)
+		: x(a), y(b)
+	{}
+
+	template <typename W>
+	template <precision P>
+	GLM_FUNC_QUALIFIER twvec2<W>::twvec2(tvec2<value_type, P> const & v)
+		: x(v.x), y(v.y)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER W & twvec2<W>::operator[](length_type i)
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER W const & twvec2<W>::operator[](length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> & twvec2<W>::operator+=(twvec2<W> const & v)
+	{
+		this->x += v.x;
+		this->y += v.y;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> & twvec2<W>::operator-=(twvec2<W> const & v)
+	{
+		this->x -= v.x;
+		this->y -= v.y;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> & twvec2<W>::operator*=(twvec2<W> const & v)
+	{
+		this->x *= v.x;
+		this->y *= v.y;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> & twvec2<W>::operator/=(twvec2<W> const & v)
+	{
+		this->x /= v.x;
+		this->y /= v.y;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> & twvec2<W>::operator*=(W const & s)
+	{
+		this->x *= s;
+		this->y *= s;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> & twvec2<W>::operator/=(W const & s)
+	{
+		this->x /= s;
+		this->y /= s;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator-(twvec2<W> const & v)
+	{
+		return twvec2<W>(-v.x, -v.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator+(twvec2<W> const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a.x + b.x, a.y + b.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator+(twvec2<W> const & a, typename twvec2<W>::component_type const & b)
+	{
+		return twvec2<W>(a.x + b, a.y + b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator+(typename twvec2<W>::component_type const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a + b.x, a + b.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator-(twvec2<W> const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a.x - b.x, a.y - b.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator-(twvec2<W> const & a, typename twvec2<W>::component_type const & b)
+	{
+		return twvec2<W>(a.x - b, a.y - b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator-(typename twvec2<W>::component_type const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a - b.x, a - b.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator*(twvec2<W> const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a.x * b.x, a.y * b.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator*(twvec2<W> const & a, typename twvec2<W>::component_type const & b)
+	{
+		return twvec2<W>(a.x * b, a.y * b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator*(typename twvec2<W>::component_type const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a * b.x, a * b.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator/(twvec2<W> const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a.x / b.x, a.y / b.y);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator/(twvec2<W> const & a, typename twvec2<W>::component_type const & b)
+	{
+		return twvec2<W>(a.x / b, a.y / b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec2<W> operator/(typename twvec2<W>::component_type const & a, twvec2<W> const & b)
+	{
+		return twvec2<W>(a / b.x, a / b.y);
+	}
+
+	// -- twvec3 --
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W>::twvec3()
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W>::twvec3(ctor)
+		: x(uninitialize), y(uninitialize), z(uninitialize)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W>::twvec3(W const & scalar)
+		: x(scalar), y(scalar), z(scalar)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W>::twvec3(W const & a, W const & b, W const & c)
+		: x(a), y(b), z(c)
+	{}
+
+	template <typename W>
+	template <precision P>
+	GLM_FUNC_QUALIFIER twvec3<W>::twvec3(tvec3<value_type, P> const & v)
+		: x(v.x), y(v.y), z(v.z)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER W & twvec3<W>::operator[](length_type i)
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER W const & twvec3<W>::operator[](length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> & twvec3<W>::operator+=(twvec3<W> const & v)
+	{
+		this->x += v.x;
+		this->y += v.y;
+		this->z += v.z;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> & twvec3<W>::operator-=(twvec3<W> const & v)
+	{
+		this->x -= v.x;
+		this->y -= v.y;
+		this->z -= v.z;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> & twvec3<W>::operator*=(twvec3<W> const & v)
+	{
+		this->x *= v.x;
+		this->y *= v.y;
+		this->z *= v.z;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> & twvec3<W>::operator/=(twvec3<W> const & v)
+	{
+		this->x /= v.x;
+		this->y /= v.y;
+		this->z /= v.z;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> & twvec3<W>::operator*=(W const & s)
+	{
+		this->x *= s;
+		this->y *= s;
+		this->z *= s;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> & twvec3<W>::operator/=(W const & s)
+	{
+		this->x /= s;
+		this->y /= s;
+		this->z /= s;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator-(twvec3<W> const & v)
+	{
+		return twvec3<W>(-v.x, -v.y, -v.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator+(twvec3<W> const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a.x + b.x, a.y + b.y, a.z + b.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator+(twvec3<W> const & a, typename twvec3<W>::component_type const & b)
+	{
+		return twvec3<W>(a.x + b, a.y + b, a.z + b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator+(typename twvec3<W>::component_type const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a + b.x, a + b.y, a + b.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator-(twvec3<W> const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a.x - b.x, a.y - b.y, a.z - b.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator-(twvec3<W> const & a, typename twvec3<W>::component_type const & b)
+	{
+		return twvec3<W>(a.x - b, a.y - b, a.z - b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator-(typename twvec3<W>::component_type const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a - b.x, a - b.y, a - b.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator*(twvec3<W> const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a.x * b.x, a.y * b.y, a.z * b.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator*(twvec3<W> const & a, typename twvec3<W>::component_type const & b)
+	{
+		return twvec3<W>(a.x * b, a.y * b, a.z * b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator*(typename twvec3<W>::component_type const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a * b.x, a * b.y, a * b.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator/(twvec3<W> const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a.x / b.x, a.y / b.y, a.z / b.z);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator/(twvec3<W> const & a, typename twvec3<W>::component_type const & b)
+	{
+		return twvec3<W>(a.x / b, a.y / b, a.z / b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> operator/(typename twvec3<W>::component_type const & a, twvec3<W> const & b)
+	{
+		return twvec3<W>(a / b.x, a / b.y, a / b.z);
+	}
+
+	// -- twvec4 --
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W>::twvec4()
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W>::twvec4(ctor)
+		: x(uninitialize), y(uninitialize), z(uninitialize), w(uninitialize)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W>::twvec4(W const & scalar)
+		: x(scalar), y(scalar), z(scalar), w(scalar)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W>::twvec4(W const & a, W const & b, W const & c, W const & d)
+		: x(a), y(b), z(c), w(d)
+	{}
+
+	template <typename W>
+	template <precision P>
+	GLM_FUNC_QUALIFIER twvec4<W>::twvec4(tvec4<value_type, P> const & v)
+		: x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER W & twvec4<W>::operator[](length_type i)
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER W const & twvec4<W>::operator[](length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return (&x)[i];
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> & twvec4<W>::operator+=(twvec4<W> const & v)
+	{
+		this->x += v.x;
+		this->y += v.y;
+		this->z += v.z;
+		this->w += v.w;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> & twvec4<W>::operator-=(twvec4<W> const & v)
+	{
+		this->x -= v.x;
+		this->y -= v.y;
+		this->z -= v.z;
+		this->w -= v.w;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> & twvec4<W>::operator*=(twvec4<W> const & v)
+	{
+		this->x *= v.x;
+		this->y *= v.y;
+		this->z *= v.z;
+		this->w *= v.w;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> & twvec4<W>::operator/=(twvec4<W> const & v)
+	{
+		this->x /= v.x;
+		this->y /= v.y;
+		this->z /= v.z;
+		this->w /= v.w;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> & twvec4<W>::operator*=(W const & s)
+	{
+		this->x *= s;
+		this->y *= s;
+		this->z *= s;
+		this->w *= s;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> & twvec4<W>::operator/=(W const & s)
+	{
+		this->x /= s;
+		this->y /= s;
+		this->z /= s;
+		this->w /= s;
+		return *this;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator-(twvec4<W> const & v)
+	{
+		return twvec4<W>(-v.x, -v.y, -v.z, -v.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator+(twvec4<W> const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator+(twvec4<W> const & a, typename twvec4<W>::component_type const & b)
+	{
+		return twvec4<W>(a.x + b, a.y + b, a.z + b, a.w + b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator+(typename twvec4<W>::component_type const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a + b.x, a + b.y, a + b.z, a + b.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator-(twvec4<W> const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator-(twvec4<W> const & a, typename twvec4<W>::component_type const & b)
+	{
+		return twvec4<W>(a.x - b, a.y - b, a.z - b, a.w - b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator-(typename twvec4<W>::component_type const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a - b.x, a - b.y, a - b.z, a - b.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator*(twvec4<W> const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator*(twvec4<W> const & a, typename twvec4<W>::component_type const & b)
+	{
+		return twvec4<W>(a.x * b, a.y * b, a.z * b, a.w * b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator*(typename twvec4<W>::component_type const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a * b.x, a * b.y, a * b.z, a * b.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator/(twvec4<W> const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator/(twvec4<W> const & a, typename twvec4<W>::component_type const & b)
+	{
+		return twvec4<W>(a.x / b, a.y / b, a.z / b, a.w / b);
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec4<W> operator/(typename twvec4<W>::component_type const & a, twvec4<W> const & b)
+	{
+		return twvec4<W>(a / b.x, a / b.y, a / b.z, a / b.w);
+	}
+
+	// -- Functions of twvec2, twvec3 and twvec4 --
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, W>::type dot(vecType<W> const & x, vecType<W> const & y)
+	{
+		W Result(x[0] * y[0]);
+		for(length_t i = 1; i < x.length(); ++i)
+			Result += x[i] * y[i];
+		return Result;
+	}
+
+	template <typename W>
+	GLM_FUNC_QUALIFIER twvec3<W> cross(twvec3<W> const & x, twvec3<W> const & y)
+	{
+		return twvec3<W>(
+			x.y * y.z - y.y * x.z,
+			x.z * y.x - y.z * x.x,
+			x.x * y.y - y.x * x.y);
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, W>::type length(vecType<W> const & x)
+	{
+		return sqrt(dot(x, x));
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, W>::type distance(vecType<W> const & p0, vecType<W> const & p1)
+	{
+		return length(p1 - p0);
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type normalize(vecType<W> const & x)
+	{
+		return x * inversesqrt(dot(x, x));
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type abs(vecType<W> const & x)
+	{
+		vecType<W> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = abs(x[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type min(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<W> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = min(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type max(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<W> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = max(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type clamp(vecType<W> const & x, typename vecType<W>::component_type const & minVal, typename vecType<W>::component_type const & maxVal)
+	{
+		vecType<W> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = clamp(x[i], minVal, maxVal);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type clamp(vecType<W> const & x, vecType<W> const & minVal, vecType<W> const & maxVal)
+	{
+		vecType<W> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = clamp(x[i], minVal[i], maxVal[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type mix(vecType<W> const & x, vecType<W> const & y, W const & a)
+	{
+		return x + a * (y - x);
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type mix(vecType<W> const & x, vecType<W> const & y, typename W::value_type a)
+	{
+		return x + W(a) * (y - x);
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type mix(vecType<W> const & x, vecType<W> const & y, typename W::mask_type const & a)
+	{
+		vecType<W> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = mix(x[i], y[i], a);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type lessThan(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<typename W::mask_type> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = lessThan(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type lessThanEqual(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<typename W::mask_type> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = lessThanEqual(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type greaterThan(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<typename W::mask_type> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = greaterThan(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type greaterThanEqual(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<typename W::mask_type> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = greaterThanEqual(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type equal(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<typename W::mask_type> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = equal(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type notEqual(vecType<W> const & x, vecType<W> const & y)
+	{
+		vecType<typename W::mask_type> Result(uninitialize);
+		for(length_t i = 0; i < x.length(); ++i)
+			Result[i] = notEqual(x[i], y[i]);
+		return Result;
+	}
+
+	template <typename T, length_t L, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<twmask<T, L> >, twmask<T, L> >::type any(vecType<twmask<T, L> > const & v)
+	{
+		twmask<T, L> Result(v[0]);
+		for(length_t i = 1; i < v.length(); ++i)
+			Result = Result || v[i];
+		return Result;
+	}
+
+	template <typename T, length_t L, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER typename detail::wide_vec_enable<vecType<twmask<T, L> >, twmask<T, L> >::type all(vecType<twmask<T, L> > const & v)
+	{
+		twmask<T, L> Result(v[0]);
+		for(length_t i = 1; i < v.length(); ++i)
+			Result = Result && v[i];
+		return Result;
+	}
+
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_QUALIFIER void load(twvec2<twide<T, L> > & v, tvec2<T, P> const * p)
+	{
+		typename twide<T, L>::storage_type Components[2];
+		detail::compute_wide_aos<T, L, 2>::load(&p[0][0], Components);
+		v.x.data = Components[0];
+		v.y.data = Components[1];
+	}
+
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_QUALIFIER void load(twvec3<twide<T, L> > & v, tvec3<T, P> const * p)
+	{
+		typename twide<T, L>::storage_type Components[3];
+		detail::compute_wide_aos<T, L, 3>::load(&p[0][0], Components);
+		v.x.data = Components[0];
+		v.y.data = Components[1];
+		v.z.data = Components[2];
+	}
+
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_QUALIFIER void load(twvec4<twide<T, L> > & v, tvec4<T, P> const * p)
+	{
+		typename twide<T, L>::storage_type Components[4];
+		detail::compute_wide_aos<T, L, 4>::load(&p[0][0], Components);
+		v.x.data = Components[0];
+		v.y.data = Components[1];
+		v.z.data = Components[2];
+		v.w.data = Components[3];
+	}
+
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_QUALIFIER void store(twvec2<twide<T, L> > const & v, tvec2<T, P> * p)
+	{
+		typename twide<T, L>::storage_type const Components[2] = {v.x.data, v.y.data};
+		detail::compute_wide_aos<T, L, 2>::store(&p[0][0], Components);
+	}
+
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_QUALIFIER void store(twvec3<twide<T, L> > const & v, tvec3<T, P> * p)
+	{
+		typename twide<T, L>::storage_type const Components[3] = {v.x.data, v.y.data, v.z.data};
+		detail::compute_wide_aos<T, L, 3>::store(&p[0][0], Components);
+	}
+
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_QUALIFIER void store(twvec4<twide<T, L> > const & v, tvec4<T, P> * p)
+	{
+		typename twide<T, L>::storage_type const Components[4] = {v.x.data, v.y.data, v.z.data, v.w.data};
+		detail::compute_wide_aos<T, L, 4>::store(&p[0][0], Components);
+	}
+}//namespace glm
@@ -0,0 +1,324 @@
+/// @ref gtx_wide
+/// @file glm/gtx/wide_simd.inl
+
+#include "../simd/platform.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Lane masks are all ones or all zeros floats, as returned by the comparison instructions
+	template <>
+	struct compute_wide<float, 4>
+	{
+		typedef glm_vec4 type;
+		typedef glm_vec4 mask_type;
+
+		GLM_FUNC_QUALIFIER static type set1(float s){return _mm_set1_ps(s);}
+		GLM_FUNC_QUALIFIER static type load(float const * p){return _mm_loadu_ps(p);}
+		GLM_FUNC_QUALIFIER static void store(float * p, type v){_mm_storeu_ps(p, v);}
+
+		GLM_FUNC_QUALIFIER static float lane(type v, length_t i)
+		{
+			GLM_ALIGN(16) float Lanes[4];
+			_mm_store_ps(Lanes, v);
+			return Lanes[i];
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type a){return _mm_xor_ps(a, _mm_set1_ps(-0.0f));}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type sub(type a, type b){return _mm_sub_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type div(type a, type b){return _mm_div_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type min(type a, type b){return _mm_min_ps(b, a);}
+		GLM_FUNC_QUALIFIER static type max(type a, type b){return _mm_max_ps(b, a);}
+		GLM_FUNC_QUALIFIER static type abs(type a){return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);}
+		GLM_FUNC_QUALIFIER static type sqrt(type a){return _mm_sqrt_ps(a);}
+
+		GLM_FUNC_QUALIFIER static mask_type lessThan(type a, type b){return _mm_cmplt_ps(a, b);}
+		GLM_FUNC_QUALIFIER static mask_type lessThanEqual(type a, type b){return _mm_cmple_ps(a, b);}
+		GLM_FUNC_QUALIFIER static mask_type equal(type a, type b){return _mm_cmpeq_ps(a, b);}
+		GLM_FUNC_QUALIFIER static mask_type notEqual(type a, type b){return _mm_cmpneq_ps(a, b);}
+
+		GLM_FUNC_QUALIFIER static type select(mask_type m, type t, type f)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
+				return _mm_blendv_ps(f, t, m);
+#			else
+				return _mm_or_ps(_mm_and_ps(m, t), _mm_andnot_ps(m, f));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_set1(bool b){return _mm_castsi128_ps(_mm_set1_epi32(b ? -1 : 0));}
+		GLM_FUNC_QUALIFIER static bool mask_lane(mask_type m, length_t i){return ((_mm_movemask_ps(m) >> i) & 1) != 0;}
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type a, mask_type b){return _mm_and_ps(a, b);}
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type a, mask_type b){return _mm_or_ps(a, b);}
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type a){return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1)));}
+		GLM_FUNC_QUALIFIER static bool mask_any(mask_type a){return _mm_movemask_ps(a) != 0;}
+		GLM_FUNC_QUALIFIER static bool mask_all(mask_type a){return _mm_movemask_ps(a) == 0xf;}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template <>
+	struct compute_wide<float, 8>
+	{
+		typedef __m256 type;
+		typedef __m256 mask_type;
+
+		GLM_FUNC_QUALIFIER static type set1(float s){return _mm256_set1_ps(s);}
+		GLM_FUNC_QUALIFIER static type load(float const * p){return _mm256_loadu_ps(p);}
+		GLM_FUNC_QUALIFIER static void store(float * p, type v){_mm256_storeu_ps(p, v);}
+
+		GLM_FUNC_QUALIFIER static float lane(type v, length_t i)
+		{
+			GLM_ALIGN(32) float Lanes[8];
+			_mm256_store_ps(Lanes, v);
+			return Lanes[i];
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type a){return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f));}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm256_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type sub(type a, type b){return _mm256_sub_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm256_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type div(type a, type b){return _mm256_div_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type min(type a, type b){return _mm256_min_ps(b, a);}
+		GLM_FUNC_QUALIFIER static type max(type a, type b){return _mm256_max_ps(b, a);}
+		GLM_FUNC_QUALIFIER static type abs(type a){return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);}
+		GLM_FUNC_QUALIFIER static type sqrt(type a){return _mm256_sqrt_ps(a);}
+
+		GLM_FUNC_QUALIFIER static mask_type lessThan(type a, type b){return _mm256_cmp_ps(a, b, _CMP_LT_OQ);}
+		GLM_FUNC_QUALIFIER static mask_type lessThanEqual(type a, type b){return _mm256_cmp_ps(a, b, _CMP_LE_OQ);}
+		GLM_FUNC_QUALIFIER static mask_type equal(type a, type b){return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);}
+		GLM_FUNC_QUALIFIER static mask_type notEqual(type a, type b){return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);}
+
+		GLM_FUNC_QUALIFIER static type select(mask_type m, type t, type f){return _mm256_blendv_ps(f, t, m);}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_set1(bool b){return _mm256_castsi256_ps(_mm256_set1_epi32(b ? -1 : 0));}
+		GLM_FUNC_QUALIFIER static bool mask_lane(mask_type m, length_t i){return ((_mm256_movemask_ps(m) >> i) & 1) != 0;}
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type a, mask_type b){return _mm256_and_ps(a, b);}
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type a, mask_type b){return _mm256_or_ps(a, b);}
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type a){return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));}
+		GLM_FUNC_QUALIFIER static bool mask_any(mask_type a){return _mm256_movemask_ps(a) != 0;}
+		GLM_FUNC_QUALIFIER static bool mask_all(mask_type a){return _mm256_movemask_ps(a) == 0xff;}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	// Lane masks are the AVX-512 mask registers, a bit per lane
+	template <>
+	struct compute_wide<float, 16>
+	{
+		typedef __m512 type;
+		typedef __mmask16 mask_type;
+
+		GLM_FUNC_QUALIFIER static type set1(float s){return _mm512_set1_ps(s);}
+		GLM_FUNC_QUALIFIER static type load(float const * p){return _mm512_loadu_ps(p);}
+		GLM_FUNC_QUALIFIER static void store(float * p, type v){_mm512_storeu_ps(p, v);}
+
+		GLM_FUNC_QUALIFIER static float lane(type v, length_t i)
+		{
+			GLM_ALIGN(64) float Lanes[16];
+			_mm512_store_ps(Lanes, v);
+			return Lanes[i];
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type a){return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(static_cast<int>(0x80000000))));}
+		GLM_FUNC_QUALIFIER static type add(type a, type b){return _mm512_add_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type sub(type a, type b){return _mm512_sub_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type mul(type a, type b){return _mm512_mul_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type div(type a, type b){return _mm512_div_ps(a, b);}
+		GLM_FUNC_QUALIFIER static type min(type a, type b){return _mm512_min_ps(b, a);}
+		GLM_FUNC_QUALIFIER static type max(type a, type b){return _mm512_max_ps(b, a);}
+		GLM_FUNC_QUALIFIER static type abs(type a){return _mm512_abs_ps(a);}
+		GLM_FUNC_QUALIFIER static type sqrt(type a){return _mm512_sqrt_ps(a);}
+
+		GLM_FUNC_QUALIFIER static mask_type lessThan(type a, type b){return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);}
+		GLM_FUNC_QUALIFIER static mask_type lessThanEqual(type a, type b){return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ);}
+		GLM_FUNC_QUALIFIER static mask_type equal(type a, type b){return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);}
+		GLM_FUNC_QUALIFIER static mask_type notEqual(type a, type b){return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ);}
+
+		GLM_FUNC_QUALIFIER static type select(mask_type m, type t, type f){return _mm512_mask_blend_ps(m, f, t);}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_set1(bool b){return static_cast<mask_type>(b ? 0xffff : 0);}
+		GLM_FUNC_QUALIFIER static bool mask_lane(mask_type m, length_t i){return ((m >> i) & 1) != 0;}
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type a, mask_type b){return static_cast<mask_type>(a & b);}
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type a, mask_type b){return static_cast<mask_type>(a | b);}
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type a){return static_cast<mask_type>(~a);}
+		GLM_FUNC_QUALIFIER static bool mask_any(mask_type a){return a != 0;}
+		GLM_FUNC_QUALIFIER static bool mask_all(mask_type a){return a == 0xffff;}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+	// Widths without native registers are made of two halves, floatx16 being two floatx8 with AVX or four floatx4 with SSE2
+	template <typename T, length_t L>
+	struct compute_wide_split
+	{
+		typedef compute_wide<T, L / 2> half;
+
+		struct type
+		{
+			typename half::type lo, hi;
+		};
+
+		struct mask_type
+		{
+			typename half::mask_type lo, hi;
+		};
+
+		GLM_FUNC_QUALIFIER static type make(typename half::type lo, typename half::type hi)
+		{
+			type Result;
+			Result.lo = lo;
+			Result.hi = hi;
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type make_mask(typename half::mask_type lo, typename half::mask_type hi)
+		{
+			mask_type Result;
+			Result.lo = lo;
+			Result.hi = hi;
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static type set1(T s){return make(half::set1(s), half::set1(s));}
+		GLM_FUNC_QUALIFIER static type load(T const * p){return make(half::load(p), half::load(p + L / 2));}
+
+		GLM_FUNC_QUALIFIER static void store(T * p, type const & v)
+		{
+			half::store(p, v.lo);
+			half::store(p + L / 2, v.hi);
+		}
+
+		GLM_FUNC_QUALIFIER static T lane(type const & v, length_t i)
+		{
+			return i < L / 2 ? half::lane(v.lo, i) : half::lane(v.hi, i - L / 2);
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type const & a){return make(half::neg(a.lo), half::neg(a.hi));}
+		GLM_FUNC_QUALIFIER static type add(type const & a, type const & b){return make(half::add(a.lo, b.lo), half::add(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static type sub(type const & a, type const & b){return make(half::sub(a.lo, b.lo), half::sub(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static type mul(type const & a, type const & b){return make(half::mul(a.lo, b.lo), half::mul(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static type div(type const & a, type const & b){return make(half::div(a.lo, b.lo), half::div(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static type min(type const & a, type const & b){return make(half::min(a.lo, b.lo), half::min(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static type max(type const & a, type const & b){return make(half::max(a.lo, b.lo), half::max(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static type abs(type const & a){return make(half::abs(a.lo), half::abs(a.hi));}
+		GLM_FUNC_QUALIFIER static type sqrt(type const & a){return make(half::sqrt(a.lo), half::sqrt(a.hi));}
+
+		GLM_FUNC_QUALIFIER static mask_type lessThan(type const & a, type const & b){return make_mask(half::lessThan(a.lo, b.lo), half::lessThan(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static mask_type lessThanEqual(type const & a, type const & b){return make_mask(half::lessThanEqual(a.lo, b.lo), half::lessThanEqual(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static mask_type equal(type const & a, type const & b){return make_mask(half::equal(a.lo, b.lo), half::equal(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static mask_type notEqual(type const & a, type const & b){return make_mask(half::notEqual(a.lo, b.lo), half::notEqual(a.hi, b.hi));}
+
+		GLM_FUNC_QUALIFIER static type select(mask_type const & m, type const & t, type const & f){return make(half::select(m.lo, t.lo, f.lo), half::select(m.hi, t.hi, f.hi));}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_set1(bool b){return make_mask(half::mask_set1(b), half::mask_set1(b));}
+
+		GLM_FUNC_QUALIFIER static bool mask_lane(mask_type const & m, length_t i)
+		{
+			return i < L / 2 ? half::mask_lane(m.lo, i) : half::mask_lane(m.hi, i - L / 2);
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type const & a, mask_type const & b){return make_mask(half::mask_and(a.lo, b.lo), half::mask_and(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type const & a, mask_type const & b){return make_mask(half::mask_or(a.lo, b.lo), half::mask_or(a.hi, b.hi));}
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type const & a){return make_mask(half::mask_not(a.lo), half::mask_not(a.hi));}
+		GLM_FUNC_QUALIFIER static bool mask_any(mask_type const & a){return half::mask_any(a.lo) || half::mask_any(a.hi);}
+		GLM_FUNC_QUALIFIER static bool mask_all(mask_type const & a){return half::mask_all(a.lo) && half::mask_all(a.hi);}
+	};
+
+	template <typename T, length_t L, int C>
+	struct compute_wide_aos_split
+	{
+		typedef typename compute_wide<T, L>::type type;
+		typedef compute_wide_aos<T, L / 2, C> half;
+
+		GLM_FUNC_QUALIFIER static void load(T const * p, type * v)
+		{
+			typename compute_wide<T, L / 2>::type Lo[C], Hi[C];
+			half::load(p, Lo);
+			half::load(p + L / 2 * C, Hi);
+			for(int c = 0; c < C; ++c)
+			{
+				v[c].lo = Lo[c];
+				v[c].hi = Hi[c];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void store(T * p, type const * v)
+		{
+			typename compute_wide<T, L / 2>::type Lo[C], Hi[C];
+			for(int c = 0; c < C; ++c)
+			{
+				Lo[c] = v[c].lo;
+				Hi[c] = v[c].hi;
+			}
+			half::store(p, Lo);
+			half::store(p + L / 2 * C, Hi);
+		}
+	};
+
+	// Reuses the in-lane shuffles of GLM_GTX_transform_array, each 128 bits lane holding 4 vectors
+	template <typename W, int C>
+	struct compute_wide_aos_simd
+	{
+		typedef typename W::type type;
+
+		GLM_FUNC_QUALIFIER static void load(float const * p, type * v)
+		{
+			transform_array_block<W, C> Block;
+			Block.load(p);
+			v[0] = Block.x;
+			v[1] = Block.y;
+			if(C > 2)
+				v[2] = Block.z;
+			if(C > 3)
+				v[3] = Block.w;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float * p, type const * v)
+		{
+			transform_array_block<W, C> Block;
+			Block.x = v[0];
+			Block.y = v[1];
+			Block.z = C > 2 ? v[2] : v[0];
+			Block.w = C > 3 ? v[3] : v[0];
+			Block.store(p);
+		}
+	};
+
+	template <int C>
+	struct compute_wide_aos<float, 4, C> : public compute_wide_aos_simd<transform_array_sse, C>
+	{};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template <int C>
+	struct compute_wide_aos<float, 8, C> : public compute_wide_aos_simd<transform_array_avx, C>
+	{};
+#	else
+	template <>
+	struct compute_wide<float, 8> : public compute_wide_split<float, 8>
+	{};
+
+	template <int C>
+	struct compute_wide_aos<float, 8, C> : public compute_wide_aos_split<float, 8, C>
+	{};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	template <int C>
+	struct compute_wide_aos<float, 16, C> : public compute_wide_aos_simd<transform_array_avx512, C>
+	{};
+#	else
+	template <>
+	struct compute_wide<float, 16> : public compute_wide_split<float, 16>
+	{};
+
+	template <int C>
+	struct compute_wide_aos<float, 16, C> : public compute_wide_aos_split<float, 16, C>
+	{};
+#	endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
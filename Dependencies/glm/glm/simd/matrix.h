@@ -38,16 +38,25 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	__m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
-	__m128 m0 = _mm_mul_ps(m[0], v0);
-	__m128 m1 = _mm_mul_ps(m[1], v1);
-	__m128 m2 = _mm_mul_ps(m[2], v2);
-	__m128 m3 = _mm_mul_ps(m[3], v3);
+#	if GLM_HAS_FMA
+		__m128 a0 = _mm_mul_ps(m[0], v0);
+		__m128 a1 = _mm_fmadd_ps(m[1], v1, a0);
+		__m128 a2 = _mm_fmadd_ps(m[2], v2, a1);
+		__m128 a3 = _mm_fmadd_ps(m[3], v3, a2);
+
+		return a3;
+#	else
+		__m128 m0 = _mm_mul_ps(m[0], v0);
+		__m128 m1 = _mm_mul_ps(m[1], v1);
+		__m128 m2 = _mm_mul_ps(m[2], v2);
+		__m128 m3 = _mm_mul_ps(m[3], v3);
 
-	__m128 a0 = _mm_add_ps(m0, m1);
-	__m128 a1 = _mm_add_ps(m2, m3);
-	__m128 a2 = _mm_add_ps(a0, a1);
+		__m128 a0 = _mm_add_ps(m0, m1);
+		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a2 = _mm_add_ps(a0, a1);
 
-	return a2;
+		return a2;
+#	endif
 }
 
 GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
@@ -79,78 +88,50 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_mul_mat4(glm_vec4 v, glm_vec4 const m[4])
 
 GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
 {
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[0] = a2;
-	}
-
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[1] = a2;
-	}
-
-	{
-		__m128 e0 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[2] = a2;
-	}
-
-	{
-		//(__m128&)_mm_shuffle_epi32(__m128i&)in2[0], _MM_SHUFFLE(3, 3, 3, 3))
-		__m128 e0 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 e1 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 e2 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 e3 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		out[3] = a2;
-	}
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+		// Two result columns per iteration: in1 columns repeated in both 128-bit halves,
+		// in2 columns j and j + 1 side by side, so the in-lane shuffles broadcast one
+		// element of each column into its half
+		__m256 a0 = _mm256_broadcast_ps(&in1[0]);
+		__m256 a1 = _mm256_broadcast_ps(&in1[1]);
+		__m256 a2 = _mm256_broadcast_ps(&in1[2]);
+		__m256 a3 = _mm256_broadcast_ps(&in1[3]);
+
+		for(int j = 0; j < 4; j += 2)
+		{
+			__m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(in2[j]), in2[j + 1], 1);
+
+			__m256 e0 = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0));
+			__m256 e1 = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1));
+			__m256 e2 = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2));
+			__m256 e3 = _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3));
+
+#			if GLM_HAS_FMA
+				__m256 r = _mm256_mul_ps(a0, e0);
+				r = _mm256_fmadd_ps(a1, e1, r);
+				r = _mm256_fmadd_ps(a2, e2, r);
+				r = _mm256_fmadd_ps(a3, e3, r);
+#			else
+				__m256 m0 = _mm256_mul_ps(a0, e0);
+				__m256 m1 = _mm256_mul_ps(a1, e1);
+				__m256 m2 = _mm256_mul_ps(a2, e2);
+				__m256 m3 = _mm256_mul_ps(a3, e3);
+
+				__m256 r = _mm256_add_ps(_mm256_add_ps(m0, m1), _mm256_add_ps(m2, m3));
+#			endif
+
+			out[j] = _mm256_castps256_ps128(r);
+			out[j + 1] = _mm256_extractf128_ps(r, 1);
+		}
+#	else
+		// Copies first: out may alias in1 or in2
+		glm_vec4 a[4] = {in1[0], in1[1], in1[2], in1[3]};
+		glm_vec4 b[4] = {in2[0], in2[1], in2[2], in2[3]};
+		out[0] = glm_mat4_mul_vec4(a, b[0]);
+		out[1] = glm_mat4_mul_vec4(a, b[1]);
+		out[2] = glm_mat4_mul_vec4(a, b[2]);
+		out[3] = glm_mat4_mul_vec4(a, b[3]);
+#	endif
 }
 
 GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4])
@@ -1025,4 +1006,84 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const & c, __m128 const & r
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER void glm_dmat4_add(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	out[0] = _mm256_add_pd(in1[0], in2[0]);
+	out[1] = _mm256_add_pd(in1[1], in2[1]);
+	out[2] = _mm256_add_pd(in1[2], in2[2]);
+	out[3] = _mm256_add_pd(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_sub(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	out[0] = _mm256_sub_pd(in1[0], in2[0]);
+	out[1] = _mm256_sub_pd(in1[1], in2[1]);
+	out[2] = _mm256_sub_pd(in1[2], in2[2]);
+	out[3] = _mm256_sub_pd(in1[3], in2[3]);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	// AVX has no cross-lane permute for doubles: duplicate each 128-bit half, then pick in lane
+	__m256d lo = _mm256_permute2f128_pd(v, v, 0x00);
+	__m256d hi = _mm256_permute2f128_pd(v, v, 0x11);
+	__m256d v0 = _mm256_permute_pd(lo, 0x0);
+	__m256d v1 = _mm256_permute_pd(lo, 0xF);
+	__m256d v2 = _mm256_permute_pd(hi, 0x0);
+	__m256d v3 = _mm256_permute_pd(hi, 0xF);
+
+#	if GLM_HAS_FMA
+		__m256d a0 = _mm256_mul_pd(m[0], v0);
+		__m256d a1 = _mm256_fmadd_pd(m[1], v1, a0);
+		__m256d a2 = _mm256_fmadd_pd(m[2], v2, a1);
+		__m256d a3 = _mm256_fmadd_pd(m[3], v3, a2);
+
+		return a3;
+#	else
+		__m256d m0 = _mm256_mul_pd(m[0], v0);
+		__m256d m1 = _mm256_mul_pd(m[1], v1);
+		__m256d m2 = _mm256_mul_pd(m[2], v2);
+		__m256d m3 = _mm256_mul_pd(m[3], v3);
+
+		__m256d a0 = _mm256_add_pd(m0, m1);
+		__m256d a1 = _mm256_add_pd(m2, m3);
+		__m256d a2 = _mm256_add_pd(a0, a1);
+
+		return a2;
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_mul_dmat4(glm_dvec4 v, glm_dvec4 const m[4])
+{
+	__m256d m0 = _mm256_mul_pd(v, m[0]);
+	__m256d m1 = _mm256_mul_pd(v, m[1]);
+	__m256d m2 = _mm256_mul_pd(v, m[2]);
+	__m256d m3 = _mm256_mul_pd(v, m[3]);
+
+	// Pairwise sums: h01 = (m0.xy, m1.xy, m0.zw, m1.zw), h23 likewise
+	__m256d h01 = _mm256_hadd_pd(m0, m1);
+	__m256d h23 = _mm256_hadd_pd(m2, m3);
+
+	// (m0.zw, m1.zw, m2.xy, m3.xy) + (m0.xy, m1.xy, m2.zw, m3.zw)
+	__m256d s0 = _mm256_permute2f128_pd(h01, h23, 0x21);
+	__m256d s1 = _mm256_blend_pd(h01, h23, 0xC);
+
+	return _mm256_add_pd(s0, s1);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	// Copies first: out may alias in1 or in2
+	glm_dvec4 a[4] = {in1[0], in1[1], in1[2], in1[3]};
+	glm_dvec4 b[4] = {in2[0], in2[1], in2[2], in2[3]};
+	out[0] = glm_dmat4_mul_dvec4(a, b[0]);
+	out[1] = glm_dmat4_mul_dvec4(a, b[1]);
+	out[2] = glm_dmat4_mul_dvec4(a, b[2]);
+	out[3] = glm_dmat4_mul_dvec4(a, b[3]);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
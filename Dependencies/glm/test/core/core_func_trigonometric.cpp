@@ -1,10 +1,148 @@
 #include <glm/trigonometric.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/common.hpp>
+#include <glm/vector_relational.hpp>
+#include <cmath>
 
-int main()
+#if GLM_HAS_ALIGNED_TYPE
+// Aligned vec4 goes through the SIMD polynomials when they are available: compare each lane with the C library
+namespace ulp
+{
+	// Signed distance in representable floats, -0 and +0 are the same value
+	static int distance(float a, float b)
+	{
+		int ia = glm::floatBitsToInt(a);
+		int ib = glm::floatBitsToInt(b);
+		ia = ia < 0 ? -(ia & 0x7fffffff) : ia;
+		ib = ib < 0 ? -(ib & 0x7fffffff) : ib;
+		return ia - ib;
+	}
+
+	// Bounds of simd/trigonometric.h plus one ULP for the C library
+	static int lanes(glm::aligned_vec4 const & Result, glm::vec4 const & Expected, int MaxULPs)
+	{
+		int Error = 0;
+		for(glm::length_t i = 0; i < 4; ++i)
+		{
+			if(glm::isnan(Expected[i]))
+				Error += glm::isnan(Result[i]) ? 0 : 1;
+			else if(glm::isinf(Expected[i]))
+				Error += Result[i] == Expected[i] ? 0 : 1;
+			else
+				Error += !glm::isnan(Result[i]) && glm::abs(distance(Result[i], Expected[i])) <= MaxULPs ? 0 : 1;
+		}
+		return Error;
+	}
+
+	static int test_sin_cos_tan(float Min, float Max, int Steps)
+	{
+		int Error = 0;
+
+		float const Step = (Max - Min) / static_cast<float>(Steps * 4);
+		for(int i = 0; i < Steps; ++i)
+		{
+			glm::vec4 const x(Min + Step * static_cast<float>(i * 4), Min + Step * static_cast<float>(i * 4 + 1), Min + Step * static_cast<float>(i * 4 + 2), Min + Step * static_cast<float>(i * 4 + 3));
+			glm::aligned_vec4 const a(x);
+
+			Error += lanes(glm::sin(a), glm::vec4(std::sin(x.x), std::sin(x.y), std::sin(x.z), std::sin(x.w)), 3);
+			Error += lanes(glm::cos(a), glm::vec4(std::cos(x.x), std::cos(x.y), std::cos(x.z), std::cos(x.w)), 3);
+			Error += lanes(glm::tan(a), glm::vec4(std::tan(x.x), std::tan(x.y), std::tan(x.z), std::tan(x.w)), 4);
+
+			glm::aligned_vec4 s, c;
+			glm::sincos(a, s, c);
+			Error += glm::all(glm::equal(glm::vec4(s), glm::vec4(glm::sin(a)))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::vec4(c), glm::vec4(glm::cos(a)))) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test_inverse(int Steps)
+	{
+		int Error = 0;
+
+		for(int i = 0; i < Steps; ++i)
+		{
+			float const t = static_cast<float>(i) / static_cast<float>(Steps) * 2.0f - 1.0f;
+			glm::vec4 const x(t, -t * 0.5f, t * t, 1.0f - t * t * t);
+			glm::aligned_vec4 const a(x);
+
+			Error += lanes(glm::asin(a), glm::vec4(std::asin(x.x), std::asin(x.y), std::asin(x.z), std::asin(x.w)), 4);
+			Error += lanes(glm::acos(a), glm::vec4(std::acos(x.x), std::acos(x.y), std::acos(x.z), std::acos(x.w)), 3);
+
+			glm::vec4 const y(x * 1000.0f);
+			glm::aligned_vec4 const b(y);
+			Error += lanes(glm::atan(b), glm::vec4(std::atan(y.x), std::atan(y.y), std::atan(y.z), std::atan(y.w)), 3);
+
+			glm::vec4 const z(t * 3.0f, -t, 1.0f - t, t - 0.25f);
+			glm::aligned_vec4 const d(z);
+			Error += lanes(glm::atan(b, d), glm::vec4(std::atan2(y.x, z.x), std::atan2(y.y, z.y), std::atan2(y.z, z.z), std::atan2(y.w, z.w)), 5);
+		}
+
+		return Error;
+	}
+
+	static int test_special()
+	{
+		int Error = 0;
+
+		float const Inf = std::numeric_limits<float>::infinity();
+		float const NaN = std::numeric_limits<float>::quiet_NaN();
+
+		glm::vec4 const x(Inf, NaN, 1e10f, -0.0f);
+		glm::aligned_vec4 const a(x);
+		Error += lanes(glm::sin(a), glm::vec4(std::sin(x.x), std::sin(x.y), std::sin(x.z), std::sin(x.w)), 1);
+		Error += lanes(glm::cos(a), glm::vec4(std::cos(x.x), std::cos(x.y), std::cos(x.z), std::cos(x.w)), 1);
+		Error += lanes(glm::tan(a), glm::vec4(std::tan(x.x), std::tan(x.y), std::tan(x.z), std::tan(x.w)), 1);
+
+		glm::vec4 const y(0.0f, -0.0f, Inf, -Inf);
+		glm::vec4 const z(-0.0f, 0.0f, -Inf, Inf);
+		Error += lanes(glm::atan(glm::aligned_vec4(y), glm::aligned_vec4(z)), glm::vec4(std::atan2(y.x, z.x), std::atan2(y.y, z.y), std::atan2(y.z, z.z), std::atan2(y.w, z.w)), 1);
+
+		// Nonzero y over -0 stays on the vector path
+		glm::vec4 const u(1.0f, -1.0f, 1e-30f, 2.0f);
+		glm::vec4 const v(-0.0f);
+		Error += lanes(glm::atan(glm::aligned_vec4(u), glm::aligned_vec4(v)), glm::vec4(std::atan2(u.x, v.x), std::atan2(u.y, v.y), std::atan2(u.z, v.z), std::atan2(u.w, v.w)), 1);
+
+		glm::vec4 const w(-1.0f, 1.0f, 2.0f, Inf);
+		Error += lanes(glm::atan(glm::aligned_vec4(w)), glm::vec4(std::atan(w.x), std::atan(w.y), std::atan(w.z), std::atan(w.w)), 1);
+		Error += lanes(glm::acos(glm::aligned_vec4(w)), glm::vec4(std::acos(w.x), std::acos(w.y), std::acos(w.z), std::acos(w.w)), 1);
+
+		return Error;
+	}
+}//namespace ulp
+#endif//GLM_HAS_ALIGNED_TYPE
+
+static int test_sincos()
 {
 	int Error = 0;
 
+	float s = 0.0f, c = 0.0f;
+	glm::sincos(glm::pi<float>() / 6.0f, s, c);
+	Error += glm::abs(s - 0.5f) < 1e-6f ? 0 : 1;
+	Error += glm::abs(c - glm::sqrt(3.0f) * 0.5f) < 1e-6f ? 0 : 1;
+
+	glm::dvec3 S, C;
+	glm::sincos(glm::dvec3(0.0, glm::pi<double>(), 1.0), S, C);
+	Error += glm::all(glm::lessThan(glm::abs(S - glm::sin(glm::dvec3(0.0, glm::pi<double>(), 1.0))), glm::dvec3(1e-15))) ? 0 : 1;
+	Error += glm::all(glm::lessThan(glm::abs(C - glm::cos(glm::dvec3(0.0, glm::pi<double>(), 1.0))), glm::dvec3(1e-15))) ? 0 : 1;
 
 	return Error;
 }
 
+int main()
+{
+	int Error = 0;
+
+	Error += test_sincos();
+
+#	if GLM_HAS_ALIGNED_TYPE
+		Error += ulp::test_sin_cos_tan(-10.0f, 10.0f, 10000);
+		Error += ulp::test_sin_cos_tan(-100000.0f, 100000.0f, 10000);
+		Error += ulp::test_inverse(10000);
+		Error += ulp::test_special();
+#	endif
+
+	return Error;
+}
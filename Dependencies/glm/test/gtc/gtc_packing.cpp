@@ -640,6 +640,138 @@ int test_packUnorm2x3_1x2()
 	return Error;
 }
 
+// The SIMD paths must match the scalar code they replace
+int test_packSimd()
+{
+	int Error = 0;
+
+	for(int i = -70000; i <= 70000; ++i)
+	{
+		float const x = static_cast<float>(i) / 65535.f;
+		glm::vec4 const v(x, -x, x * 0.25f, 1.0f - x);
+
+		Error += glm::packUnorm4x16(v) == glm::detail::compute_unorm4x16<false>::pack(v) ? 0 : 1;
+		Error += glm::packSnorm4x16(v) == glm::detail::compute_snorm4x16<false>::pack(v) ? 0 : 1;
+		Error += glm::packUnorm3x10_1x2(v) == glm::detail::compute_unorm3x10_1x2<false>::pack(v) ? 0 : 1;
+		Error += glm::packSnorm3x10_1x2(v) == glm::detail::compute_snorm3x10_1x2<false>::pack(v) ? 0 : 1;
+	}
+
+	for(glm::uint32 i = 0; i < 0x100000; ++i)
+	{
+		glm::uint32 const p = i * 4099u;
+		glm::uint64 const q = static_cast<glm::uint64>(p) | (static_cast<glm::uint64>(p * 2654435761u) << 32);
+
+		Error += glm::unpackUnorm4x16(q) == glm::detail::compute_unorm4x16<false>::unpack(q) ? 0 : 1;
+		Error += glm::unpackSnorm4x16(q) == glm::detail::compute_snorm4x16<false>::unpack(q) ? 0 : 1;
+		Error += glm::unpackUnorm3x10_1x2(p) == glm::detail::compute_unorm3x10_1x2<false>::unpack(p) ? 0 : 1;
+		Error += glm::unpackSnorm3x10_1x2(p) == glm::detail::compute_snorm3x10_1x2<false>::unpack(p) ? 0 : 1;
+	}
+
+	for(glm::uint32 i = 0; i < 0x10000; ++i)
+	{
+		glm::uint16 const h = static_cast<glm::uint16>(i);
+		glm::vec4 const v(glm::unpackHalf4x16(static_cast<glm::uint64>(h) * 0x0001000100010001ull));
+		float const Ref = glm::unpackHalf1x16(h);
+
+		if((h & 0x7c00) != 0x7c00)
+		{
+			Error += glm::all(glm::equal(v, glm::vec4(Ref))) ? 0 : 1;
+			Error += glm::packHalf4x16(v) == static_cast<glm::uint64>(h) * 0x0001000100010001ull ? 0 : 1;
+		}
+		else
+			Error += glm::isnan(v.x) == glm::isnan(Ref) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_packStream()
+{
+	int Error = 0;
+
+	// Sizes that are not multiples of four exercise the tail
+	for(std::size_t Count = 0; Count < 11; ++Count)
+	{
+		std::vector<float> Data(Count + 1, 9.0f);
+		for(std::size_t i = 0; i < Count; ++i)
+			Data[i] = static_cast<float>(i) / 5.0f - 0.9f;
+
+		std::vector<glm::uint8> Bytes(Count + 1, 0xcd);
+		std::vector<glm::uint16> Shorts(Count + 1, 0xcdcd);
+		std::vector<float> Result(Count + 1, 9.0f);
+
+		glm::packUnorm1x8(&Data[0], &Bytes[0], Count);
+		glm::unpackUnorm1x8(&Bytes[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Bytes[i] == glm::packUnorm1x8(Data[i]) ? 0 : 1;
+			Error += Result[i] == glm::unpackUnorm1x8(Bytes[i]) ? 0 : 1;
+		}
+		Error += Bytes[Count] == 0xcd && Result[Count] == 9.0f ? 0 : 1;
+
+		glm::packSnorm1x8(&Data[0], &Bytes[0], Count);
+		glm::unpackSnorm1x8(&Bytes[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Bytes[i] == glm::packSnorm1x8(Data[i]) ? 0 : 1;
+			Error += Result[i] == glm::unpackSnorm1x8(Bytes[i]) ? 0 : 1;
+		}
+		Error += Bytes[Count] == 0xcd && Result[Count] == 9.0f ? 0 : 1;
+
+		glm::packUnorm1x16(&Data[0], &Shorts[0], Count);
+		glm::unpackUnorm1x16(&Shorts[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Shorts[i] == glm::packUnorm1x16(Data[i]) ? 0 : 1;
+			Error += Result[i] == glm::unpackUnorm1x16(Shorts[i]) ? 0 : 1;
+		}
+		Error += Shorts[Count] == 0xcdcd && Result[Count] == 9.0f ? 0 : 1;
+
+		glm::packSnorm1x16(&Data[0], &Shorts[0], Count);
+		glm::unpackSnorm1x16(&Shorts[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Shorts[i] == glm::packSnorm1x16(Data[i]) ? 0 : 1;
+			Error += Result[i] == glm::unpackSnorm1x16(Shorts[i]) ? 0 : 1;
+		}
+		Error += Shorts[Count] == 0xcdcd && Result[Count] == 9.0f ? 0 : 1;
+
+		glm::packHalf1x16(&Data[0], &Shorts[0], Count);
+		glm::unpackHalf1x16(&Shorts[0], &Result[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Shorts[i] == glm::packHalf1x16(Data[i]) ? 0 : 1;
+			Error += Result[i] == glm::unpackHalf1x16(Shorts[i]) ? 0 : 1;
+		}
+		Error += Shorts[Count] == 0xcdcd && Result[Count] == 9.0f ? 0 : 1;
+
+		std::vector<glm::vec4> Vectors(Count + 1, glm::vec4(9.0f));
+		std::vector<glm::uint32> Packed(Count + 1, 0xcdcdcdcd);
+		for(std::size_t i = 0; i < Count; ++i)
+			Vectors[i] = glm::vec4(Data[i], -Data[i], 0.5f, Data[i] > 0.0f ? 1.0f : -1.0f);
+		std::vector<glm::vec4> Unpacked(Vectors);
+
+		glm::packSnorm3x10_1x2(&Vectors[0], &Packed[0], Count);
+		glm::unpackSnorm3x10_1x2(&Packed[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Packed[i] == glm::packSnorm3x10_1x2(Vectors[i]) ? 0 : 1;
+			Error += glm::all(glm::equal(Unpacked[i], glm::unpackSnorm3x10_1x2(Packed[i]))) ? 0 : 1;
+		}
+
+		glm::packUnorm3x10_1x2(&Vectors[0], &Packed[0], Count);
+		glm::unpackUnorm3x10_1x2(&Packed[0], &Unpacked[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Packed[i] == glm::packUnorm3x10_1x2(Vectors[i]) ? 0 : 1;
+			Error += glm::all(glm::equal(Unpacked[i], glm::unpackUnorm3x10_1x2(Packed[i]))) ? 0 : 1;
+		}
+		Error += Packed[Count] == 0xcdcdcdcd && Unpacked[Count] == glm::vec4(9.0f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -677,6 +809,8 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_Half4x16();
+	Error += test_packSimd();
+	Error += test_packStream();
 
 	return Error;
 }
@@ -3,6 +3,8 @@
 
 #if GLM_HAS_ALIGNED_TYPE
 #include <glm/gtc/type_aligned.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
 GLM_STATIC_ASSERT(glm::detail::is_aligned<glm::aligned_lowp>::value, "aligned_lowp is not aligned");
 GLM_STATIC_ASSERT(glm::detail::is_aligned<glm::aligned_mediump>::value, "aligned_mediump is not aligned");
@@ -90,10 +92,68 @@ int test_copy()
 	return Error;
 }
 
+template <typename T>
+static int test_mat4_equal(glm::tmat4x4<T, glm::aligned_highp> const & a, glm::tmat4x4<T, glm::packed_highp> const & b, T Epsilon)
+{
+	int Error = 0;
+
+	for(glm::length_t i = 0; i < 4; ++i)
+		Error += glm::all(glm::epsilonEqual(glm::tvec4<T, glm::packed_highp>(a[i]), b[i], Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+// The aligned operators take the SIMD path when one is available: they must match the packed scalar ones
+template <typename T>
+static int test_mat4_operators(T Epsilon)
+{
+	typedef glm::tmat4x4<T, glm::packed_highp> packed_mat4;
+	typedef glm::tmat4x4<T, glm::aligned_highp> aligned_mat4;
+	typedef glm::tvec4<T, glm::packed_highp> packed_vec4;
+	typedef glm::tvec4<T, glm::aligned_highp> aligned_vec4;
+
+	int Error = 0;
+
+	packed_mat4 const A = glm::rotate(glm::translate(packed_mat4(1), glm::tvec3<T, glm::packed_highp>(1, -2, 3)), static_cast<T>(0.7), glm::tvec3<T, glm::packed_highp>(0, 1, 0));
+	packed_mat4 const B = glm::perspective(static_cast<T>(0.8), static_cast<T>(4) / static_cast<T>(3), static_cast<T>(0.1), static_cast<T>(100));
+	packed_mat4 const C(
+		1, 2, 3, 4,
+		-5, 6, -7, 8,
+		9, -10, 11, 12,
+		13, 14, -15, 16);
+	packed_vec4 const V(static_cast<T>(0.5), -2, 3, 1);
+
+	aligned_mat4 const a(A);
+	aligned_mat4 const b(B);
+	aligned_mat4 const c(C);
+	aligned_vec4 const v(V);
+
+	Error += test_mat4_equal<T>(a * b, A * B, Epsilon);
+	Error += test_mat4_equal<T>(b * c, B * C, Epsilon);
+	Error += test_mat4_equal<T>(c * a * b, C * A * B, Epsilon);
+	Error += test_mat4_equal<T>(a + c, A + C, Epsilon);
+	Error += test_mat4_equal<T>(c - b, C - B, Epsilon);
+
+	aligned_mat4 d(c);
+	d *= a;
+	Error += test_mat4_equal<T>(d, C * A, Epsilon);
+
+	Error += glm::all(glm::epsilonEqual(packed_vec4(c * v), C * V, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(packed_vec4(b * a * v), B * A * V, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(packed_vec4(v * c), V * C, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::epsilonEqual(packed_vec4(v * a), V * A, Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
+	Error += test_copy();
+	Error += test_mat4_operators<float>(0.0001f);
+	Error += test_mat4_operators<double>(0.0000001);
+
 	my_vec4_aligned GNA;
 	my_dvec4_aligned GNI;
 
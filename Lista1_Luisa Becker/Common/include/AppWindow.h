@@ -0,0 +1,415 @@
+// Janela da aplicação: cria a janela GLFW (ou um contexto sem janela para
+// benchmark) e controla o loop de frames dos exercícios
+//
+// No modo --headless o contexto OpenGL é criado com EGL surfaceless (Mesa:
+// llvmpipe/softpipe), sem servidor gráfico, e a imagem é desenhada em um
+// framebuffer fora da tela do tamanho da janela. No Linux, compile com -lEGL;
+// para compilar sem EGL, defina APP_NO_EGL (o --headless usa então uma janela
+// GLFW invisível, que é também o caminho usado no Windows).
+//
+// Uso típico no main dos exercícios:
+//   AppWindow app(argc, argv, "Ex6");
+//   if (!app.create(WIDTH, HEIGHT, "Lista 1 - 6 -- Luisa Becker")) return -1;
+//   ... setup ...
+//   while (app.running()) { app.pollEvents(); ... desenho ...; app.swapBuffers(); }
+//   app.terminate();
+//
+// create() também inicializa o cache de binários de programa (ProgramCache.h),
+// gravado em shader_cache/; --shader-cache DIR muda a pasta e
+// --no-shader-cache desliga o cache.
+//
+// Os ponteiros da OpenGL são resolvidos na primeira chamada de cada função
+// (GLLoader.h); --eager-gl-loader volta a resolver todos na inicialização.
+//
+// Também instala o cache de estado da OpenGL (GLStateCache.h), que descarta
+// chamadas redundantes; --no-state-cache desliga.
+//
+// --trace ARQ.json grava os tempos de CPU e GPU de cada frame (Profiler.h) em um
+// trace do Chrome/Perfetto.
+//
+// --capture PASTA grava cada frame em PASTA/frame_NNNNNN.png (FrameCapture.h);
+// --capture-format raw grava .ppm sem compressão.
+//
+// --gl-record ARQ.gltrace grava todas as chamadas OpenGL do exercício (GLTrace.h)
+// para reprodução com o GLReplay; a gravação desliga o cache de binários.
+//
+// Com janela e fora do benchmark, os frames são desenhados sob demanda: running()
+// dorme em glfwWaitEvents até que algo invalide a imagem (tecla, redimensionamento,
+// pedido de redesenho do sistema ou invalidate()/invalidateAfter() chamados pelo
+// exercício). Cenas paradas não ocupam a CPU; exercícios animados chamam
+// invalidateAfter(1.0 / 60.0) a cada frame. --continuous volta ao loop contínuo.
+
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+// GLFW
+#include <GLFW/glfw3.h>
+
+#if defined(__linux__) && !defined(APP_NO_EGL)
+#define APP_HAS_EGL 1
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#include "GLLoader.h"
+#include "Benchmark.h"
+#include "ProgramCache.h"
+#include "GLStateCache.h"
+#include "Profiler.h"
+#include "FrameCapture.h"
+#include "GLTrace.h"
+
+class AppWindow
+{
+public:
+	GLFWwindow* window = nullptr; // Nulo no modo headless com EGL
+
+	AppWindow(int argc, char** argv, const char* programName) : startTime(std::chrono::steady_clock::now())
+	{
+		bench.configure(parseBenchmarkArgs(argc, argv), programName);
+		for (int i = 1; i < argc; ++i)
+		{
+			if (std::string(argv[i]) == "--shader-cache" && i + 1 < argc)
+				shaderCacheDirectory = argv[++i];
+			else if (std::string(argv[i]) == "--no-shader-cache")
+				shaderCacheDirectory.clear();
+			else if (std::string(argv[i]) == "--no-state-cache")
+				stateCache = false;
+			else if (std::string(argv[i]) == "--trace" && i + 1 < argc)
+				tracePath = argv[++i];
+			else if (std::string(argv[i]) == "--continuous")
+				continuous = true;
+			else if (std::string(argv[i]) == "--eager-gl-loader")
+				lazyGL = false;
+			else if (std::string(argv[i]) == "--capture" && i + 1 < argc)
+				captureDirectory = argv[++i];
+			else if (std::string(argv[i]) == "--capture-format" && i + 1 < argc)
+				captureFormat = std::string(argv[++i]) == "raw" ? CAPTURE_RAW : CAPTURE_PNG;
+			else if (std::string(argv[i]) == "--gl-record" && i + 1 < argc)
+				recordPath = argv[++i];
+		}
+		// Programas carregados com glProgramBinary não poderiam ser reproduzidos
+		if (!recordPath.empty())
+			shaderCacheDirectory.clear();
+	}
+
+	bool headless() const { return bench.getOptions().headless; }
+	Benchmark& benchmark() { return bench; }
+
+	// Tempo da animação em segundos. No benchmark avança 1/60 s por frame, para
+	// que todas as execuções desenhem as mesmas imagens
+	double time() const
+	{
+		if (bench.enabled())
+			return bench.frameIndex() / 60.0;
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	}
+
+	// Desenho sob demanda: só com janela e fora do benchmark
+	bool onDemand() const { return window && !continuous && !bench.enabled(); }
+
+	// Pede um novo frame assim que possível
+	void invalidate() { dirty = true; }
+
+	// Pede um novo frame daqui a seconds segundos (animações); vale o pedido mais próximo
+	void invalidateAfter(double seconds)
+	{
+		std::chrono::steady_clock::time_point at = std::chrono::steady_clock::now() +
+			std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+		if (!redrawScheduled || at < redrawAt)
+			redrawAt = at;
+		redrawScheduled = true;
+	}
+
+	// Carregador das funções da OpenGL usado na GLAD (para funções fora da GLAD 4.0)
+	GLADloadproc getProcLoader() const { return procLoader; }
+
+	// Cria a janela (ou o contexto headless) e carrega os ponteiros da OpenGL com a GLAD
+	bool create(int w, int h, const char* title)
+	{
+		width = w;
+		height = h;
+
+#ifdef APP_HAS_EGL
+		if (headless())
+		{
+			if (!createHeadlessContext())
+				return false;
+			startup((GLADloadproc)eglGetProcAddress);
+			return true;
+		}
+#endif
+
+		glfwInit();
+		if (headless())
+			glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		window = glfwCreateWindow(width, height, title, nullptr, nullptr);
+		if (!window)
+		{
+			std::cout << "Failed to create GLFW window" << std::endl;
+			glfwTerminate();
+			return false;
+		}
+		glfwMakeContextCurrent(window);
+
+		// Eventos que invalidam a imagem no desenho sob demanda
+		glfwSetWindowUserPointer(window, this);
+		glfwSetWindowRefreshCallback(window, refreshCallback);
+		glfwSetFramebufferSizeCallback(window, resizeCallback);
+
+		// No benchmark, os frames não esperam pelo vsync
+		if (bench.enabled())
+			glfwSwapInterval(0);
+
+		// GLAD: carrega os ponteiros das funções da OpenGL
+		if (!loadGL((GLADloadproc)glfwGetProcAddress, lazyGL))
+		{
+			std::cout << "Failed to initialize GLAD" << std::endl;
+			return false;
+		}
+		startup((GLADloadproc)glfwGetProcAddress);
+		return true;
+	}
+
+	// O callback do exercício é chamado por keyCallback, que também invalida a imagem
+	void setKeyCallback(GLFWkeyfun callback)
+	{
+		userKeyCallback = callback;
+		if (window)
+			glfwSetKeyCallback(window, keyCallback);
+	}
+
+	void getFramebufferSize(int* w, int* h)
+	{
+		if (window)
+			glfwGetFramebufferSize(window, w, h);
+		else
+		{
+			*w = width;
+			*h = height;
+		}
+	}
+
+	// Condição do loop da aplicação: falso quando a janela foi fechada ou o
+	// benchmark já rodou todos os frames. Marca o início de cada frame.
+	// No desenho sob demanda, espera aqui até a imagem ser invalidada.
+	bool running()
+	{
+		if (!bench.isSetupDone())
+		{
+			bench.markSetupDone();
+			recordGLTraceSetupDone();
+			sharedProfiler().cpuEvent("setup", startupEnd, Profiler::Clock::now());
+		}
+		if (onDemand())
+			waitForRedraw();
+		if (bench.finished() || (window && glfwWindowShouldClose(window)))
+			return false;
+		bench.beginFrame();
+		frameStart = Profiler::Clock::now();
+		sharedProfiler().beginFrame();
+		return true;
+	}
+
+	void pollEvents()
+	{
+		if (window)
+			glfwPollEvents();
+	}
+
+	// Troca os buffers da tela e fecha a medição do frame
+	void swapBuffers()
+	{
+		if (capture.isEnabled())
+		{
+			ProfileScope scope("capture");
+			int w, h;
+			getFramebufferSize(&w, &h);
+			capture.capture(w, h);
+		}
+		recordGLTraceFrame();
+		{
+			ProfileScope scope("swapBuffers");
+			if (window)
+				glfwSwapBuffers(window);
+			// Sem vsync, o glFinish garante que o tempo do frame inclui o trabalho da OpenGL
+			if (bench.enabled())
+				glFinish();
+		}
+		sharedProfiler().endFrame();
+		sharedProfiler().cpuEvent("frame", frameStart, Profiler::Clock::now());
+		bench.endFrame();
+	}
+
+	// Grava o relatório do benchmark e libera a janela/contexto
+	void terminate()
+	{
+		finishGLTrace(std::cout);
+		if (capture.isEnabled())
+		{
+			capture.release();
+			capture.printStats(std::cout);
+		}
+		bench.writeReport();
+		sharedProfiler().writeTrace();
+		sharedProfiler().release();
+		if (bench.enabled())
+		{
+			printGLLoaderStats(std::cout);
+			sharedProgramCache().printStats(std::cout);
+			if (stateCache)
+				printGLStateCacheStats(std::cout, bench.frameIndex());
+		}
+#ifdef APP_HAS_EGL
+		if (display != EGL_NO_DISPLAY)
+		{
+			glDeleteFramebuffers(1, &offscreenFBO);
+			glDeleteRenderbuffers(1, &offscreenRBO);
+			eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			eglDestroyContext(display, context);
+			eglTerminate(display);
+			display = EGL_NO_DISPLAY;
+			return;
+		}
+#endif
+		glfwTerminate();
+	}
+
+private:
+	// Dorme nos eventos da GLFW até a imagem ser invalidada ou a janela fechar
+	void waitForRedraw()
+	{
+		while (!dirty && !glfwWindowShouldClose(window))
+		{
+			if (redrawScheduled)
+			{
+				double remaining = std::chrono::duration<double>(redrawAt - std::chrono::steady_clock::now()).count();
+				if (remaining <= 0.0)
+					break;
+				glfwWaitEventsTimeout(remaining);
+			}
+			else
+				glfwWaitEvents();
+		}
+		dirty = false;
+		redrawScheduled = false;
+	}
+
+	static AppWindow* fromWindow(GLFWwindow* window)
+	{
+		return (AppWindow*)glfwGetWindowUserPointer(window);
+	}
+
+	static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mode)
+	{
+		AppWindow* app = fromWindow(window);
+		app->invalidate();
+		if (app->userKeyCallback)
+			app->userKeyCallback(window, key, scancode, action, mode);
+	}
+
+	static void refreshCallback(GLFWwindow* window) { fromWindow(window)->invalidate(); }
+	static void resizeCallback(GLFWwindow* window, int, int) { fromWindow(window)->invalidate(); }
+
+	// Depois da GLAD: cache de programas, contadores do benchmark e cache de estado
+	void startup(GLADloadproc loader)
+	{
+		procLoader = loader;
+		sharedProgramCache().init(procLoader, shaderCacheDirectory);
+		bench.markStartupDone();
+		if (stateCache)
+			installGLStateCache();
+		// Por último, para gravar as chamadas como o exercício as fez
+		if (!recordPath.empty())
+			procLoader = startGLTrace(recordPath, width, height, procLoader);
+		startupEnd = Profiler::Clock::now();
+		if (!captureDirectory.empty())
+			capture.init(captureDirectory, captureFormat);
+		sharedProfiler().init(tracePath, startTime);
+		sharedProfiler().cpuEvent("startup", startTime, startupEnd);
+	}
+
+#ifdef APP_HAS_EGL
+	// Contexto OpenGL sem janela: EGL surfaceless do Mesa (ou o display padrão,
+	// se a plataforma surfaceless não existir) + framebuffer fora da tela
+	bool createHeadlessContext()
+	{
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+			(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay)
+			display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		if (display == EGL_NO_DISPLAY)
+			display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, NULL, NULL))
+		{
+			std::cout << "ERROR::HEADLESS::EGL_INITIALIZE_FAILED" << std::endl;
+			return false;
+		}
+		eglBindAPI(EGL_OPENGL_API);
+
+		// Mesmo perfil que a GLFW cria por padrão (compatibilidade), OpenGL 4.0+
+		const EGLint attributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 4,
+			EGL_CONTEXT_MINOR_VERSION, 0,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+			EGL_NONE
+		};
+		context = eglCreateContext(display, (EGLConfig)0, EGL_NO_CONTEXT, attributes);
+		if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+		{
+			std::cout << "ERROR::HEADLESS::EGL_CONTEXT_FAILED 0x" << std::hex << eglGetError() << std::dec << std::endl;
+			return false;
+		}
+
+		if (!loadGL((GLADloadproc)eglGetProcAddress, lazyGL))
+		{
+			std::cout << "Failed to initialize GLAD" << std::endl;
+			return false;
+		}
+
+		// Sem superfície não existe framebuffer padrão: os exercícios desenham
+		// neste framebuffer, que fica vinculado o tempo todo
+		glGenRenderbuffers(1, &offscreenRBO);
+		glBindRenderbuffer(GL_RENDERBUFFER, offscreenRBO);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glGenFramebuffers(1, &offscreenFBO);
+		glBindFramebuffer(GL_FRAMEBUFFER, offscreenFBO);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, offscreenRBO);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			std::cout << "ERROR::HEADLESS::FRAMEBUFFER_INCOMPLETE" << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	EGLDisplay display = EGL_NO_DISPLAY;
+	EGLContext context = EGL_NO_CONTEXT;
+	GLuint offscreenFBO = 0, offscreenRBO = 0;
+#endif
+
+	Benchmark bench;
+	std::string shaderCacheDirectory = "shader_cache";
+	GLADloadproc procLoader = nullptr;
+	bool stateCache = true;
+	std::string tracePath;
+	bool continuous = false;
+	bool lazyGL = true;
+	std::string captureDirectory;
+	std::string recordPath;
+	CaptureFormat captureFormat = CAPTURE_PNG;
+	FrameCapture capture;
+	bool dirty = true;              // O primeiro frame sempre é desenhado
+	bool redrawScheduled = false;
+	std::chrono::steady_clock::time_point redrawAt;
+	GLFWkeyfun userKeyCallback = nullptr;
+	Profiler::Clock::time_point startupEnd, frameStart;
+	std::chrono::steady_clock::time_point startTime;
+	int width = 0, height = 0;
+};
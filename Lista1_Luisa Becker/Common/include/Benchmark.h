@@ -0,0 +1,297 @@
+// Medição de desempenho por frame dos exercícios
+//
+// Conta chamadas de desenho, trocas de estado e envios de uniform interceptando
+// os ponteiros de função da GLAD (glad_glDrawArrays etc.), mede o tempo de CPU de
+// cada frame e o tempo de inicialização, e gera um relatório em JSON com os
+// percentis - assim regressões de desempenho aparecem em máquinas de CI sem GPU.
+//
+// Usado pela AppWindow (AppWindow.h); as opções vêm da linha de comando:
+//   --benchmark N          roda N frames e encerra (padrão: 300)
+//   --warmup N             frames iniciais ignorados nos percentis (padrão: 5)
+//   --benchmark-json ARQ   grava o relatório em ARQ em vez de imprimir na saída padrão
+//   --headless             sem janela: contexto EGL surfaceless (Mesa/llvmpipe no Linux)
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+
+//GLAD
+#include <glad/glad.h>
+
+// Contadores de chamadas OpenGL de um frame
+struct GLCallCounters
+{
+	long long drawCalls = 0;      // glDraw*, glMultiDraw*
+	long long stateChanges = 0;   // Programas, VAOs, buffers, texturas e estado fixo (glLineWidth...)
+	long long uniformUpdates = 0; // glUniform*
+	long long elidedCalls = 0;    // Chamadas redundantes descartadas pelo cache de estado (GLStateCache.h)
+};
+
+namespace benchmark_detail
+{
+	// Os exercícios são compilados como uma única unidade de tradução, então
+	// estado estático no cabeçalho é suficiente
+	static GLCallCounters counters;
+
+	// Para cada função interceptada: ponteiro original e substituto que conta e repassa
+#define BENCHMARK_HOOK(name, PFN, counter, params, args) \
+	static PFN real_##name = NULL; \
+	static void APIENTRY hook_##name params { ++counters.counter; real_##name args; }
+
+	BENCHMARK_HOOK(glDrawArrays, PFNGLDRAWARRAYSPROC, drawCalls, (GLenum m, GLint f, GLsizei c), (m, f, c))
+	BENCHMARK_HOOK(glDrawElements, PFNGLDRAWELEMENTSPROC, drawCalls, (GLenum m, GLsizei c, GLenum t, const void* i), (m, c, t, i))
+	BENCHMARK_HOOK(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, drawCalls, (GLenum m, GLint f, GLsizei c, GLsizei n), (m, f, c, n))
+	BENCHMARK_HOOK(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, drawCalls, (GLenum m, GLsizei c, GLenum t, const void* i, GLsizei n), (m, c, t, i, n))
+	BENCHMARK_HOOK(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, drawCalls, (GLenum m, const GLint* f, const GLsizei* c, GLsizei n), (m, f, c, n))
+	BENCHMARK_HOOK(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, drawCalls, (GLenum m, const GLsizei* c, GLenum t, const void* const* i, GLsizei n), (m, c, t, i, n))
+	BENCHMARK_HOOK(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC, drawCalls, (GLenum m, const void* i), (m, i))
+	BENCHMARK_HOOK(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, drawCalls, (GLenum m, GLenum t, const void* i), (m, t, i))
+	BENCHMARK_HOOK(glUseProgram, PFNGLUSEPROGRAMPROC, stateChanges, (GLuint p), (p))
+	BENCHMARK_HOOK(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, stateChanges, (GLuint a), (a))
+	BENCHMARK_HOOK(glBindBuffer, PFNGLBINDBUFFERPROC, stateChanges, (GLenum t, GLuint b), (t, b))
+	BENCHMARK_HOOK(glBindTexture, PFNGLBINDTEXTUREPROC, stateChanges, (GLenum t, GLuint x), (t, x))
+	BENCHMARK_HOOK(glActiveTexture, PFNGLACTIVETEXTUREPROC, stateChanges, (GLenum t), (t))
+	BENCHMARK_HOOK(glLineWidth, PFNGLLINEWIDTHPROC, stateChanges, (GLfloat w), (w))
+	BENCHMARK_HOOK(glPointSize, PFNGLPOINTSIZEPROC, stateChanges, (GLfloat s), (s))
+	BENCHMARK_HOOK(glClearColor, PFNGLCLEARCOLORPROC, stateChanges, (GLfloat r, GLfloat g, GLfloat b, GLfloat a), (r, g, b, a))
+	BENCHMARK_HOOK(glEnable, PFNGLENABLEPROC, stateChanges, (GLenum c), (c))
+	BENCHMARK_HOOK(glDisable, PFNGLDISABLEPROC, stateChanges, (GLenum c), (c))
+	BENCHMARK_HOOK(glBlendFunc, PFNGLBLENDFUNCPROC, stateChanges, (GLenum s, GLenum d), (s, d))
+	BENCHMARK_HOOK(glViewport, PFNGLVIEWPORTPROC, stateChanges, (GLint x, GLint y, GLsizei w, GLsizei h), (x, y, w, h))
+	BENCHMARK_HOOK(glUniform1i, PFNGLUNIFORM1IPROC, uniformUpdates, (GLint l, GLint v), (l, v))
+	BENCHMARK_HOOK(glUniform1f, PFNGLUNIFORM1FPROC, uniformUpdates, (GLint l, GLfloat v), (l, v))
+	BENCHMARK_HOOK(glUniform2f, PFNGLUNIFORM2FPROC, uniformUpdates, (GLint l, GLfloat x, GLfloat y), (l, x, y))
+	BENCHMARK_HOOK(glUniform3f, PFNGLUNIFORM3FPROC, uniformUpdates, (GLint l, GLfloat x, GLfloat y, GLfloat z), (l, x, y, z))
+	BENCHMARK_HOOK(glUniform4f, PFNGLUNIFORM4FPROC, uniformUpdates, (GLint l, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (l, x, y, z, w))
+	BENCHMARK_HOOK(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, uniformUpdates, (GLint l, GLsizei c, GLboolean t, const GLfloat* v), (l, c, t, v))
+
+#undef BENCHMARK_HOOK
+}
+
+// Troca os ponteiros da GLAD pelos contadores (chamar depois de gladLoadGLLoader)
+inline void installGLCallCounters()
+{
+	using namespace benchmark_detail;
+#define BENCHMARK_INSTALL(name) \
+	if (glad_##name && !real_##name) { real_##name = glad_##name; glad_##name = hook_##name; }
+
+	BENCHMARK_INSTALL(glDrawArrays)
+	BENCHMARK_INSTALL(glDrawElements)
+	BENCHMARK_INSTALL(glDrawArraysInstanced)
+	BENCHMARK_INSTALL(glDrawElementsInstanced)
+	BENCHMARK_INSTALL(glMultiDrawArrays)
+	BENCHMARK_INSTALL(glMultiDrawElements)
+	BENCHMARK_INSTALL(glDrawArraysIndirect)
+	BENCHMARK_INSTALL(glDrawElementsIndirect)
+	BENCHMARK_INSTALL(glUseProgram)
+	BENCHMARK_INSTALL(glBindVertexArray)
+	BENCHMARK_INSTALL(glBindBuffer)
+	BENCHMARK_INSTALL(glBindTexture)
+	BENCHMARK_INSTALL(glActiveTexture)
+	BENCHMARK_INSTALL(glLineWidth)
+	BENCHMARK_INSTALL(glPointSize)
+	BENCHMARK_INSTALL(glClearColor)
+	BENCHMARK_INSTALL(glEnable)
+	BENCHMARK_INSTALL(glDisable)
+	BENCHMARK_INSTALL(glBlendFunc)
+	BENCHMARK_INSTALL(glViewport)
+	BENCHMARK_INSTALL(glUniform1i)
+	BENCHMARK_INSTALL(glUniform1f)
+	BENCHMARK_INSTALL(glUniform2f)
+	BENCHMARK_INSTALL(glUniform3f)
+	BENCHMARK_INSTALL(glUniform4f)
+	BENCHMARK_INSTALL(glUniformMatrix4fv)
+
+#undef BENCHMARK_INSTALL
+}
+
+struct BenchmarkOptions
+{
+	bool enabled = false;  // --benchmark ou --headless
+	bool headless = false;
+	int frames = 300;
+	int warmup = 5;
+	std::string jsonPath;  // Vazio: imprime na saída padrão
+};
+
+// Lê as opções de benchmark da linha de comando (as demais opções são ignoradas)
+inline BenchmarkOptions parseBenchmarkArgs(int argc, char** argv)
+{
+	BenchmarkOptions options;
+	for (int i = 1; i < argc; ++i)
+	{
+		bool hasValue = i + 1 < argc;
+		if (strcmp(argv[i], "--benchmark") == 0)
+		{
+			options.enabled = true;
+			if (hasValue && argv[i + 1][0] != '-')
+				options.frames = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "--headless") == 0)
+		{
+			options.enabled = true;
+			options.headless = true;
+		}
+		else if (strcmp(argv[i], "--warmup") == 0 && hasValue)
+			options.warmup = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--benchmark-json") == 0 && hasValue)
+			options.jsonPath = argv[++i];
+	}
+	if (options.frames < 1)
+		options.frames = 1;
+	if (options.warmup < 0 || options.warmup >= options.frames)
+		options.warmup = 0;
+	return options;
+}
+
+class Benchmark
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	Benchmark() : start(Clock::now()) {}
+
+	void configure(const BenchmarkOptions& opts, const std::string& programName)
+	{
+		options = opts;
+		name = programName;
+		frameTimes.reserve(options.frames);
+	}
+
+	const BenchmarkOptions& getOptions() const { return options; }
+	bool enabled() const { return options.enabled; }
+
+	// Fim da criação do contexto e carga da GLAD
+	void markStartupDone()
+	{
+		startupEnd = Clock::now();
+		if (options.enabled)
+			installGLCallCounters();
+	}
+
+	// Fim da preparação do exercício (shaders, geometria): início do primeiro frame
+	void markSetupDone()
+	{
+		setupEnd = Clock::now();
+		setupDone = true;
+	}
+
+	bool isSetupDone() const { return setupDone; }
+
+	void beginFrame()
+	{
+		frameStart = Clock::now();
+		benchmark_detail::counters = GLCallCounters();
+	}
+
+	void endFrame()
+	{
+		frameTimes.push_back(std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count());
+		frameCounters.push_back(benchmark_detail::counters);
+	}
+
+	// Frames já medidos (o frame atual, dentro do loop)
+	int frameIndex() const { return (int)frameTimes.size(); }
+
+	// Já rodou todos os frames pedidos?
+	bool finished() const
+	{
+		return options.enabled && (int)frameTimes.size() >= options.frames;
+	}
+
+	// Monta o relatório em JSON
+	std::string report() const
+	{
+		std::vector<double> measured(frameTimes.begin() + std::min(frameTimes.size(), (size_t)options.warmup), frameTimes.end());
+		std::sort(measured.begin(), measured.end());
+		double total = 0.0;
+		for (size_t i = 0; i < measured.size(); ++i)
+			total += measured[i];
+
+		GLCallCounters sum;
+		for (size_t i = 0; i < frameCounters.size(); ++i)
+		{
+			sum.drawCalls += frameCounters[i].drawCalls;
+			sum.stateChanges += frameCounters[i].stateChanges;
+			sum.uniformUpdates += frameCounters[i].uniformUpdates;
+			sum.elidedCalls += frameCounters[i].elidedCalls;
+		}
+		double frames = frameCounters.empty() ? 1.0 : (double)frameCounters.size();
+
+		const GLubyte* renderer = glGetString(GL_RENDERER);
+		std::ostringstream json;
+		json << "{\n";
+		json << "  \"program\": \"" << name << "\",\n";
+		json << "  \"renderer\": \"" << (renderer ? (const char*)renderer : "") << "\",\n";
+		json << "  \"headless\": " << (options.headless ? "true" : "false") << ",\n";
+		json << "  \"frames\": " << frameTimes.size() << ",\n";
+		json << "  \"warmup_frames\": " << frameTimes.size() - measured.size() << ",\n";
+		json << "  \"startup_ms\": " << ms(start, startupEnd) << ",\n";
+		json << "  \"setup_ms\": " << ms(startupEnd, setupEnd) << ",\n";
+		json << "  \"frame_ms\": {\n";
+		json << "    \"mean\": " << (measured.empty() ? 0.0 : total / measured.size()) << ",\n";
+		json << "    \"min\": " << percentile(measured, 0.0) << ",\n";
+		json << "    \"p50\": " << percentile(measured, 0.50) << ",\n";
+		json << "    \"p90\": " << percentile(measured, 0.90) << ",\n";
+		json << "    \"p99\": " << percentile(measured, 0.99) << ",\n";
+		json << "    \"max\": " << percentile(measured, 1.0) << "\n";
+		json << "  },\n";
+		json << "  \"per_frame\": {\n";
+		json << "    \"draw_calls\": " << sum.drawCalls / frames << ",\n";
+		json << "    \"state_changes\": " << sum.stateChanges / frames << ",\n";
+		json << "    \"uniform_updates\": " << sum.uniformUpdates / frames << ",\n";
+		json << "    \"elided_state_calls\": " << sum.elidedCalls / frames << "\n";
+		json << "  }\n";
+		json << "}\n";
+		return json.str();
+	}
+
+	// Grava o relatório no arquivo pedido (ou na saída padrão)
+	void writeReport() const
+	{
+		if (!options.enabled)
+			return;
+		if (options.jsonPath.empty())
+		{
+			std::cout << report();
+			return;
+		}
+		std::ofstream file(options.jsonPath.c_str());
+		if (!file)
+		{
+			std::cout << "ERROR::BENCHMARK::CANNOT_WRITE_REPORT " << options.jsonPath << std::endl;
+			return;
+		}
+		file << report();
+	}
+
+private:
+	static double ms(Clock::time_point from, Clock::time_point to)
+	{
+		return std::chrono::duration<double, std::milli>(to - from).count();
+	}
+
+	// Percentil pelo método do posto mais próximo (values já ordenado)
+	static double percentile(const std::vector<double>& values, double p)
+	{
+		if (values.empty())
+			return 0.0;
+		size_t rank = (size_t)(p * (values.size() - 1) + 0.5);
+		return values[std::min(rank, values.size() - 1)];
+	}
+
+	BenchmarkOptions options;
+	std::string name;
+	Clock::time_point start, startupEnd, setupEnd, frameStart;
+	bool setupDone = false;
+	std::vector<double> frameTimes;
+	std::vector<GLCallCounters> frameCounters;
+};
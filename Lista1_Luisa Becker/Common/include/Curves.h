@@ -0,0 +1,203 @@
+// Tesselação adaptativa de curvas paramétricas (espiral do Ex7), com erro
+// limitado em pixels na tela
+//
+// O passo do parâmetro é escolhido pela curvatura: em um trecho com raio de
+// curvatura rho (em pixels), um segmento que gira phi radianos se afasta da curva
+// no máximo rho * (1 - cos(phi / 2)) - a flecha da corda. O passo é o maior phi
+// com a flecha dentro da tolerância. Trechos fora da tela podem dar passos do
+// tamanho da distância até a tela, já que a corda não alcança a tela.
+//
+// Os vértices são entregues em blocos de tamanho fixo (kCurveChunk), então
+// curvas com muitas voltas nunca precisam de um array com todos os pontos:
+// uploadCurve() conta os pontos em uma primeira passada, aloca o VBO e envia
+// bloco a bloco com glBufferSubData.
+
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+
+//GLAD
+#include <glad/glad.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Vértices por bloco entregue ao destino da tesselação
+const GLuint kCurveChunk = 256;
+
+struct CurveTessOptions
+{
+	float tolerance = 0.25f;     // Erro máximo entre a curva e as cordas, em pixels
+	int viewportWidth = 800;     // Tamanho da tela em pixels: converte NDC em pixels
+	int viewportHeight = 600;
+	GLuint maxVertices = 1 << 22; // Limite de segurança
+};
+
+// Malha de uma curva: VBO com as posições desenhado como GL_LINE_STRIP
+struct CurveMesh
+{
+	GLuint VAO = 0, VBO = 0;
+	GLsizei vertexCount = 0;
+};
+
+// Espiral de Arquimedes r = a + b * theta, com centro em (cx, cy)
+// evaluate() devolve a posição e as duas primeiras derivadas em theta
+struct SpiralCurve
+{
+	float a = 0.0f, b = 0.0f;
+	float cx = 0.0f, cy = 0.0f;
+
+	void evaluate(double t, double p[2], double d1[2], double d2[2]) const
+	{
+		double r = a + b * t;
+		double c = std::cos(t), s = std::sin(t);
+		p[0] = cx + r * c;
+		p[1] = cy + r * s;
+		d1[0] = b * c - r * s;
+		d1[1] = b * s + r * c;
+		d2[0] = -2.0 * b * s - r * c;
+		d2[1] = 2.0 * b * c - r * s;
+	}
+};
+
+inline SpiralCurve spiralCurve(float a, float b)
+{
+	SpiralCurve curve;
+	curve.a = a;
+	curve.b = b;
+	return curve;
+}
+
+namespace curves_detail
+{
+	// Maior passo de parâmetro a partir de t que respeita a tolerância
+	template <class Curve>
+	double stepAt(const Curve& curve, double t, const CurveTessOptions& options)
+	{
+		double sx = options.viewportWidth * 0.5, sy = options.viewportHeight * 0.5;
+		double p[2], d1[2], d2[2];
+		curve.evaluate(t, p, d1, d2);
+
+		// Derivadas em pixels (a escala de x e y da tela pode ser diferente)
+		double dx = d1[0] * sx, dy = d1[1] * sy;
+		double ddx = d2[0] * sx, ddy = d2[1] * sy;
+		double speed = std::sqrt(dx * dx + dy * dy);
+		if (speed <= 0.0)
+			return 0.0;
+
+		// Raio de curvatura rho = |C'|^3 / |C' x C''|
+		double cross = std::fabs(dx * ddy - dy * ddx);
+		double tolerance = options.tolerance;
+		double angle = 0.5; // Giro máximo por segmento, mesmo em trechos quase retos
+		double arc;
+		if (cross > 0.0)
+		{
+			double rho = speed * speed * speed / cross;
+			if (tolerance < 2.0 * rho)
+				angle = std::min(angle, 2.0 * std::acos(1.0 - tolerance / rho));
+			arc = rho * angle;
+		}
+		else
+			arc = 1e30; // Reta
+
+		// Distância (em pixels) do ponto até a tela: a corda de um arco mais curto
+		// que ela fica inteira fora da tela
+		double px = (p[0] + 1.0) * sx, py = (p[1] + 1.0) * sy;
+		double ox = std::max(0.0, std::max(-px, px - options.viewportWidth));
+		double oy = std::max(0.0, std::max(-py, py - options.viewportHeight));
+		double outside = std::sqrt(ox * ox + oy * oy);
+
+		return std::max(arc, outside) / speed;
+	}
+}
+
+// Tessela a curva entre t0 e t1 e entrega os vértices (x, y, 0) em blocos de até
+// kCurveChunk vértices: sink(const GLfloat* vertices, GLuint count, GLuint first).
+// Retorna a quantidade total de vértices
+template <class Curve, class Sink>
+GLuint tessellateCurve(const Curve& curve, double t0, double t1, const CurveTessOptions& options, Sink sink)
+{
+	GLfloat chunk[kCurveChunk * 3];
+	GLuint inChunk = 0, total = 0;
+	double minStep = (t1 - t0) * 1e-7;
+
+	double t = t0;
+	for (;;)
+	{
+		double p[2], d1[2], d2[2];
+		curve.evaluate(t, p, d1, d2);
+		chunk[inChunk * 3 + 0] = (GLfloat)p[0];
+		chunk[inChunk * 3 + 1] = (GLfloat)p[1];
+		chunk[inChunk * 3 + 2] = 0.0f;
+		++total;
+		if (++inChunk == kCurveChunk)
+		{
+			sink(chunk, inChunk, total - inChunk);
+			inChunk = 0;
+		}
+		if (t >= t1 || total >= options.maxVertices)
+			break;
+
+		// O passo vale para o começo e para o fim do segmento (a curvatura pode
+		// crescer dentro dele)
+		double step = curves_detail::stepAt(curve, t, options);
+		double next = t + std::max(step, minStep);
+		if (next < t1)
+			step = std::min(step, curves_detail::stepAt(curve, next, options));
+		t = std::min(t1, t + std::max(step, minStep));
+	}
+	if (inChunk > 0)
+		sink(chunk, inChunk, total - inChunk);
+	return total;
+}
+
+// Quantidade de vértices que tessellateCurve() vai gerar
+template <class Curve>
+GLuint countCurveVertices(const Curve& curve, double t0, double t1, const CurveTessOptions& options)
+{
+	return tessellateCurve(curve, t0, t1, options, [](const GLfloat*, GLuint, GLuint) {});
+}
+
+// Cria VAO e VBO com a curva tesselada; os blocos vão direto para o VBO
+// Apenas atributo coordenada nos vértices (layout 0, vec3)
+template <class Curve>
+CurveMesh uploadCurve(const Curve& curve, double t0, double t1, const CurveTessOptions& options)
+{
+	CurveMesh mesh;
+	mesh.vertexCount = (GLsizei)countCurveVertices(curve, t0, t1, options);
+
+	glGenVertexArrays(1, &mesh.VAO);
+	glBindVertexArray(mesh.VAO);
+
+	glGenBuffers(1, &mesh.VBO);
+	glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)mesh.vertexCount * 3 * sizeof(GLfloat), NULL, GL_STATIC_DRAW);
+	tessellateCurve(curve, t0, t1, options, [](const GLfloat* vertices, GLuint count, GLuint first)
+	{
+		glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)first * 3 * sizeof(GLfloat),
+			(GLsizeiptr)count * 3 * sizeof(GLfloat), vertices);
+	});
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
+	glEnableVertexAttribArray(0);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+
+	return mesh;
+}
+
+// Desenha a curva inteira (o VAO precisa estar vinculado)
+inline void drawCurve(const CurveMesh& mesh)
+{
+	glDrawArrays(GL_LINE_STRIP, 0, mesh.vertexCount);
+}
+
+inline void deleteCurve(CurveMesh& mesh)
+{
+	glDeleteVertexArrays(1, &mesh.VAO);
+	glDeleteBuffers(1, &mesh.VBO);
+	mesh = CurveMesh();
+}
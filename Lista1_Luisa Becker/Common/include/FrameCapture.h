@@ -0,0 +1,576 @@
+// Gravação dos frames em arquivos (PNG ou PPM), sem travar o loop de desenho
+//
+// A leitura do framebuffer vai para um anel de kCaptureFrames pixel buffers
+// (GL_PIXEL_PACK_BUFFER): com um PBO vinculado, glReadPixels só agenda a cópia
+// e volta na hora. Um fence marca cada leitura; o PBO só é mapeado quando volta
+// a ser usado, kCaptureFrames frames depois, e a essa altura a cópia já terminou.
+// Os pixels mapeados são copiados para um buffer da CPU e entregues a um conjunto
+// de threads que invertem as linhas (a OpenGL lê de baixo para cima) e codificam
+// o arquivo em paralelo. Se a codificação ficar para trás, o loop espera em vez
+// de descartar frames.
+//
+// PNG: RGB 8 bits, filtro Up e deflate com códigos de Huffman fixos e LZ77
+// guloso - bem mais rápido que o zlib no nível padrão e suficiente para as
+// áreas de cor chapada dos exercícios. Raw: PPM binário (P6), sem compressão.
+//
+// Usado pela AppWindow: --capture PASTA grava PASTA/frame_000000.png, ...;
+// --capture-format raw troca para .ppm.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <filesystem>
+
+//GLAD
+#include <glad/glad.h>
+
+// PBOs no anel de leitura
+const int kCaptureFrames = 3;
+
+enum CaptureFormat
+{
+	CAPTURE_PNG,
+	CAPTURE_RAW
+};
+
+struct FrameCaptureStats
+{
+	unsigned frames = 0;          // Leituras agendadas
+	unsigned written = 0;         // Arquivos gravados
+	unsigned failed = 0;          // Arquivos que não puderam ser gravados
+	unsigned long long bytes = 0; // Tamanho total dos arquivos
+	unsigned readbackStalls = 0;  // PBOs que ainda não estavam prontos ao serem reaproveitados
+	unsigned encoderWaits = 0;    // Frames em que o loop esperou as threads de codificação
+	double copyMs = 0.0;          // Mapear e copiar os PBOs (thread de desenho)
+	double waitMs = 0.0;          // Esperando fences ou as threads de codificação
+	double encodeMs = 0.0;        // Soma do tempo de codificação em todas as threads
+};
+
+namespace capture_detail
+{
+	inline uint32_t crc32(const unsigned char* data, size_t size, uint32_t crc = 0)
+	{
+		static const std::vector<uint32_t> table = []()
+		{
+			std::vector<uint32_t> t(256);
+			for (uint32_t n = 0; n < 256; ++n)
+			{
+				uint32_t c = n;
+				for (int k = 0; k < 8; ++k)
+					c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+				t[n] = c;
+			}
+			return t;
+		}();
+		crc = ~crc;
+		for (size_t i = 0; i < size; ++i)
+			crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+		return ~crc;
+	}
+
+	inline uint32_t adler32(const unsigned char* data, size_t size)
+	{
+		uint32_t a = 1, b = 0;
+		while (size > 0)
+		{
+			size_t n = size < 5552 ? size : 5552; // Maior bloco sem estouro antes do módulo
+			size -= n;
+			while (n--)
+			{
+				a += *data++;
+				b += a;
+			}
+			a %= 65521;
+			b %= 65521;
+		}
+		return (b << 16) | a;
+	}
+
+	// Escreve bits do menos para o mais significativo, como o deflate pede
+	class BitWriter
+	{
+	public:
+		explicit BitWriter(std::vector<unsigned char>& output) : out(output) {}
+
+		void put(uint32_t value, int count)
+		{
+			bits |= (uint64_t)value << used;
+			used += count;
+			while (used >= 8)
+			{
+				out.push_back((unsigned char)bits);
+				bits >>= 8;
+				used -= 8;
+			}
+		}
+
+		// Códigos de Huffman vão do bit mais significativo para o menos
+		void putCode(uint32_t code, int length)
+		{
+			uint32_t reversed = 0;
+			for (int i = 0; i < length; ++i)
+				reversed |= ((code >> i) & 1) << (length - 1 - i);
+			put(reversed, length);
+		}
+
+		void flush()
+		{
+			if (used > 0)
+				out.push_back((unsigned char)bits);
+			bits = 0;
+			used = 0;
+		}
+
+	private:
+		std::vector<unsigned char>& out;
+		uint64_t bits = 0;
+		int used = 0;
+	};
+
+	// Símbolo literal/comprimento com os códigos fixos do deflate (RFC 1951, 3.2.6)
+	inline void putLiteral(BitWriter& writer, int symbol)
+	{
+		if (symbol < 144)
+			writer.putCode(0x30 + symbol, 8);
+		else if (symbol < 256)
+			writer.putCode(0x190 + symbol - 144, 9);
+		else if (symbol < 280)
+			writer.putCode(symbol - 256, 7);
+		else
+			writer.putCode(0xC0 + symbol - 280, 8);
+	}
+
+	inline void putMatch(BitWriter& writer, int length, int distance)
+	{
+		static const int lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+			35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+		static const int lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+			3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+		static const int distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+			257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+		static const int distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+			7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+		int l = 28;
+		while (lengthBase[l] > length)
+			--l;
+		putLiteral(writer, 257 + l);
+		writer.put(length - lengthBase[l], lengthExtra[l]);
+
+		int d = 29;
+		while (distanceBase[d] > distance)
+			--d;
+		writer.putCode(d, 5);
+		writer.put(distance - distanceBase[d], distanceExtra[d]);
+	}
+
+	// Fluxo zlib com um único bloco deflate de códigos fixos
+	inline void compress(const std::vector<unsigned char>& data, std::vector<unsigned char>& out)
+	{
+		const int kHashBits = 15, kWindow = 32768, kMinMatch = 3, kMaxMatch = 258;
+		out.push_back(0x78);
+		out.push_back(0x01);
+
+		BitWriter writer(out);
+		writer.put(1, 1); // Último bloco
+		writer.put(1, 2); // Códigos fixos
+
+		std::vector<int> head((size_t)1 << kHashBits, -1);
+		const unsigned char* p = data.data();
+		int size = (int)data.size();
+		int i = 0;
+		while (i < size)
+		{
+			int bestLength = 0, bestDistance = 0;
+			if (i + kMinMatch <= size)
+			{
+				uint32_t hash = ((p[i] << 16) | (p[i + 1] << 8) | p[i + 2]) * 2654435761u >> (32 - kHashBits);
+				int candidate = head[hash];
+				head[hash] = i;
+				if (candidate >= 0 && i - candidate <= kWindow)
+				{
+					int limit = std::min(kMaxMatch, size - i);
+					int length = 0;
+					while (length < limit && p[candidate + length] == p[i + length])
+						++length;
+					if (length >= kMinMatch)
+					{
+						bestLength = length;
+						bestDistance = i - candidate;
+					}
+				}
+			}
+			if (bestLength)
+			{
+				putMatch(writer, bestLength, bestDistance);
+				i += bestLength;
+			}
+			else
+				putLiteral(writer, p[i++]);
+		}
+		putLiteral(writer, 256); // Fim do bloco
+		writer.flush();
+
+		uint32_t adler = adler32(data.data(), data.size());
+		for (int shift = 24; shift >= 0; shift -= 8)
+			out.push_back((unsigned char)(adler >> shift));
+	}
+
+	inline void putChunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data)
+	{
+		uint32_t length = (uint32_t)data.size();
+		for (int shift = 24; shift >= 0; shift -= 8)
+			png.push_back((unsigned char)(length >> shift));
+		size_t start = png.size();
+		png.insert(png.end(), type, type + 4);
+		png.insert(png.end(), data.begin(), data.end());
+		uint32_t crc = crc32(png.data() + start, png.size() - start);
+		for (int shift = 24; shift >= 0; shift -= 8)
+			png.push_back((unsigned char)(crc >> shift));
+	}
+
+	// PNG RGB a partir de pixels RGBA na ordem da OpenGL (primeira linha embaixo)
+	inline void encodePNG(const unsigned char* rgba, int width, int height, std::vector<unsigned char>& png)
+	{
+		// Linhas invertidas, sem alfa, cada uma com o filtro Up (diferença para a de cima)
+		size_t stride = (size_t)width * 3;
+		std::vector<unsigned char> filtered((stride + 1) * height);
+		std::vector<unsigned char> previous(stride, 0), row(stride);
+		for (int y = 0; y < height; ++y)
+		{
+			const unsigned char* source = rgba + (size_t)(height - 1 - y) * width * 4;
+			for (int x = 0; x < width; ++x)
+			{
+				row[x * 3] = source[x * 4];
+				row[x * 3 + 1] = source[x * 4 + 1];
+				row[x * 3 + 2] = source[x * 4 + 2];
+			}
+			unsigned char* target = &filtered[(stride + 1) * y];
+			target[0] = 2;
+			for (size_t i = 0; i < stride; ++i)
+				target[1 + i] = (unsigned char)(row[i] - previous[i]);
+			previous.swap(row);
+		}
+
+		static const unsigned char signature[8] = { 137, 'P', 'N', 'G', '\r', '\n', 26, '\n' };
+		png.assign(signature, signature + 8);
+
+		std::vector<unsigned char> header(13, 0);
+		for (int i = 0; i < 4; ++i)
+		{
+			header[i] = (unsigned char)(width >> (24 - 8 * i));
+			header[4 + i] = (unsigned char)(height >> (24 - 8 * i));
+		}
+		header[8] = 8; // Bits por canal
+		header[9] = 2; // RGB
+		putChunk(png, "IHDR", header);
+
+		std::vector<unsigned char> compressed;
+		compressed.reserve(filtered.size() / 4);
+		compress(filtered, compressed);
+		putChunk(png, "IDAT", compressed);
+		putChunk(png, "IEND", std::vector<unsigned char>());
+	}
+
+	// PPM binário (P6) a partir de pixels RGBA na ordem da OpenGL
+	inline void encodePPM(const unsigned char* rgba, int width, int height, std::vector<unsigned char>& ppm)
+	{
+		char header[64];
+		int length = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", width, height);
+		ppm.assign(header, header + length);
+		ppm.resize(length + (size_t)width * height * 3);
+		unsigned char* target = &ppm[length];
+		for (int y = height - 1; y >= 0; --y)
+		{
+			const unsigned char* source = rgba + (size_t)y * width * 4;
+			for (int x = 0; x < width; ++x, target += 3, source += 4)
+			{
+				target[0] = source[0];
+				target[1] = source[1];
+				target[2] = source[2];
+			}
+		}
+	}
+}
+
+class FrameCapture
+{
+public:
+	~FrameCapture() { stopWorkers(); }
+
+	// Cria a pasta e as threads de codificação (workers = 0: núcleos - 1)
+	void init(const std::string& captureDirectory, CaptureFormat captureFormat, unsigned workers = 0)
+	{
+		directory = captureDirectory;
+		format = captureFormat;
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		if (error)
+			std::cout << "ERROR::CAPTURE::CANNOT_CREATE_DIRECTORY " << directory << std::endl;
+
+		if (workers == 0)
+		{
+			unsigned cores = std::thread::hardware_concurrency();
+			workers = cores > 1 ? cores - 1 : 1;
+		}
+		workerCount = workers;
+		queueLimit = workers * 2;
+		running = true;
+		for (unsigned i = 0; i < workers; ++i)
+			threads.push_back(std::thread(&FrameCapture::workerLoop, this));
+	}
+
+	bool isEnabled() const { return !threads.empty(); }
+
+	// Agenda a leitura do framebuffer de leitura atual (chamar antes da troca de buffers)
+	// Janela minimizada (framebuffer 0 x 0): nada a ler, o frame é pulado
+	void capture(int width, int height)
+	{
+		if (width <= 0 || height <= 0)
+			return;
+		if (width != slotWidth || height != slotHeight)
+			resize(width, height);
+
+		Slot& slot = slots[next];
+		if (slot.fence)
+			collect(slot);
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid*)0);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		slot.frame = frame++;
+		next = (next + 1) % kCaptureFrames;
+		++stats.frames;
+	}
+
+	// Lê os PBOs pendentes e espera todos os arquivos serem gravados
+	void finish()
+	{
+		for (int i = 0; i < kCaptureFrames; ++i)
+		{
+			Slot& slot = slots[(next + i) % kCaptureFrames];
+			if (slot.fence)
+				collect(slot);
+		}
+		std::unique_lock<std::mutex> lock(mutex);
+		idle.wait(lock, [this]() { return jobs.empty() && busy == 0; });
+	}
+
+	const FrameCaptureStats& getStats() const { return stats; }
+
+	void printStats(std::ostream& out)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		out << "Capture: " << stats.written << " of " << stats.frames << " frames written to " << directory
+			<< " (" << stats.bytes / 1024 << " KB, " << workerCount << " encoder threads)";
+		if (stats.failed)
+			out << ", " << stats.failed << " failed";
+		out << std::endl;
+		out << "  copy " << stats.copyMs << " ms, encode " << stats.encodeMs << " ms (all threads), waited "
+			<< stats.waitMs << " ms (" << stats.readbackStalls << " readback stalls, " << stats.encoderWaits
+			<< " encoder waits)" << std::endl;
+	}
+
+	// Libera os PBOs e encerra as threads (o contexto precisa estar ativo)
+	void release()
+	{
+		finish();
+		stopWorkers();
+		deleteSlots();
+	}
+
+private:
+	struct Slot
+	{
+		GLuint buffer = 0;
+		GLsync fence = 0;
+		int frame = 0;
+	};
+
+	struct Job
+	{
+		std::vector<unsigned char> pixels;
+		int width = 0, height = 0, frame = 0;
+	};
+
+	void resize(int width, int height)
+	{
+		finish();
+		deleteSlots();
+		slotWidth = width;
+		slotHeight = height;
+		for (int i = 0; i < kCaptureFrames; ++i)
+		{
+			glGenBuffers(1, &slots[i].buffer);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, slots[i].buffer);
+			glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)width * height * 4, NULL, GL_STREAM_READ);
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		next = 0;
+	}
+
+	void deleteSlots()
+	{
+		for (int i = 0; i < kCaptureFrames; ++i)
+		{
+			if (slots[i].fence)
+				glDeleteSync(slots[i].fence);
+			if (slots[i].buffer)
+				glDeleteBuffers(1, &slots[i].buffer);
+			slots[i] = Slot();
+		}
+	}
+
+	// Copia o PBO para um buffer da CPU e entrega às threads de codificação
+	void collect(Slot& slot)
+	{
+		auto start = std::chrono::steady_clock::now();
+		if (glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED)
+		{
+			++stats.readbackStalls;
+			while (glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) // 1 ms
+				;
+		}
+		glDeleteSync(slot.fence);
+		slot.fence = 0;
+
+		Job job;
+		job.width = slotWidth;
+		job.height = slotHeight;
+		job.frame = slot.frame;
+		{
+			// Espera se as threads estiverem atrasadas; reaproveita buffers já codificados
+			std::unique_lock<std::mutex> lock(mutex);
+			if (jobs.size() >= queueLimit)
+			{
+				++stats.encoderWaits;
+				space.wait(lock, [this]() { return jobs.size() < queueLimit; });
+			}
+			if (!freeBuffers.empty())
+			{
+				job.pixels.swap(freeBuffers.back());
+				freeBuffers.pop_back();
+			}
+		}
+		auto copyStart = std::chrono::steady_clock::now();
+		stats.waitMs += std::chrono::duration<double, std::milli>(copyStart - start).count();
+
+		size_t size = (size_t)slotWidth * slotHeight * 4;
+		job.pixels.resize(size);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_READ_BIT);
+		if (mapped)
+		{
+			memcpy(job.pixels.data(), mapped, size);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		stats.copyMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - copyStart).count();
+		if (!mapped)
+		{
+			std::cout << "ERROR::CAPTURE::MAP_FAILED frame " << slot.frame << std::endl;
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		jobs.push_back(std::move(job));
+		work.notify_one();
+	}
+
+	void workerLoop()
+	{
+		std::vector<unsigned char> encoded;
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true)
+		{
+			work.wait(lock, [this]() { return !jobs.empty() || !running; });
+			if (jobs.empty())
+				return;
+			Job job = std::move(jobs.front());
+			jobs.pop_front();
+			++busy;
+			space.notify_one();
+			lock.unlock();
+
+			auto start = std::chrono::steady_clock::now();
+			if (format == CAPTURE_PNG)
+				capture_detail::encodePNG(job.pixels.data(), job.width, job.height, encoded);
+			else
+				capture_detail::encodePPM(job.pixels.data(), job.width, job.height, encoded);
+			bool ok = write(job.frame, encoded);
+			double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			lock.lock();
+			stats.encodeMs += ms;
+			if (ok)
+			{
+				++stats.written;
+				stats.bytes += encoded.size();
+			}
+			else
+				++stats.failed;
+			freeBuffers.push_back(std::move(job.pixels));
+			--busy;
+			idle.notify_all();
+		}
+	}
+
+	bool write(int index, const std::vector<unsigned char>& data) const
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "frame_%06d.%s", index, format == CAPTURE_PNG ? "png" : "ppm");
+		std::string path = directory + "/" + name;
+		FILE* file = fopen(path.c_str(), "wb");
+		if (!file)
+		{
+			std::cout << "ERROR::CAPTURE::FILE_NOT_WRITTEN " << path << std::endl;
+			return false;
+		}
+		bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+		fclose(file);
+		return ok;
+	}
+
+	void stopWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			running = false;
+		}
+		work.notify_all();
+		for (size_t i = 0; i < threads.size(); ++i)
+			threads[i].join();
+		threads.clear();
+	}
+
+	std::string directory;
+	CaptureFormat format = CAPTURE_PNG;
+	Slot slots[kCaptureFrames];
+	int slotWidth = 0, slotHeight = 0;
+	int next = 0, frame = 0;
+
+	// Protegidos por mutex
+	std::mutex mutex;
+	std::condition_variable work, space, idle;
+	std::deque<Job> jobs;
+	std::vector<std::vector<unsigned char>> freeBuffers;
+	size_t queueLimit = 2;
+	unsigned busy = 0;
+	bool running = false;
+	FrameCaptureStats stats;
+
+	std::vector<std::thread> threads;
+	unsigned workerCount = 0;
+};
@@ -0,0 +1,171 @@
+// Simulação em passo fixo em uma thread própria, separada do desenho
+//
+// A thread de simulação chama update(estado, t, dt) com dt fixo (por exemplo
+// 1/120 s), independente da taxa de frames; se ela atrasar, executa os passos
+// que faltam (até kMaxCatchUpSteps) antes de publicar. A thread de desenho (a
+// principal, dona do contexto OpenGL) pega a cópia mais recente do estado a cada
+// frame, sem esperar a simulação. Trabalho pesado de CPU no update (animação,
+// geração de geometria) não atrasa a apresentação nem a leitura de eventos.
+//
+// A troca das cópias é feita por SnapshotExchange: três cópias e um índice
+// atômico, sem mutex. O escritor sempre tem uma cópia só sua, o leitor também,
+// e a terceira é a mais recente publicada; publicar e pegar são uma troca
+// atômica do índice. Com duas cópias um dos lados teria que esperar o outro.
+//
+// Uso:
+//   FixedStepSimulation<Estado> sim;
+//   sim.start(120.0, [](Estado& s, double t, double dt) { ... });
+//   while (app.running()) {
+//       const SimSnapshot<Estado>* snapshot = sim.latest();
+//       if (snapshot) ... desenha snapshot->state ...
+//   }
+//   sim.stop();
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+// Troca sem trava do valor mais recente entre um escritor e um leitor
+template <class T>
+class SnapshotExchange
+{
+public:
+	// Cópia do escritor: preencher e chamar publish()
+	T& writeSlot() { return slots[back]; }
+
+	void publish()
+	{
+		unsigned previous = middle.exchange(back | kFresh, std::memory_order_acq_rel);
+		back = previous & kIndexMask;
+	}
+
+	// Cópia mais recente publicada (NULL antes da primeira publicação)
+	// A cópia continua válida até a próxima chamada de latest()
+	const T* latest()
+	{
+		if (middle.load(std::memory_order_relaxed) & kFresh)
+		{
+			unsigned previous = middle.exchange(front, std::memory_order_acq_rel);
+			front = previous & kIndexMask;
+			received = true;
+		}
+		return received ? &slots[front] : NULL;
+	}
+
+private:
+	static const unsigned kFresh = 4, kIndexMask = 3;
+
+	T slots[3];
+	std::atomic<unsigned> middle{ 1 }; // Índice da cópia do meio + flag de novidade
+	unsigned back = 0;                 // Só o escritor usa
+	unsigned front = 2;                // Só o leitor usa
+	bool received = false;
+};
+
+// Estado publicado pela simulação
+template <class State>
+struct SimSnapshot
+{
+	State state;
+	double time = 0.0;            // Tempo da simulação (s)
+	unsigned long long step = 0;  // Passos executados até aqui
+};
+
+struct SimulationStats
+{
+	unsigned long long steps = 0;     // Passos de update executados
+	unsigned long long published = 0; // Cópias publicadas
+	unsigned long long dropped = 0;   // Passos descartados por atraso maior que kMaxCatchUpSteps
+};
+
+template <class State>
+class FixedStepSimulation
+{
+public:
+	typedef std::function<void(State&, double, double)> UpdateFunction;
+
+	// Passos que a simulação recupera de uma vez quando atrasa
+	static const int kMaxCatchUpSteps = 8;
+
+	~FixedStepSimulation() { stop(); }
+
+	// Começa a thread: update roda rate vezes por segundo a partir de initial
+	void start(double rate, UpdateFunction function, const State& initial = State())
+	{
+		stop();
+		update = function;
+		dt = 1.0 / rate;
+		current.state = initial;
+		current.time = 0.0;
+		current.step = 0;
+		running.store(true);
+		worker = std::thread(&FixedStepSimulation::run, this);
+	}
+
+	void stop()
+	{
+		running.store(false);
+		if (worker.joinable())
+			worker.join();
+	}
+
+	// Estado mais recente (NULL até o primeiro passo); só a thread de desenho chama
+	const SimSnapshot<State>* latest() { return exchange.latest(); }
+
+	// Contadores (leia depois de stop())
+	const SimulationStats& getStats() const { return stats; }
+
+	void printStats(std::ostream& out) const
+	{
+		out << "Simulation: " << stats.steps << " steps at " << 1.0 / dt << " Hz, " << stats.published
+			<< " snapshots published, " << stats.dropped << " steps dropped" << std::endl;
+	}
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	void run()
+	{
+		auto step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(dt));
+		Clock::time_point next = Clock::now();
+		while (running.load())
+		{
+			Clock::time_point now = Clock::now();
+			int steps = 0;
+			while (now >= next && steps < kMaxCatchUpSteps)
+			{
+				update(current.state, current.time, dt);
+				current.time += dt;
+				++current.step;
+				++stats.steps;
+				next += step;
+				++steps;
+			}
+			if (now >= next)
+			{
+				// Atraso grande (depurador, máquina ocupada): descarta em vez de acumular
+				stats.dropped += (unsigned long long)((now - next) / step) + 1;
+				next = now + step;
+			}
+			if (steps > 0)
+			{
+				exchange.writeSlot() = current;
+				exchange.publish();
+				++stats.published;
+			}
+			std::this_thread::sleep_until(next);
+		}
+	}
+
+	UpdateFunction update;
+	double dt = 1.0 / 60.0;
+	SimSnapshot<State> current;       // Só a thread de simulação usa
+	SnapshotExchange<SimSnapshot<State>> exchange;
+	std::atomic<bool> running{ false };
+	std::thread worker;
+	SimulationStats stats;
+};
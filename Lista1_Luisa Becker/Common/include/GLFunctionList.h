@@ -0,0 +1,804 @@
+// Funções da OpenGL 4.0 (perfil de compatibilidade) carregadas pela GLAD do
+// projeto, na mesma ordem de Dependencies/GLAD/src/glad.c
+//
+// Lista para X-macro: defina GL_FUNCTION(nome) antes de incluir. Gerada a partir
+// das chamadas load("gl...") das funções load_GL_VERSION_* do glad.c; gere de
+// novo se a GLAD for trocada.
+//
+// Sem #pragma once: o arquivo é incluído uma vez para cada uso da lista.
+
+// OpenGL 1.0
+GL_FUNCTION(glCullFace)
+GL_FUNCTION(glFrontFace)
+GL_FUNCTION(glHint)
+GL_FUNCTION(glLineWidth)
+GL_FUNCTION(glPointSize)
+GL_FUNCTION(glPolygonMode)
+GL_FUNCTION(glScissor)
+GL_FUNCTION(glTexParameterf)
+GL_FUNCTION(glTexParameterfv)
+GL_FUNCTION(glTexParameteri)
+GL_FUNCTION(glTexParameteriv)
+GL_FUNCTION(glTexImage1D)
+GL_FUNCTION(glTexImage2D)
+GL_FUNCTION(glDrawBuffer)
+GL_FUNCTION(glClear)
+GL_FUNCTION(glClearColor)
+GL_FUNCTION(glClearStencil)
+GL_FUNCTION(glClearDepth)
+GL_FUNCTION(glStencilMask)
+GL_FUNCTION(glColorMask)
+GL_FUNCTION(glDepthMask)
+GL_FUNCTION(glDisable)
+GL_FUNCTION(glEnable)
+GL_FUNCTION(glFinish)
+GL_FUNCTION(glFlush)
+GL_FUNCTION(glBlendFunc)
+GL_FUNCTION(glLogicOp)
+GL_FUNCTION(glStencilFunc)
+GL_FUNCTION(glStencilOp)
+GL_FUNCTION(glDepthFunc)
+GL_FUNCTION(glPixelStoref)
+GL_FUNCTION(glPixelStorei)
+GL_FUNCTION(glReadBuffer)
+GL_FUNCTION(glReadPixels)
+GL_FUNCTION(glGetBooleanv)
+GL_FUNCTION(glGetDoublev)
+GL_FUNCTION(glGetError)
+GL_FUNCTION(glGetFloatv)
+GL_FUNCTION(glGetIntegerv)
+GL_FUNCTION(glGetString)
+GL_FUNCTION(glGetTexImage)
+GL_FUNCTION(glGetTexParameterfv)
+GL_FUNCTION(glGetTexParameteriv)
+GL_FUNCTION(glGetTexLevelParameterfv)
+GL_FUNCTION(glGetTexLevelParameteriv)
+GL_FUNCTION(glIsEnabled)
+GL_FUNCTION(glDepthRange)
+GL_FUNCTION(glViewport)
+GL_FUNCTION(glNewList)
+GL_FUNCTION(glEndList)
+GL_FUNCTION(glCallList)
+GL_FUNCTION(glCallLists)
+GL_FUNCTION(glDeleteLists)
+GL_FUNCTION(glGenLists)
+GL_FUNCTION(glListBase)
+GL_FUNCTION(glBegin)
+GL_FUNCTION(glBitmap)
+GL_FUNCTION(glColor3b)
+GL_FUNCTION(glColor3bv)
+GL_FUNCTION(glColor3d)
+GL_FUNCTION(glColor3dv)
+GL_FUNCTION(glColor3f)
+GL_FUNCTION(glColor3fv)
+GL_FUNCTION(glColor3i)
+GL_FUNCTION(glColor3iv)
+GL_FUNCTION(glColor3s)
+GL_FUNCTION(glColor3sv)
+GL_FUNCTION(glColor3ub)
+GL_FUNCTION(glColor3ubv)
+GL_FUNCTION(glColor3ui)
+GL_FUNCTION(glColor3uiv)
+GL_FUNCTION(glColor3us)
+GL_FUNCTION(glColor3usv)
+GL_FUNCTION(glColor4b)
+GL_FUNCTION(glColor4bv)
+GL_FUNCTION(glColor4d)
+GL_FUNCTION(glColor4dv)
+GL_FUNCTION(glColor4f)
+GL_FUNCTION(glColor4fv)
+GL_FUNCTION(glColor4i)
+GL_FUNCTION(glColor4iv)
+GL_FUNCTION(glColor4s)
+GL_FUNCTION(glColor4sv)
+GL_FUNCTION(glColor4ub)
+GL_FUNCTION(glColor4ubv)
+GL_FUNCTION(glColor4ui)
+GL_FUNCTION(glColor4uiv)
+GL_FUNCTION(glColor4us)
+GL_FUNCTION(glColor4usv)
+GL_FUNCTION(glEdgeFlag)
+GL_FUNCTION(glEdgeFlagv)
+GL_FUNCTION(glEnd)
+GL_FUNCTION(glIndexd)
+GL_FUNCTION(glIndexdv)
+GL_FUNCTION(glIndexf)
+GL_FUNCTION(glIndexfv)
+GL_FUNCTION(glIndexi)
+GL_FUNCTION(glIndexiv)
+GL_FUNCTION(glIndexs)
+GL_FUNCTION(glIndexsv)
+GL_FUNCTION(glNormal3b)
+GL_FUNCTION(glNormal3bv)
+GL_FUNCTION(glNormal3d)
+GL_FUNCTION(glNormal3dv)
+GL_FUNCTION(glNormal3f)
+GL_FUNCTION(glNormal3fv)
+GL_FUNCTION(glNormal3i)
+GL_FUNCTION(glNormal3iv)
+GL_FUNCTION(glNormal3s)
+GL_FUNCTION(glNormal3sv)
+GL_FUNCTION(glRasterPos2d)
+GL_FUNCTION(glRasterPos2dv)
+GL_FUNCTION(glRasterPos2f)
+GL_FUNCTION(glRasterPos2fv)
+GL_FUNCTION(glRasterPos2i)
+GL_FUNCTION(glRasterPos2iv)
+GL_FUNCTION(glRasterPos2s)
+GL_FUNCTION(glRasterPos2sv)
+GL_FUNCTION(glRasterPos3d)
+GL_FUNCTION(glRasterPos3dv)
+GL_FUNCTION(glRasterPos3f)
+GL_FUNCTION(glRasterPos3fv)
+GL_FUNCTION(glRasterPos3i)
+GL_FUNCTION(glRasterPos3iv)
+GL_FUNCTION(glRasterPos3s)
+GL_FUNCTION(glRasterPos3sv)
+GL_FUNCTION(glRasterPos4d)
+GL_FUNCTION(glRasterPos4dv)
+GL_FUNCTION(glRasterPos4f)
+GL_FUNCTION(glRasterPos4fv)
+GL_FUNCTION(glRasterPos4i)
+GL_FUNCTION(glRasterPos4iv)
+GL_FUNCTION(glRasterPos4s)
+GL_FUNCTION(glRasterPos4sv)
+GL_FUNCTION(glRectd)
+GL_FUNCTION(glRectdv)
+GL_FUNCTION(glRectf)
+GL_FUNCTION(glRectfv)
+GL_FUNCTION(glRecti)
+GL_FUNCTION(glRectiv)
+GL_FUNCTION(glRects)
+GL_FUNCTION(glRectsv)
+GL_FUNCTION(glTexCoord1d)
+GL_FUNCTION(glTexCoord1dv)
+GL_FUNCTION(glTexCoord1f)
+GL_FUNCTION(glTexCoord1fv)
+GL_FUNCTION(glTexCoord1i)
+GL_FUNCTION(glTexCoord1iv)
+GL_FUNCTION(glTexCoord1s)
+GL_FUNCTION(glTexCoord1sv)
+GL_FUNCTION(glTexCoord2d)
+GL_FUNCTION(glTexCoord2dv)
+GL_FUNCTION(glTexCoord2f)
+GL_FUNCTION(glTexCoord2fv)
+GL_FUNCTION(glTexCoord2i)
+GL_FUNCTION(glTexCoord2iv)
+GL_FUNCTION(glTexCoord2s)
+GL_FUNCTION(glTexCoord2sv)
+GL_FUNCTION(glTexCoord3d)
+GL_FUNCTION(glTexCoord3dv)
+GL_FUNCTION(glTexCoord3f)
+GL_FUNCTION(glTexCoord3fv)
+GL_FUNCTION(glTexCoord3i)
+GL_FUNCTION(glTexCoord3iv)
+GL_FUNCTION(glTexCoord3s)
+GL_FUNCTION(glTexCoord3sv)
+GL_FUNCTION(glTexCoord4d)
+GL_FUNCTION(glTexCoord4dv)
+GL_FUNCTION(glTexCoord4f)
+GL_FUNCTION(glTexCoord4fv)
+GL_FUNCTION(glTexCoord4i)
+GL_FUNCTION(glTexCoord4iv)
+GL_FUNCTION(glTexCoord4s)
+GL_FUNCTION(glTexCoord4sv)
+GL_FUNCTION(glVertex2d)
+GL_FUNCTION(glVertex2dv)
+GL_FUNCTION(glVertex2f)
+GL_FUNCTION(glVertex2fv)
+GL_FUNCTION(glVertex2i)
+GL_FUNCTION(glVertex2iv)
+GL_FUNCTION(glVertex2s)
+GL_FUNCTION(glVertex2sv)
+GL_FUNCTION(glVertex3d)
+GL_FUNCTION(glVertex3dv)
+GL_FUNCTION(glVertex3f)
+GL_FUNCTION(glVertex3fv)
+GL_FUNCTION(glVertex3i)
+GL_FUNCTION(glVertex3iv)
+GL_FUNCTION(glVertex3s)
+GL_FUNCTION(glVertex3sv)
+GL_FUNCTION(glVertex4d)
+GL_FUNCTION(glVertex4dv)
+GL_FUNCTION(glVertex4f)
+GL_FUNCTION(glVertex4fv)
+GL_FUNCTION(glVertex4i)
+GL_FUNCTION(glVertex4iv)
+GL_FUNCTION(glVertex4s)
+GL_FUNCTION(glVertex4sv)
+GL_FUNCTION(glClipPlane)
+GL_FUNCTION(glColorMaterial)
+GL_FUNCTION(glFogf)
+GL_FUNCTION(glFogfv)
+GL_FUNCTION(glFogi)
+GL_FUNCTION(glFogiv)
+GL_FUNCTION(glLightf)
+GL_FUNCTION(glLightfv)
+GL_FUNCTION(glLighti)
+GL_FUNCTION(glLightiv)
+GL_FUNCTION(glLightModelf)
+GL_FUNCTION(glLightModelfv)
+GL_FUNCTION(glLightModeli)
+GL_FUNCTION(glLightModeliv)
+GL_FUNCTION(glLineStipple)
+GL_FUNCTION(glMaterialf)
+GL_FUNCTION(glMaterialfv)
+GL_FUNCTION(glMateriali)
+GL_FUNCTION(glMaterialiv)
+GL_FUNCTION(glPolygonStipple)
+GL_FUNCTION(glShadeModel)
+GL_FUNCTION(glTexEnvf)
+GL_FUNCTION(glTexEnvfv)
+GL_FUNCTION(glTexEnvi)
+GL_FUNCTION(glTexEnviv)
+GL_FUNCTION(glTexGend)
+GL_FUNCTION(glTexGendv)
+GL_FUNCTION(glTexGenf)
+GL_FUNCTION(glTexGenfv)
+GL_FUNCTION(glTexGeni)
+GL_FUNCTION(glTexGeniv)
+GL_FUNCTION(glFeedbackBuffer)
+GL_FUNCTION(glSelectBuffer)
+GL_FUNCTION(glRenderMode)
+GL_FUNCTION(glInitNames)
+GL_FUNCTION(glLoadName)
+GL_FUNCTION(glPassThrough)
+GL_FUNCTION(glPopName)
+GL_FUNCTION(glPushName)
+GL_FUNCTION(glClearAccum)
+GL_FUNCTION(glClearIndex)
+GL_FUNCTION(glIndexMask)
+GL_FUNCTION(glAccum)
+GL_FUNCTION(glPopAttrib)
+GL_FUNCTION(glPushAttrib)
+GL_FUNCTION(glMap1d)
+GL_FUNCTION(glMap1f)
+GL_FUNCTION(glMap2d)
+GL_FUNCTION(glMap2f)
+GL_FUNCTION(glMapGrid1d)
+GL_FUNCTION(glMapGrid1f)
+GL_FUNCTION(glMapGrid2d)
+GL_FUNCTION(glMapGrid2f)
+GL_FUNCTION(glEvalCoord1d)
+GL_FUNCTION(glEvalCoord1dv)
+GL_FUNCTION(glEvalCoord1f)
+GL_FUNCTION(glEvalCoord1fv)
+GL_FUNCTION(glEvalCoord2d)
+GL_FUNCTION(glEvalCoord2dv)
+GL_FUNCTION(glEvalCoord2f)
+GL_FUNCTION(glEvalCoord2fv)
+GL_FUNCTION(glEvalMesh1)
+GL_FUNCTION(glEvalPoint1)
+GL_FUNCTION(glEvalMesh2)
+GL_FUNCTION(glEvalPoint2)
+GL_FUNCTION(glAlphaFunc)
+GL_FUNCTION(glPixelZoom)
+GL_FUNCTION(glPixelTransferf)
+GL_FUNCTION(glPixelTransferi)
+GL_FUNCTION(glPixelMapfv)
+GL_FUNCTION(glPixelMapuiv)
+GL_FUNCTION(glPixelMapusv)
+GL_FUNCTION(glCopyPixels)
+GL_FUNCTION(glDrawPixels)
+GL_FUNCTION(glGetClipPlane)
+GL_FUNCTION(glGetLightfv)
+GL_FUNCTION(glGetLightiv)
+GL_FUNCTION(glGetMapdv)
+GL_FUNCTION(glGetMapfv)
+GL_FUNCTION(glGetMapiv)
+GL_FUNCTION(glGetMaterialfv)
+GL_FUNCTION(glGetMaterialiv)
+GL_FUNCTION(glGetPixelMapfv)
+GL_FUNCTION(glGetPixelMapuiv)
+GL_FUNCTION(glGetPixelMapusv)
+GL_FUNCTION(glGetPolygonStipple)
+GL_FUNCTION(glGetTexEnvfv)
+GL_FUNCTION(glGetTexEnviv)
+GL_FUNCTION(glGetTexGendv)
+GL_FUNCTION(glGetTexGenfv)
+GL_FUNCTION(glGetTexGeniv)
+GL_FUNCTION(glIsList)
+GL_FUNCTION(glFrustum)
+GL_FUNCTION(glLoadIdentity)
+GL_FUNCTION(glLoadMatrixf)
+GL_FUNCTION(glLoadMatrixd)
+GL_FUNCTION(glMatrixMode)
+GL_FUNCTION(glMultMatrixf)
+GL_FUNCTION(glMultMatrixd)
+GL_FUNCTION(glOrtho)
+GL_FUNCTION(glPopMatrix)
+GL_FUNCTION(glPushMatrix)
+GL_FUNCTION(glRotated)
+GL_FUNCTION(glRotatef)
+GL_FUNCTION(glScaled)
+GL_FUNCTION(glScalef)
+GL_FUNCTION(glTranslated)
+GL_FUNCTION(glTranslatef)
+
+// OpenGL 1.1
+GL_FUNCTION(glDrawArrays)
+GL_FUNCTION(glDrawElements)
+GL_FUNCTION(glGetPointerv)
+GL_FUNCTION(glPolygonOffset)
+GL_FUNCTION(glCopyTexImage1D)
+GL_FUNCTION(glCopyTexImage2D)
+GL_FUNCTION(glCopyTexSubImage1D)
+GL_FUNCTION(glCopyTexSubImage2D)
+GL_FUNCTION(glTexSubImage1D)
+GL_FUNCTION(glTexSubImage2D)
+GL_FUNCTION(glBindTexture)
+GL_FUNCTION(glDeleteTextures)
+GL_FUNCTION(glGenTextures)
+GL_FUNCTION(glIsTexture)
+GL_FUNCTION(glArrayElement)
+GL_FUNCTION(glColorPointer)
+GL_FUNCTION(glDisableClientState)
+GL_FUNCTION(glEdgeFlagPointer)
+GL_FUNCTION(glEnableClientState)
+GL_FUNCTION(glIndexPointer)
+GL_FUNCTION(glInterleavedArrays)
+GL_FUNCTION(glNormalPointer)
+GL_FUNCTION(glTexCoordPointer)
+GL_FUNCTION(glVertexPointer)
+GL_FUNCTION(glAreTexturesResident)
+GL_FUNCTION(glPrioritizeTextures)
+GL_FUNCTION(glIndexub)
+GL_FUNCTION(glIndexubv)
+GL_FUNCTION(glPopClientAttrib)
+GL_FUNCTION(glPushClientAttrib)
+
+// OpenGL 1.2
+GL_FUNCTION(glDrawRangeElements)
+GL_FUNCTION(glTexImage3D)
+GL_FUNCTION(glTexSubImage3D)
+GL_FUNCTION(glCopyTexSubImage3D)
+
+// OpenGL 1.3
+GL_FUNCTION(glActiveTexture)
+GL_FUNCTION(glSampleCoverage)
+GL_FUNCTION(glCompressedTexImage3D)
+GL_FUNCTION(glCompressedTexImage2D)
+GL_FUNCTION(glCompressedTexImage1D)
+GL_FUNCTION(glCompressedTexSubImage3D)
+GL_FUNCTION(glCompressedTexSubImage2D)
+GL_FUNCTION(glCompressedTexSubImage1D)
+GL_FUNCTION(glGetCompressedTexImage)
+GL_FUNCTION(glClientActiveTexture)
+GL_FUNCTION(glMultiTexCoord1d)
+GL_FUNCTION(glMultiTexCoord1dv)
+GL_FUNCTION(glMultiTexCoord1f)
+GL_FUNCTION(glMultiTexCoord1fv)
+GL_FUNCTION(glMultiTexCoord1i)
+GL_FUNCTION(glMultiTexCoord1iv)
+GL_FUNCTION(glMultiTexCoord1s)
+GL_FUNCTION(glMultiTexCoord1sv)
+GL_FUNCTION(glMultiTexCoord2d)
+GL_FUNCTION(glMultiTexCoord2dv)
+GL_FUNCTION(glMultiTexCoord2f)
+GL_FUNCTION(glMultiTexCoord2fv)
+GL_FUNCTION(glMultiTexCoord2i)
+GL_FUNCTION(glMultiTexCoord2iv)
+GL_FUNCTION(glMultiTexCoord2s)
+GL_FUNCTION(glMultiTexCoord2sv)
+GL_FUNCTION(glMultiTexCoord3d)
+GL_FUNCTION(glMultiTexCoord3dv)
+GL_FUNCTION(glMultiTexCoord3f)
+GL_FUNCTION(glMultiTexCoord3fv)
+GL_FUNCTION(glMultiTexCoord3i)
+GL_FUNCTION(glMultiTexCoord3iv)
+GL_FUNCTION(glMultiTexCoord3s)
+GL_FUNCTION(glMultiTexCoord3sv)
+GL_FUNCTION(glMultiTexCoord4d)
+GL_FUNCTION(glMultiTexCoord4dv)
+GL_FUNCTION(glMultiTexCoord4f)
+GL_FUNCTION(glMultiTexCoord4fv)
+GL_FUNCTION(glMultiTexCoord4i)
+GL_FUNCTION(glMultiTexCoord4iv)
+GL_FUNCTION(glMultiTexCoord4s)
+GL_FUNCTION(glMultiTexCoord4sv)
+GL_FUNCTION(glLoadTransposeMatrixf)
+GL_FUNCTION(glLoadTransposeMatrixd)
+GL_FUNCTION(glMultTransposeMatrixf)
+GL_FUNCTION(glMultTransposeMatrixd)
+
+// OpenGL 1.4
+GL_FUNCTION(glBlendFuncSeparate)
+GL_FUNCTION(glMultiDrawArrays)
+GL_FUNCTION(glMultiDrawElements)
+GL_FUNCTION(glPointParameterf)
+GL_FUNCTION(glPointParameterfv)
+GL_FUNCTION(glPointParameteri)
+GL_FUNCTION(glPointParameteriv)
+GL_FUNCTION(glFogCoordf)
+GL_FUNCTION(glFogCoordfv)
+GL_FUNCTION(glFogCoordd)
+GL_FUNCTION(glFogCoorddv)
+GL_FUNCTION(glFogCoordPointer)
+GL_FUNCTION(glSecondaryColor3b)
+GL_FUNCTION(glSecondaryColor3bv)
+GL_FUNCTION(glSecondaryColor3d)
+GL_FUNCTION(glSecondaryColor3dv)
+GL_FUNCTION(glSecondaryColor3f)
+GL_FUNCTION(glSecondaryColor3fv)
+GL_FUNCTION(glSecondaryColor3i)
+GL_FUNCTION(glSecondaryColor3iv)
+GL_FUNCTION(glSecondaryColor3s)
+GL_FUNCTION(glSecondaryColor3sv)
+GL_FUNCTION(glSecondaryColor3ub)
+GL_FUNCTION(glSecondaryColor3ubv)
+GL_FUNCTION(glSecondaryColor3ui)
+GL_FUNCTION(glSecondaryColor3uiv)
+GL_FUNCTION(glSecondaryColor3us)
+GL_FUNCTION(glSecondaryColor3usv)
+GL_FUNCTION(glSecondaryColorPointer)
+GL_FUNCTION(glWindowPos2d)
+GL_FUNCTION(glWindowPos2dv)
+GL_FUNCTION(glWindowPos2f)
+GL_FUNCTION(glWindowPos2fv)
+GL_FUNCTION(glWindowPos2i)
+GL_FUNCTION(glWindowPos2iv)
+GL_FUNCTION(glWindowPos2s)
+GL_FUNCTION(glWindowPos2sv)
+GL_FUNCTION(glWindowPos3d)
+GL_FUNCTION(glWindowPos3dv)
+GL_FUNCTION(glWindowPos3f)
+GL_FUNCTION(glWindowPos3fv)
+GL_FUNCTION(glWindowPos3i)
+GL_FUNCTION(glWindowPos3iv)
+GL_FUNCTION(glWindowPos3s)
+GL_FUNCTION(glWindowPos3sv)
+GL_FUNCTION(glBlendColor)
+GL_FUNCTION(glBlendEquation)
+
+// OpenGL 1.5
+GL_FUNCTION(glGenQueries)
+GL_FUNCTION(glDeleteQueries)
+GL_FUNCTION(glIsQuery)
+GL_FUNCTION(glBeginQuery)
+GL_FUNCTION(glEndQuery)
+GL_FUNCTION(glGetQueryiv)
+GL_FUNCTION(glGetQueryObjectiv)
+GL_FUNCTION(glGetQueryObjectuiv)
+GL_FUNCTION(glBindBuffer)
+GL_FUNCTION(glDeleteBuffers)
+GL_FUNCTION(glGenBuffers)
+GL_FUNCTION(glIsBuffer)
+GL_FUNCTION(glBufferData)
+GL_FUNCTION(glBufferSubData)
+GL_FUNCTION(glGetBufferSubData)
+GL_FUNCTION(glMapBuffer)
+GL_FUNCTION(glUnmapBuffer)
+GL_FUNCTION(glGetBufferParameteriv)
+GL_FUNCTION(glGetBufferPointerv)
+
+// OpenGL 2.0
+GL_FUNCTION(glBlendEquationSeparate)
+GL_FUNCTION(glDrawBuffers)
+GL_FUNCTION(glStencilOpSeparate)
+GL_FUNCTION(glStencilFuncSeparate)
+GL_FUNCTION(glStencilMaskSeparate)
+GL_FUNCTION(glAttachShader)
+GL_FUNCTION(glBindAttribLocation)
+GL_FUNCTION(glCompileShader)
+GL_FUNCTION(glCreateProgram)
+GL_FUNCTION(glCreateShader)
+GL_FUNCTION(glDeleteProgram)
+GL_FUNCTION(glDeleteShader)
+GL_FUNCTION(glDetachShader)
+GL_FUNCTION(glDisableVertexAttribArray)
+GL_FUNCTION(glEnableVertexAttribArray)
+GL_FUNCTION(glGetActiveAttrib)
+GL_FUNCTION(glGetActiveUniform)
+GL_FUNCTION(glGetAttachedShaders)
+GL_FUNCTION(glGetAttribLocation)
+GL_FUNCTION(glGetProgramiv)
+GL_FUNCTION(glGetProgramInfoLog)
+GL_FUNCTION(glGetShaderiv)
+GL_FUNCTION(glGetShaderInfoLog)
+GL_FUNCTION(glGetShaderSource)
+GL_FUNCTION(glGetUniformLocation)
+GL_FUNCTION(glGetUniformfv)
+GL_FUNCTION(glGetUniformiv)
+GL_FUNCTION(glGetVertexAttribdv)
+GL_FUNCTION(glGetVertexAttribfv)
+GL_FUNCTION(glGetVertexAttribiv)
+GL_FUNCTION(glGetVertexAttribPointerv)
+GL_FUNCTION(glIsProgram)
+GL_FUNCTION(glIsShader)
+GL_FUNCTION(glLinkProgram)
+GL_FUNCTION(glShaderSource)
+GL_FUNCTION(glUseProgram)
+GL_FUNCTION(glUniform1f)
+GL_FUNCTION(glUniform2f)
+GL_FUNCTION(glUniform3f)
+GL_FUNCTION(glUniform4f)
+GL_FUNCTION(glUniform1i)
+GL_FUNCTION(glUniform2i)
+GL_FUNCTION(glUniform3i)
+GL_FUNCTION(glUniform4i)
+GL_FUNCTION(glUniform1fv)
+GL_FUNCTION(glUniform2fv)
+GL_FUNCTION(glUniform3fv)
+GL_FUNCTION(glUniform4fv)
+GL_FUNCTION(glUniform1iv)
+GL_FUNCTION(glUniform2iv)
+GL_FUNCTION(glUniform3iv)
+GL_FUNCTION(glUniform4iv)
+GL_FUNCTION(glUniformMatrix2fv)
+GL_FUNCTION(glUniformMatrix3fv)
+GL_FUNCTION(glUniformMatrix4fv)
+GL_FUNCTION(glValidateProgram)
+GL_FUNCTION(glVertexAttrib1d)
+GL_FUNCTION(glVertexAttrib1dv)
+GL_FUNCTION(glVertexAttrib1f)
+GL_FUNCTION(glVertexAttrib1fv)
+GL_FUNCTION(glVertexAttrib1s)
+GL_FUNCTION(glVertexAttrib1sv)
+GL_FUNCTION(glVertexAttrib2d)
+GL_FUNCTION(glVertexAttrib2dv)
+GL_FUNCTION(glVertexAttrib2f)
+GL_FUNCTION(glVertexAttrib2fv)
+GL_FUNCTION(glVertexAttrib2s)
+GL_FUNCTION(glVertexAttrib2sv)
+GL_FUNCTION(glVertexAttrib3d)
+GL_FUNCTION(glVertexAttrib3dv)
+GL_FUNCTION(glVertexAttrib3f)
+GL_FUNCTION(glVertexAttrib3fv)
+GL_FUNCTION(glVertexAttrib3s)
+GL_FUNCTION(glVertexAttrib3sv)
+GL_FUNCTION(glVertexAttrib4Nbv)
+GL_FUNCTION(glVertexAttrib4Niv)
+GL_FUNCTION(glVertexAttrib4Nsv)
+GL_FUNCTION(glVertexAttrib4Nub)
+GL_FUNCTION(glVertexAttrib4Nubv)
+GL_FUNCTION(glVertexAttrib4Nuiv)
+GL_FUNCTION(glVertexAttrib4Nusv)
+GL_FUNCTION(glVertexAttrib4bv)
+GL_FUNCTION(glVertexAttrib4d)
+GL_FUNCTION(glVertexAttrib4dv)
+GL_FUNCTION(glVertexAttrib4f)
+GL_FUNCTION(glVertexAttrib4fv)
+GL_FUNCTION(glVertexAttrib4iv)
+GL_FUNCTION(glVertexAttrib4s)
+GL_FUNCTION(glVertexAttrib4sv)
+GL_FUNCTION(glVertexAttrib4ubv)
+GL_FUNCTION(glVertexAttrib4uiv)
+GL_FUNCTION(glVertexAttrib4usv)
+GL_FUNCTION(glVertexAttribPointer)
+
+// OpenGL 2.1
+GL_FUNCTION(glUniformMatrix2x3fv)
+GL_FUNCTION(glUniformMatrix3x2fv)
+GL_FUNCTION(glUniformMatrix2x4fv)
+GL_FUNCTION(glUniformMatrix4x2fv)
+GL_FUNCTION(glUniformMatrix3x4fv)
+GL_FUNCTION(glUniformMatrix4x3fv)
+
+// OpenGL 3.0
+GL_FUNCTION(glColorMaski)
+GL_FUNCTION(glGetBooleani_v)
+GL_FUNCTION(glGetIntegeri_v)
+GL_FUNCTION(glEnablei)
+GL_FUNCTION(glDisablei)
+GL_FUNCTION(glIsEnabledi)
+GL_FUNCTION(glBeginTransformFeedback)
+GL_FUNCTION(glEndTransformFeedback)
+GL_FUNCTION(glBindBufferRange)
+GL_FUNCTION(glBindBufferBase)
+GL_FUNCTION(glTransformFeedbackVaryings)
+GL_FUNCTION(glGetTransformFeedbackVarying)
+GL_FUNCTION(glClampColor)
+GL_FUNCTION(glBeginConditionalRender)
+GL_FUNCTION(glEndConditionalRender)
+GL_FUNCTION(glVertexAttribIPointer)
+GL_FUNCTION(glGetVertexAttribIiv)
+GL_FUNCTION(glGetVertexAttribIuiv)
+GL_FUNCTION(glVertexAttribI1i)
+GL_FUNCTION(glVertexAttribI2i)
+GL_FUNCTION(glVertexAttribI3i)
+GL_FUNCTION(glVertexAttribI4i)
+GL_FUNCTION(glVertexAttribI1ui)
+GL_FUNCTION(glVertexAttribI2ui)
+GL_FUNCTION(glVertexAttribI3ui)
+GL_FUNCTION(glVertexAttribI4ui)
+GL_FUNCTION(glVertexAttribI1iv)
+GL_FUNCTION(glVertexAttribI2iv)
+GL_FUNCTION(glVertexAttribI3iv)
+GL_FUNCTION(glVertexAttribI4iv)
+GL_FUNCTION(glVertexAttribI1uiv)
+GL_FUNCTION(glVertexAttribI2uiv)
+GL_FUNCTION(glVertexAttribI3uiv)
+GL_FUNCTION(glVertexAttribI4uiv)
+GL_FUNCTION(glVertexAttribI4bv)
+GL_FUNCTION(glVertexAttribI4sv)
+GL_FUNCTION(glVertexAttribI4ubv)
+GL_FUNCTION(glVertexAttribI4usv)
+GL_FUNCTION(glGetUniformuiv)
+GL_FUNCTION(glBindFragDataLocation)
+GL_FUNCTION(glGetFragDataLocation)
+GL_FUNCTION(glUniform1ui)
+GL_FUNCTION(glUniform2ui)
+GL_FUNCTION(glUniform3ui)
+GL_FUNCTION(glUniform4ui)
+GL_FUNCTION(glUniform1uiv)
+GL_FUNCTION(glUniform2uiv)
+GL_FUNCTION(glUniform3uiv)
+GL_FUNCTION(glUniform4uiv)
+GL_FUNCTION(glTexParameterIiv)
+GL_FUNCTION(glTexParameterIuiv)
+GL_FUNCTION(glGetTexParameterIiv)
+GL_FUNCTION(glGetTexParameterIuiv)
+GL_FUNCTION(glClearBufferiv)
+GL_FUNCTION(glClearBufferuiv)
+GL_FUNCTION(glClearBufferfv)
+GL_FUNCTION(glClearBufferfi)
+GL_FUNCTION(glGetStringi)
+GL_FUNCTION(glIsRenderbuffer)
+GL_FUNCTION(glBindRenderbuffer)
+GL_FUNCTION(glDeleteRenderbuffers)
+GL_FUNCTION(glGenRenderbuffers)
+GL_FUNCTION(glRenderbufferStorage)
+GL_FUNCTION(glGetRenderbufferParameteriv)
+GL_FUNCTION(glIsFramebuffer)
+GL_FUNCTION(glBindFramebuffer)
+GL_FUNCTION(glDeleteFramebuffers)
+GL_FUNCTION(glGenFramebuffers)
+GL_FUNCTION(glCheckFramebufferStatus)
+GL_FUNCTION(glFramebufferTexture1D)
+GL_FUNCTION(glFramebufferTexture2D)
+GL_FUNCTION(glFramebufferTexture3D)
+GL_FUNCTION(glFramebufferRenderbuffer)
+GL_FUNCTION(glGetFramebufferAttachmentParameteriv)
+GL_FUNCTION(glGenerateMipmap)
+GL_FUNCTION(glBlitFramebuffer)
+GL_FUNCTION(glRenderbufferStorageMultisample)
+GL_FUNCTION(glFramebufferTextureLayer)
+GL_FUNCTION(glMapBufferRange)
+GL_FUNCTION(glFlushMappedBufferRange)
+GL_FUNCTION(glBindVertexArray)
+GL_FUNCTION(glDeleteVertexArrays)
+GL_FUNCTION(glGenVertexArrays)
+GL_FUNCTION(glIsVertexArray)
+
+// OpenGL 3.1
+GL_FUNCTION(glDrawArraysInstanced)
+GL_FUNCTION(glDrawElementsInstanced)
+GL_FUNCTION(glTexBuffer)
+GL_FUNCTION(glPrimitiveRestartIndex)
+GL_FUNCTION(glCopyBufferSubData)
+GL_FUNCTION(glGetUniformIndices)
+GL_FUNCTION(glGetActiveUniformsiv)
+GL_FUNCTION(glGetActiveUniformName)
+GL_FUNCTION(glGetUniformBlockIndex)
+GL_FUNCTION(glGetActiveUniformBlockiv)
+GL_FUNCTION(glGetActiveUniformBlockName)
+GL_FUNCTION(glUniformBlockBinding)
+
+// OpenGL 3.2
+GL_FUNCTION(glDrawElementsBaseVertex)
+GL_FUNCTION(glDrawRangeElementsBaseVertex)
+GL_FUNCTION(glDrawElementsInstancedBaseVertex)
+GL_FUNCTION(glMultiDrawElementsBaseVertex)
+GL_FUNCTION(glProvokingVertex)
+GL_FUNCTION(glFenceSync)
+GL_FUNCTION(glIsSync)
+GL_FUNCTION(glDeleteSync)
+GL_FUNCTION(glClientWaitSync)
+GL_FUNCTION(glWaitSync)
+GL_FUNCTION(glGetInteger64v)
+GL_FUNCTION(glGetSynciv)
+GL_FUNCTION(glGetInteger64i_v)
+GL_FUNCTION(glGetBufferParameteri64v)
+GL_FUNCTION(glFramebufferTexture)
+GL_FUNCTION(glTexImage2DMultisample)
+GL_FUNCTION(glTexImage3DMultisample)
+GL_FUNCTION(glGetMultisamplefv)
+GL_FUNCTION(glSampleMaski)
+
+// OpenGL 3.3
+GL_FUNCTION(glBindFragDataLocationIndexed)
+GL_FUNCTION(glGetFragDataIndex)
+GL_FUNCTION(glGenSamplers)
+GL_FUNCTION(glDeleteSamplers)
+GL_FUNCTION(glIsSampler)
+GL_FUNCTION(glBindSampler)
+GL_FUNCTION(glSamplerParameteri)
+GL_FUNCTION(glSamplerParameteriv)
+GL_FUNCTION(glSamplerParameterf)
+GL_FUNCTION(glSamplerParameterfv)
+GL_FUNCTION(glSamplerParameterIiv)
+GL_FUNCTION(glSamplerParameterIuiv)
+GL_FUNCTION(glGetSamplerParameteriv)
+GL_FUNCTION(glGetSamplerParameterIiv)
+GL_FUNCTION(glGetSamplerParameterfv)
+GL_FUNCTION(glGetSamplerParameterIuiv)
+GL_FUNCTION(glQueryCounter)
+GL_FUNCTION(glGetQueryObjecti64v)
+GL_FUNCTION(glGetQueryObjectui64v)
+GL_FUNCTION(glVertexAttribDivisor)
+GL_FUNCTION(glVertexAttribP1ui)
+GL_FUNCTION(glVertexAttribP1uiv)
+GL_FUNCTION(glVertexAttribP2ui)
+GL_FUNCTION(glVertexAttribP2uiv)
+GL_FUNCTION(glVertexAttribP3ui)
+GL_FUNCTION(glVertexAttribP3uiv)
+GL_FUNCTION(glVertexAttribP4ui)
+GL_FUNCTION(glVertexAttribP4uiv)
+GL_FUNCTION(glVertexP2ui)
+GL_FUNCTION(glVertexP2uiv)
+GL_FUNCTION(glVertexP3ui)
+GL_FUNCTION(glVertexP3uiv)
+GL_FUNCTION(glVertexP4ui)
+GL_FUNCTION(glVertexP4uiv)
+GL_FUNCTION(glTexCoordP1ui)
+GL_FUNCTION(glTexCoordP1uiv)
+GL_FUNCTION(glTexCoordP2ui)
+GL_FUNCTION(glTexCoordP2uiv)
+GL_FUNCTION(glTexCoordP3ui)
+GL_FUNCTION(glTexCoordP3uiv)
+GL_FUNCTION(glTexCoordP4ui)
+GL_FUNCTION(glTexCoordP4uiv)
+GL_FUNCTION(glMultiTexCoordP1ui)
+GL_FUNCTION(glMultiTexCoordP1uiv)
+GL_FUNCTION(glMultiTexCoordP2ui)
+GL_FUNCTION(glMultiTexCoordP2uiv)
+GL_FUNCTION(glMultiTexCoordP3ui)
+GL_FUNCTION(glMultiTexCoordP3uiv)
+GL_FUNCTION(glMultiTexCoordP4ui)
+GL_FUNCTION(glMultiTexCoordP4uiv)
+GL_FUNCTION(glNormalP3ui)
+GL_FUNCTION(glNormalP3uiv)
+GL_FUNCTION(glColorP3ui)
+GL_FUNCTION(glColorP3uiv)
+GL_FUNCTION(glColorP4ui)
+GL_FUNCTION(glColorP4uiv)
+GL_FUNCTION(glSecondaryColorP3ui)
+GL_FUNCTION(glSecondaryColorP3uiv)
+
+// OpenGL 4.0
+GL_FUNCTION(glMinSampleShading)
+GL_FUNCTION(glBlendEquationi)
+GL_FUNCTION(glBlendEquationSeparatei)
+GL_FUNCTION(glBlendFunci)
+GL_FUNCTION(glBlendFuncSeparatei)
+GL_FUNCTION(glDrawArraysIndirect)
+GL_FUNCTION(glDrawElementsIndirect)
+GL_FUNCTION(glUniform1d)
+GL_FUNCTION(glUniform2d)
+GL_FUNCTION(glUniform3d)
+GL_FUNCTION(glUniform4d)
+GL_FUNCTION(glUniform1dv)
+GL_FUNCTION(glUniform2dv)
+GL_FUNCTION(glUniform3dv)
+GL_FUNCTION(glUniform4dv)
+GL_FUNCTION(glUniformMatrix2dv)
+GL_FUNCTION(glUniformMatrix3dv)
+GL_FUNCTION(glUniformMatrix4dv)
+GL_FUNCTION(glUniformMatrix2x3dv)
+GL_FUNCTION(glUniformMatrix2x4dv)
+GL_FUNCTION(glUniformMatrix3x2dv)
+GL_FUNCTION(glUniformMatrix3x4dv)
+GL_FUNCTION(glUniformMatrix4x2dv)
+GL_FUNCTION(glUniformMatrix4x3dv)
+GL_FUNCTION(glGetUniformdv)
+GL_FUNCTION(glGetSubroutineUniformLocation)
+GL_FUNCTION(glGetSubroutineIndex)
+GL_FUNCTION(glGetActiveSubroutineUniformiv)
+GL_FUNCTION(glGetActiveSubroutineUniformName)
+GL_FUNCTION(glGetActiveSubroutineName)
+GL_FUNCTION(glUniformSubroutinesuiv)
+GL_FUNCTION(glGetUniformSubroutineuiv)
+GL_FUNCTION(glGetProgramStageiv)
+GL_FUNCTION(glPatchParameteri)
+GL_FUNCTION(glPatchParameterfv)
+GL_FUNCTION(glBindTransformFeedback)
+GL_FUNCTION(glDeleteTransformFeedbacks)
+GL_FUNCTION(glGenTransformFeedbacks)
+GL_FUNCTION(glIsTransformFeedback)
+GL_FUNCTION(glPauseTransformFeedback)
+GL_FUNCTION(glResumeTransformFeedback)
+GL_FUNCTION(glDrawTransformFeedback)
+GL_FUNCTION(glDrawTransformFeedbackStream)
+GL_FUNCTION(glBeginQueryIndexed)
+GL_FUNCTION(glEndQueryIndexed)
+GL_FUNCTION(glGetQueryIndexediv)
@@ -0,0 +1,156 @@
+// Carga preguiçosa dos ponteiros de função da OpenGL
+//
+// gladLoadGLLoader pede ao driver o endereço de todas as 770 funções da OpenGL
+// 4.0 na inicialização, mas um exercício usa poucas dezenas. loadGL() com lazy
+// verdadeiro só aponta cada ponteiro da GLAD (glad_glDrawArrays etc.) para um
+// trampolim: na primeira chamada ele pede o endereço ao driver, troca o ponteiro
+// da GLAD pelo endereço real e repassa a chamada; as chamadas seguintes vão
+// direto para o driver. Se o ponteiro já tiver sido interceptado (Benchmark.h,
+// GLStateCache.h), o trampolim guarda o endereço para si e não desfaz o gancho.
+//
+// Os trampolins são gerados por template a partir do tipo de cada ponteiro da
+// GLAD; a lista de funções está em GLFunctionList.h. Todos os exercícios usam a
+// mesma GLAD (Dependencies/GLAD/src/glad.c).
+//
+// printGLLoaderStats() mostra o tempo gasto resolvendo símbolos, que pesa quando
+// muitos processos curtos são iniciados.
+
+#pragma once
+
+#include <cstdio>
+#include <chrono>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+struct GLLoaderStats
+{
+	bool lazy = false;
+	unsigned functions = 0;   // Ponteiros preenchidos (trampolins ou endereços reais)
+	unsigned resolved = 0;    // Endereços pedidos ao driver
+	unsigned missing = 0;     // Funções que o driver não tem
+	double loadMs = 0.0;      // Tempo dentro de loadGL()
+	double resolveMs = 0.0;   // Tempo total pedindo endereços ao driver
+};
+
+namespace gl_loader_detail
+{
+	// Os exercícios são compilados como uma única unidade de tradução, então
+	// estado estático no cabeçalho é suficiente
+	static GLADloadproc loader = NULL;
+	static GLLoaderStats stats;
+
+	const unsigned kFunctionCount = 0
+#define GL_FUNCTION(fn) + 1
+#include "GLFunctionList.h"
+#undef GL_FUNCTION
+		;
+
+	inline void* resolve(const char* name)
+	{
+		auto start = std::chrono::steady_clock::now();
+		void* proc = loader(name);
+		stats.resolveMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		++stats.resolved;
+		if (!proc)
+		{
+			std::cout << "ERROR::GL_LOADER::MISSING_FUNCTION " << name << std::endl;
+			++stats.missing;
+		}
+		return proc;
+	}
+
+	// Um trampolim para cada ponteiro da GLAD (slot), com a assinatura do ponteiro
+	template <class Proc, Proc* slot>
+	struct Trampoline;
+
+	template <class R, class... Args, R (APIENTRYP* slot)(Args...)>
+	struct Trampoline<R (APIENTRYP)(Args...), slot>
+	{
+		typedef R (APIENTRYP Proc)(Args...);
+
+		static const char* name;
+		static Proc real;
+
+		static R APIENTRY call(Args... args)
+		{
+			if (!real)
+			{
+				real = (Proc)resolve(name);
+				if (!real)
+					return R();
+				// Só troca o ponteiro da GLAD se ninguém o interceptou
+				if (*slot == &call)
+					*slot = real;
+			}
+			return real(args...);
+		}
+	};
+
+	template <class R, class... Args, R (APIENTRYP* slot)(Args...)>
+	const char* Trampoline<R (APIENTRYP)(Args...), slot>::name = NULL;
+
+	template <class R, class... Args, R (APIENTRYP* slot)(Args...)>
+	typename Trampoline<R (APIENTRYP)(Args...), slot>::Proc Trampoline<R (APIENTRYP)(Args...), slot>::real = NULL;
+
+	// Versão da OpenGL e flags GLAD_GL_VERSION_*, como gladLoadGLLoader faz
+	inline bool findVersion()
+	{
+		const char* version = (const char*)glGetString(GL_VERSION);
+		int major = 0, minor = 0;
+		if (!version || sscanf(version, "%d.%d", &major, &minor) != 2)
+			return false;
+		GLVersion.major = major;
+		GLVersion.minor = minor;
+		int v = major * 10 + minor;
+		GLAD_GL_VERSION_1_0 = v >= 10; GLAD_GL_VERSION_1_1 = v >= 11; GLAD_GL_VERSION_1_2 = v >= 12;
+		GLAD_GL_VERSION_1_3 = v >= 13; GLAD_GL_VERSION_1_4 = v >= 14; GLAD_GL_VERSION_1_5 = v >= 15;
+		GLAD_GL_VERSION_2_0 = v >= 20; GLAD_GL_VERSION_2_1 = v >= 21; GLAD_GL_VERSION_3_0 = v >= 30;
+		GLAD_GL_VERSION_3_1 = v >= 31; GLAD_GL_VERSION_3_2 = v >= 32; GLAD_GL_VERSION_3_3 = v >= 33;
+		GLAD_GL_VERSION_4_0 = v >= 40;
+		return true;
+	}
+}
+
+// Carrega os ponteiros da OpenGL (o contexto precisa estar ativo)
+// lazy falso: gladLoadGLLoader, com todos os endereços resolvidos agora
+inline bool loadGL(GLADloadproc load, bool lazy)
+{
+	using namespace gl_loader_detail;
+	auto start = std::chrono::steady_clock::now();
+	loader = load;
+	stats = GLLoaderStats();
+	stats.lazy = lazy;
+	bool ok;
+	if (lazy)
+	{
+#define GL_FUNCTION(fn) \
+		Trampoline<decltype(glad_##fn), &glad_##fn>::name = #fn; \
+		glad_##fn = &Trampoline<decltype(glad_##fn), &glad_##fn>::call;
+#include "GLFunctionList.h"
+#undef GL_FUNCTION
+		stats.functions = kFunctionCount;
+		ok = findVersion();
+	}
+	else
+	{
+		ok = gladLoadGLLoader(load) != 0;
+		stats.functions = stats.resolved = kFunctionCount;
+		stats.resolveMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+	stats.loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return ok;
+}
+
+inline const GLLoaderStats& getGLLoaderStats() { return gl_loader_detail::stats; }
+
+inline void printGLLoaderStats(std::ostream& out)
+{
+	const GLLoaderStats& stats = gl_loader_detail::stats;
+	out << "GL loader: " << (stats.lazy ? "lazy" : "eager") << ", " << stats.functions << " functions, "
+		<< stats.resolved << " resolved (" << stats.resolveMs << " ms), load " << stats.loadMs << " ms";
+	if (stats.missing)
+		out << ", " << stats.missing << " missing";
+	out << std::endl;
+}
@@ -0,0 +1,350 @@
+// Cache do estado da OpenGL: descarta chamadas que não mudam nada
+//
+// Os loops de desenho dos exercícios repetem o mesmo estado a cada frame
+// (glUseProgram, glLineWidth, glClearColor...) e vinculam/desvinculam o VAO em
+// volta de cada desenho. Como o Benchmark, o cache troca os ponteiros da GLAD
+// (glad_glUseProgram etc.) por funções que comparam o valor pedido com uma
+// cópia do estado atual e só repassam ao driver o que muda: nenhum exercício
+// precisa ser alterado.
+//
+// Estado acompanhado: programa, VAO, GL_ARRAY_BUFFER e GL_ELEMENT_ARRAY_BUFFER,
+// unidade de textura ativa e GL_TEXTURE_2D de cada unidade, espessura de linha,
+// tamanho de ponto e cor de fundo. O glBindVertexArray(0) do fim de cada desenho
+// fica pendente: se o próximo vínculo for o mesmo VAO, as duas chamadas somem.
+// O vínculo pendente é feito antes de qualquer chamada que dependa do VAO
+// (desenhos, ponteiros de atributo, buffers de índices, glGetIntegerv).
+//
+// Instalado pela AppWindow depois dos contadores do Benchmark, de modo que as
+// chamadas descartadas não aparecem em state_changes; elas são contadas em
+// elided_state_calls. --no-state-cache desliga o cache.
+
+#pragma once
+
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+#include "Benchmark.h"
+
+namespace state_cache_detail
+{
+	const GLuint kUnknown = 0xFFFFFFFFu; // Estado ainda não visto: a próxima chamada sempre passa
+	const GLuint kTextureUnits = 32;
+
+	struct Shadow
+	{
+		GLuint program = kUnknown;
+		GLuint vertexArray = kUnknown;     // VAO vinculado no driver
+		bool unbindPending = false;        // glBindVertexArray(0) ainda não repassado
+		GLuint arrayBuffer = kUnknown;
+		GLuint elementBuffer = kUnknown;   // Do VAO atual
+		GLuint activeTexture = kUnknown;   // Índice da unidade (0 = GL_TEXTURE0)
+		GLuint texture2D[kTextureUnits];
+		GLfloat lineWidth = -1.0f, pointSize = -1.0f;
+		GLfloat clearColor[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+
+		Shadow()
+		{
+			for (GLuint i = 0; i < kTextureUnits; ++i)
+				texture2D[i] = kUnknown;
+		}
+	};
+
+	static Shadow shadow;
+	static long long elidedTotal = 0;
+
+	inline void elide(long long calls = 1)
+	{
+		elidedTotal += calls;
+		benchmark_detail::counters.elidedCalls += calls;
+	}
+
+	static PFNGLUSEPROGRAMPROC real_glUseProgram = NULL;
+	static PFNGLBINDVERTEXARRAYPROC real_glBindVertexArray = NULL;
+	static PFNGLBINDBUFFERPROC real_glBindBuffer = NULL;
+	static PFNGLACTIVETEXTUREPROC real_glActiveTexture = NULL;
+	static PFNGLBINDTEXTUREPROC real_glBindTexture = NULL;
+	static PFNGLLINEWIDTHPROC real_glLineWidth = NULL;
+	static PFNGLPOINTSIZEPROC real_glPointSize = NULL;
+	static PFNGLCLEARCOLORPROC real_glClearColor = NULL;
+	static PFNGLDELETEPROGRAMPROC real_glDeleteProgram = NULL;
+	static PFNGLDELETEVERTEXARRAYSPROC real_glDeleteVertexArrays = NULL;
+	static PFNGLDELETEBUFFERSPROC real_glDeleteBuffers = NULL;
+	static PFNGLDELETETEXTURESPROC real_glDeleteTextures = NULL;
+
+	// Repassa o glBindVertexArray(0) adiado
+	inline void flushVertexArray()
+	{
+		if (!shadow.unbindPending)
+			return;
+		shadow.unbindPending = false;
+		real_glBindVertexArray(0);
+		shadow.vertexArray = 0;
+		shadow.elementBuffer = kUnknown;
+	}
+
+	static void APIENTRY hook_glUseProgram(GLuint program)
+	{
+		if (program == shadow.program)
+		{
+			elide();
+			return;
+		}
+		shadow.program = program;
+		real_glUseProgram(program);
+	}
+
+	static void APIENTRY hook_glBindVertexArray(GLuint array)
+	{
+		if (array == 0 && shadow.vertexArray != kUnknown)
+		{
+			// Desvincular é adiado; se já havia um pendente (ou já está em 0), é redundante
+			if (shadow.unbindPending || shadow.vertexArray == 0)
+				elide();
+			else
+				shadow.unbindPending = true;
+			return;
+		}
+		if (shadow.unbindPending && array == shadow.vertexArray)
+		{
+			// Desvincula e vincula o mesmo VAO de novo: nenhuma das duas chamadas chega ao driver
+			shadow.unbindPending = false;
+			elide(2);
+			return;
+		}
+		if (shadow.unbindPending)
+		{
+			// O novo vínculo já substitui o glBindVertexArray(0)
+			shadow.unbindPending = false;
+			elide();
+		}
+		else if (array == shadow.vertexArray)
+		{
+			elide();
+			return;
+		}
+		shadow.vertexArray = array;
+		shadow.elementBuffer = kUnknown;
+		real_glBindVertexArray(array);
+	}
+
+	static void APIENTRY hook_glBindBuffer(GLenum target, GLuint buffer)
+	{
+		GLuint* slot = NULL;
+		if (target == GL_ARRAY_BUFFER)
+			slot = &shadow.arrayBuffer;
+		else if (target == GL_ELEMENT_ARRAY_BUFFER)
+		{
+			flushVertexArray();
+			slot = &shadow.elementBuffer;
+		}
+		if (slot && *slot == buffer)
+		{
+			elide();
+			return;
+		}
+		if (slot)
+			*slot = buffer;
+		real_glBindBuffer(target, buffer);
+	}
+
+	static void APIENTRY hook_glActiveTexture(GLenum texture)
+	{
+		GLuint unit = texture - GL_TEXTURE0;
+		if (unit == shadow.activeTexture)
+		{
+			elide();
+			return;
+		}
+		shadow.activeTexture = unit;
+		real_glActiveTexture(texture);
+	}
+
+	static void APIENTRY hook_glBindTexture(GLenum target, GLuint texture)
+	{
+		GLuint unit = shadow.activeTexture;
+		if (target == GL_TEXTURE_2D && unit < kTextureUnits)
+		{
+			if (shadow.texture2D[unit] == texture)
+			{
+				elide();
+				return;
+			}
+			shadow.texture2D[unit] = texture;
+		}
+		real_glBindTexture(target, texture);
+	}
+
+	static void APIENTRY hook_glLineWidth(GLfloat width)
+	{
+		if (width == shadow.lineWidth)
+		{
+			elide();
+			return;
+		}
+		shadow.lineWidth = width;
+		real_glLineWidth(width);
+	}
+
+	static void APIENTRY hook_glPointSize(GLfloat size)
+	{
+		if (size == shadow.pointSize)
+		{
+			elide();
+			return;
+		}
+		shadow.pointSize = size;
+		real_glPointSize(size);
+	}
+
+	static void APIENTRY hook_glClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+	{
+		GLfloat* c = shadow.clearColor;
+		if (c[0] == r && c[1] == g && c[2] == b && c[3] == a)
+		{
+			elide();
+			return;
+		}
+		c[0] = r; c[1] = g; c[2] = b; c[3] = a;
+		real_glClearColor(r, g, b, a);
+	}
+
+	// Apagar um objeto vinculado desfaz o vínculo (e o nome pode ser reaproveitado)
+	static void APIENTRY hook_glDeleteProgram(GLuint program)
+	{
+		if (program == shadow.program)
+			shadow.program = kUnknown;
+		real_glDeleteProgram(program);
+	}
+
+	static void APIENTRY hook_glDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+	{
+		flushVertexArray();
+		for (GLsizei i = 0; i < n; ++i)
+		{
+			if (arrays[i] == shadow.vertexArray)
+			{
+				shadow.vertexArray = 0;
+				shadow.elementBuffer = kUnknown;
+			}
+		}
+		real_glDeleteVertexArrays(n, arrays);
+	}
+
+	static void APIENTRY hook_glDeleteBuffers(GLsizei n, const GLuint* buffers)
+	{
+		flushVertexArray();
+		for (GLsizei i = 0; i < n; ++i)
+		{
+			if (buffers[i] == shadow.arrayBuffer)
+				shadow.arrayBuffer = 0;
+			if (buffers[i] == shadow.elementBuffer)
+				shadow.elementBuffer = kUnknown;
+		}
+		real_glDeleteBuffers(n, buffers);
+	}
+
+	static void APIENTRY hook_glDeleteTextures(GLsizei n, const GLuint* textures)
+	{
+		for (GLsizei i = 0; i < n; ++i)
+		{
+			for (GLuint unit = 0; unit < kTextureUnits; ++unit)
+			{
+				if (textures[i] == shadow.texture2D[unit])
+					shadow.texture2D[unit] = 0;
+			}
+		}
+		real_glDeleteTextures(n, textures);
+	}
+
+	// Funções que dependem do VAO vinculado: fazem antes o vínculo pendente
+#define STATE_CACHE_FLUSH_HOOK(name, PFN, params, args) \
+	static PFN real_##name = NULL; \
+	static void APIENTRY hook_##name params { flushVertexArray(); real_##name args; }
+	// Operações sobre um alvo de buffer: só o de índices depende do VAO
+#define STATE_CACHE_TARGET_HOOK(name, PFN, ret, params, args) \
+	static PFN real_##name = NULL; \
+	static ret APIENTRY hook_##name params { if (target == GL_ELEMENT_ARRAY_BUFFER) flushVertexArray(); return real_##name args; }
+
+	STATE_CACHE_FLUSH_HOOK(glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum m, GLint f, GLsizei c), (m, f, c))
+	STATE_CACHE_FLUSH_HOOK(glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum m, GLsizei c, GLenum t, const void* i), (m, c, t, i))
+	STATE_CACHE_FLUSH_HOOK(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum m, GLuint s, GLuint e, GLsizei c, GLenum t, const void* i), (m, s, e, c, t, i))
+	STATE_CACHE_FLUSH_HOOK(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum m, GLint f, GLsizei c, GLsizei n), (m, f, c, n))
+	STATE_CACHE_FLUSH_HOOK(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum m, GLsizei c, GLenum t, const void* i, GLsizei n), (m, c, t, i, n))
+	STATE_CACHE_FLUSH_HOOK(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum m, GLsizei c, GLenum t, const void* i, GLint b), (m, c, t, i, b))
+	STATE_CACHE_FLUSH_HOOK(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum m, GLsizei c, GLenum t, const void* i, GLsizei n, GLint b), (m, c, t, i, n, b))
+	STATE_CACHE_FLUSH_HOOK(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum m, const GLint* f, const GLsizei* c, GLsizei n), (m, f, c, n))
+	STATE_CACHE_FLUSH_HOOK(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum m, const GLsizei* c, GLenum t, const void* const* i, GLsizei n), (m, c, t, i, n))
+	STATE_CACHE_FLUSH_HOOK(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC, (GLenum m, const void* i), (m, i))
+	STATE_CACHE_FLUSH_HOOK(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, (GLenum m, GLenum t, const void* i), (m, t, i))
+	STATE_CACHE_FLUSH_HOOK(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint x, GLint s, GLenum t, GLboolean n, GLsizei st, const void* p), (x, s, t, n, st, p))
+	STATE_CACHE_FLUSH_HOOK(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint x, GLint s, GLenum t, GLsizei st, const void* p), (x, s, t, st, p))
+	STATE_CACHE_FLUSH_HOOK(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint x), (x))
+	STATE_CACHE_FLUSH_HOOK(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint x), (x))
+	STATE_CACHE_FLUSH_HOOK(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint x, GLuint d), (x, d))
+	STATE_CACHE_FLUSH_HOOK(glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum p, GLint* v), (p, v))
+	STATE_CACHE_TARGET_HOOK(glBufferData, PFNGLBUFFERDATAPROC, void, (GLenum target, GLsizeiptr s, const void* d, GLenum u), (target, s, d, u))
+	STATE_CACHE_TARGET_HOOK(glBufferSubData, PFNGLBUFFERSUBDATAPROC, void, (GLenum target, GLintptr o, GLsizeiptr s, const void* d), (target, o, s, d))
+	STATE_CACHE_TARGET_HOOK(glMapBuffer, PFNGLMAPBUFFERPROC, void*, (GLenum target, GLenum a), (target, a))
+	STATE_CACHE_TARGET_HOOK(glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, void*, (GLenum target, GLintptr o, GLsizeiptr l, GLbitfield a), (target, o, l, a))
+	STATE_CACHE_TARGET_HOOK(glUnmapBuffer, PFNGLUNMAPBUFFERPROC, GLboolean, (GLenum target), (target))
+
+#undef STATE_CACHE_FLUSH_HOOK
+#undef STATE_CACHE_TARGET_HOOK
+}
+
+// Troca os ponteiros da GLAD pelo cache (chamar depois de installGLCallCounters,
+// para que os contadores só vejam as chamadas que chegam ao driver)
+inline void installGLStateCache()
+{
+	using namespace state_cache_detail;
+#define STATE_CACHE_INSTALL(name) \
+	if (glad_##name && !real_##name) { real_##name = glad_##name; glad_##name = hook_##name; }
+
+	STATE_CACHE_INSTALL(glUseProgram)
+	STATE_CACHE_INSTALL(glBindVertexArray)
+	STATE_CACHE_INSTALL(glBindBuffer)
+	STATE_CACHE_INSTALL(glActiveTexture)
+	STATE_CACHE_INSTALL(glBindTexture)
+	STATE_CACHE_INSTALL(glLineWidth)
+	STATE_CACHE_INSTALL(glPointSize)
+	STATE_CACHE_INSTALL(glClearColor)
+	STATE_CACHE_INSTALL(glDeleteProgram)
+	STATE_CACHE_INSTALL(glDeleteVertexArrays)
+	STATE_CACHE_INSTALL(glDeleteBuffers)
+	STATE_CACHE_INSTALL(glDeleteTextures)
+	STATE_CACHE_INSTALL(glDrawArrays)
+	STATE_CACHE_INSTALL(glDrawElements)
+	STATE_CACHE_INSTALL(glDrawRangeElements)
+	STATE_CACHE_INSTALL(glDrawArraysInstanced)
+	STATE_CACHE_INSTALL(glDrawElementsInstanced)
+	STATE_CACHE_INSTALL(glDrawElementsBaseVertex)
+	STATE_CACHE_INSTALL(glDrawElementsInstancedBaseVertex)
+	STATE_CACHE_INSTALL(glMultiDrawArrays)
+	STATE_CACHE_INSTALL(glMultiDrawElements)
+	STATE_CACHE_INSTALL(glDrawArraysIndirect)
+	STATE_CACHE_INSTALL(glDrawElementsIndirect)
+	STATE_CACHE_INSTALL(glVertexAttribPointer)
+	STATE_CACHE_INSTALL(glVertexAttribIPointer)
+	STATE_CACHE_INSTALL(glEnableVertexAttribArray)
+	STATE_CACHE_INSTALL(glDisableVertexAttribArray)
+	STATE_CACHE_INSTALL(glVertexAttribDivisor)
+	STATE_CACHE_INSTALL(glGetIntegerv)
+	STATE_CACHE_INSTALL(glBufferData)
+	STATE_CACHE_INSTALL(glBufferSubData)
+	STATE_CACHE_INSTALL(glMapBuffer)
+	STATE_CACHE_INSTALL(glMapBufferRange)
+	STATE_CACHE_INSTALL(glUnmapBuffer)
+
+#undef STATE_CACHE_INSTALL
+}
+
+// Total de chamadas descartadas desde a instalação; frames > 0 mostra também a média por frame
+inline void printGLStateCacheStats(std::ostream& out, long long frames)
+{
+	out << "State cache: " << state_cache_detail::elidedTotal << " redundant calls elided";
+	if (frames > 0)
+		out << " (" << (double)state_cache_detail::elidedTotal / frames << " per frame)";
+	out << std::endl;
+}
@@ -0,0 +1,1357 @@
+// Gravação das chamadas OpenGL em um trace binário e reprodução do trace
+//
+// O gravador troca cada ponteiro da GLAD por um gancho que escreve a chamada no
+// arquivo (índice da função + argumentos) e repassa ao ponteiro original. As
+// funções sem ponteiros nos argumentos são gravadas por um gancho genérico,
+// gerado por template a partir da lista de GLFunctionList.h; as que recebem ou
+// devolvem dados têm ganchos próprios, que gravam o conteúdo: dados de buffers
+// (glBufferData, glBufferSubData e o que foi escrito em glMapBufferRange até o
+// glUnmapBuffer), códigos fonte dos shaders, nomes e valores de uniforms,
+// objetos criados (glGen*, glCreate*, glFenceSync). Deslocamentos em buffers
+// (glVertexAttribPointer, glDrawElements...) são gravados como números.
+// Ponteiros de outras funções não são seguidos; o gravador avisa uma vez por função.
+// Nomes de objetos (buffers, texturas, programas, consultas...) são traduzidos
+// pelos reprodutores próprios; as funções genéricas que recebem nomes sem
+// tradução (samplers, transform feedback, consultas a programas) também geram
+// um aviso, já que na reprodução elas usariam os nomes gravados.
+//
+// Funções carregadas fora da GLAD (glBufferStorage, glProgramBinary...) não
+// passariam pelo gravador, então durante a gravação o carregador da AppWindow
+// não as encontra, e os módulos usam seus caminhos alternativos.
+//
+// Formato: "GLTR", versão, largura e altura da janela, tabela com os nomes das
+// funções; depois os registros (uint16 índice + argumentos), 0xFFFD no fim da
+// preparação, 0xFFFF no fim de cada frame e, no fim do arquivo, 0xFFFE +
+// quantidade de frames.
+//
+// O reprodutor (GLTraceReplayer, usado pelo programa GLReplay) lê o trace para a
+// memória, recria os objetos traduzindo os nomes gravados para os novos e mede
+// o tempo de cada função e de cada frame.
+//
+// Gravação: qualquer exercício com --gl-record ARQ.gltrace (AppWindow.h).
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+#include <type_traits>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+namespace gl_trace_detail
+{
+	const uint32_t kVersion = 1;
+	const uint16_t kFrameMarker = 0xFFFF, kEndMarker = 0xFFFE, kSetupMarker = 0xFFFD;
+
+	// Índice de cada função no trace: a ordem de GLFunctionList.h
+	enum FunctionId
+	{
+#define GL_FUNCTION(fn) id_##fn,
+#include "GLFunctionList.h"
+#undef GL_FUNCTION
+		kFunctionCount
+	};
+
+	inline const char* functionName(int id)
+	{
+		static const char* names[] = {
+#define GL_FUNCTION(fn) #fn,
+#include "GLFunctionList.h"
+#undef GL_FUNCTION
+		};
+		return names[id];
+	}
+
+	class TraceWriter
+	{
+	public:
+		bool open(const std::string& path, int width, int height)
+		{
+			file = fopen(path.c_str(), "wb");
+			if (!file)
+				return false;
+			raw("GLTR", 4);
+			put(kVersion);
+			put((uint32_t)width);
+			put((uint32_t)height);
+			put((uint32_t)kFunctionCount);
+			for (int i = 0; i < kFunctionCount; ++i)
+				blob(functionName(i), strlen(functionName(i)));
+			return true;
+		}
+
+		bool isOpen() const { return file != NULL; }
+
+		void begin(int id)
+		{
+			put((uint16_t)id);
+			++calls;
+		}
+
+		template <class T>
+		void put(T value) { raw(&value, sizeof(T)); }
+
+		void pointer(const void* p) { put((uint64_t)(uintptr_t)p); }
+
+		// Argumento de gancho genérico: ponteiros viram números
+		template <class T>
+		void arg(T value)
+		{
+			if constexpr (std::is_pointer<T>::value)
+				pointer((const void*)value);
+			else
+				put(value);
+		}
+
+		void blob(const void* data, size_t bytes)
+		{
+			put((uint32_t)bytes);
+			raw(data, bytes);
+		}
+
+		void string(const char* s) { blob(s, s ? strlen(s) : 0); }
+
+		void setupDone() { put(kSetupMarker); }
+
+		void frame()
+		{
+			put(kFrameMarker);
+			++frames;
+		}
+
+		void close()
+		{
+			if (!file)
+				return;
+			put(kEndMarker);
+			put((uint32_t)frames);
+			flush();
+			fclose(file);
+			file = NULL;
+		}
+
+		unsigned long long getCalls() const { return calls; }
+		unsigned long long getBytes() const { return bytes; }
+		unsigned getFrames() const { return frames; }
+
+	private:
+		void raw(const void* data, size_t size)
+		{
+			if (!file)
+				return;
+			const unsigned char* p = (const unsigned char*)data;
+			buffer.insert(buffer.end(), p, p + size);
+			bytes += size;
+			if (buffer.size() >= (4u << 20))
+				flush();
+		}
+
+		void flush()
+		{
+			if (!buffer.empty())
+				fwrite(buffer.data(), 1, buffer.size(), file);
+			buffer.clear();
+		}
+
+		FILE* file = NULL;
+		std::vector<unsigned char> buffer;
+		unsigned long long calls = 0, bytes = 0;
+		unsigned frames = 0;
+	};
+
+	// Os exercícios são compilados como uma única unidade de tradução, então
+	// estado estático no cabeçalho é suficiente
+	static TraceWriter writer;
+	static GLADloadproc realLoader = NULL;
+	static bool handwritten[kFunctionCount];
+	static bool pointerWarning[kFunctionCount]; // Função genérica com ponteiro que não é deslocamento
+	static bool nameWarning[kFunctionCount];    // Função genérica que recebe nome de objeto sem tradução
+
+	// Funções genéricas cujos ponteiros são deslocamentos em buffers ou GLsync
+	// (gravados por valor e traduzidos na reprodução)
+	inline bool pointerIsOffset(int id)
+	{
+		return id == id_glClientWaitSync || id == id_glDeleteSync || id == id_glVertexAttribPointer || id == id_glVertexAttribIPointer || id == id_glDrawElements ||
+			id == id_glDrawElementsInstanced || id == id_glDrawElementsBaseVertex || id == id_glDrawRangeElements ||
+			id == id_glDrawElementsInstancedBaseVertex || id == id_glDrawArraysIndirect || id == id_glDrawElementsIndirect;
+	}
+
+	// Funções genéricas que recebem nomes de objetos que o reprodutor não traduz
+	inline bool nameNotRemapped(int id)
+	{
+		switch (id)
+		{
+		case id_glGetActiveAttrib: case id_glGetAttachedShaders: case id_glGetShaderSource:
+		case id_glGetUniformfv: case id_glGetUniformiv: case id_glGetUniformuiv: case id_glGetUniformdv:
+		case id_glGetUniformIndices: case id_glGetActiveUniformsiv: case id_glGetActiveUniformName:
+		case id_glGetActiveUniformBlockiv: case id_glGetActiveUniformBlockName:
+		case id_glTransformFeedbackVaryings: case id_glGetTransformFeedbackVarying:
+		case id_glGetFragDataLocation: case id_glGetFragDataIndex: case id_glBindFragDataLocationIndexed:
+		case id_glGetQueryObjectiv: case id_glGetQueryObjecti64v:
+		case id_glGenSamplers: case id_glDeleteSamplers: case id_glIsSampler: case id_glBindSampler:
+		case id_glSamplerParameteri: case id_glSamplerParameteriv: case id_glSamplerParameterf:
+		case id_glSamplerParameterfv: case id_glSamplerParameterIiv: case id_glSamplerParameterIuiv:
+		case id_glGetSamplerParameteriv: case id_glGetSamplerParameterIiv: case id_glGetSamplerParameterfv:
+		case id_glGetSamplerParameterIuiv:
+		case id_glGetSubroutineUniformLocation: case id_glGetSubroutineIndex: case id_glGetActiveSubroutineUniformiv:
+		case id_glGetActiveSubroutineUniformName: case id_glGetActiveSubroutineName: case id_glGetProgramStageiv:
+		case id_glGenTransformFeedbacks: case id_glDeleteTransformFeedbacks: case id_glBindTransformFeedback:
+		case id_glIsTransformFeedback: case id_glDrawTransformFeedback: case id_glDrawTransformFeedbackStream:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// Gancho genérico: grava o índice e os argumentos por valor
+	template <class Proc, Proc* slot>
+	struct GenericHook;
+
+	template <class R, class... Args, R (APIENTRYP* slot)(Args...)>
+	struct GenericHook<R (APIENTRYP)(Args...), slot>
+	{
+		static R (APIENTRYP real)(Args...);
+		static int id;
+
+		static void install(int functionId)
+		{
+			id = functionId;
+			real = *slot;
+			*slot = &call;
+			bool pointers = false;
+			bool flags[] = { false, std::is_pointer<Args>::value... };
+			for (bool f : flags)
+				pointers = pointers || f;
+			pointerWarning[id] = pointers && !pointerIsOffset(id);
+			nameWarning[id] = nameNotRemapped(id);
+		}
+
+		static R APIENTRY call(Args... args)
+		{
+			if (pointerWarning[id])
+			{
+				std::cout << "ERROR::GL_TRACE::POINTER_NOT_RECORDED " << functionName(id) << std::endl;
+				pointerWarning[id] = false;
+			}
+			if (nameWarning[id])
+			{
+				std::cout << "ERROR::GL_TRACE::NAME_NOT_REMAPPED " << functionName(id) << std::endl;
+				nameWarning[id] = false;
+			}
+			writer.begin(id);
+			int expand[] = { 0, (writer.arg(args), 0)... };
+			(void)expand;
+			return real(args...);
+		}
+	};
+
+	template <class R, class... Args, R (APIENTRYP* slot)(Args...)>
+	R (APIENTRYP GenericHook<R (APIENTRYP)(Args...), slot>::real)(Args...) = NULL;
+
+	template <class R, class... Args, R (APIENTRYP* slot)(Args...)>
+	int GenericHook<R (APIENTRYP)(Args...), slot>::id = 0;
+
+	// Ganchos próprios: real_X é o ponteiro original, record_X grava e repassa
+#define TRACE_REAL(name) static decltype(glad_##name) real_##name = NULL;
+
+	// Buffer mapeado em cada alvo, para gravar o que foi escrito até o glUnmapBuffer
+	struct MappedRange
+	{
+		void* pointer = NULL;
+		GLsizeiptr length = 0;
+		GLbitfield access = 0;
+	};
+	static std::map<GLenum, MappedRange> mapped;
+	static GLuint packBuffer = 0;
+
+	// glGen* e glDelete*: quantidade e nomes
+#define TRACE_NAMES_HOOK(name) \
+	static decltype(glad_##name) real_##name = NULL; \
+	static void APIENTRY record_##name(GLsizei n, GLuint* names) \
+	{ \
+		real_##name(n, names); \
+		writer.begin(id_##name); \
+		writer.blob(names, sizeof(GLuint) * n); \
+	}
+#define TRACE_DELETE_HOOK(name) \
+	static decltype(glad_##name) real_##name = NULL; \
+	static void APIENTRY record_##name(GLsizei n, const GLuint* names) \
+	{ \
+		writer.begin(id_##name); \
+		writer.blob(names, sizeof(GLuint) * n); \
+		real_##name(n, names); \
+	}
+
+	TRACE_NAMES_HOOK(glGenBuffers)
+	TRACE_NAMES_HOOK(glGenVertexArrays)
+	TRACE_NAMES_HOOK(glGenTextures)
+	TRACE_NAMES_HOOK(glGenQueries)
+	TRACE_NAMES_HOOK(glGenFramebuffers)
+	TRACE_NAMES_HOOK(glGenRenderbuffers)
+	TRACE_DELETE_HOOK(glDeleteBuffers)
+	TRACE_DELETE_HOOK(glDeleteVertexArrays)
+	TRACE_DELETE_HOOK(glDeleteTextures)
+	TRACE_DELETE_HOOK(glDeleteQueries)
+	TRACE_DELETE_HOOK(glDeleteFramebuffers)
+	TRACE_DELETE_HOOK(glDeleteRenderbuffers)
+
+#undef TRACE_NAMES_HOOK
+#undef TRACE_DELETE_HOOK
+
+	TRACE_REAL(glBindBuffer)
+	static void APIENTRY record_glBindBuffer(GLenum target, GLuint buffer)
+	{
+		if (target == GL_PIXEL_PACK_BUFFER)
+			packBuffer = buffer;
+		writer.begin(id_glBindBuffer);
+		writer.put(target);
+		writer.put(buffer);
+		real_glBindBuffer(target, buffer);
+	}
+
+	TRACE_REAL(glCreateShader)
+	static GLuint APIENTRY record_glCreateShader(GLenum type)
+	{
+		GLuint shader = real_glCreateShader(type);
+		writer.begin(id_glCreateShader);
+		writer.put(type);
+		writer.put(shader);
+		return shader;
+	}
+
+	TRACE_REAL(glCreateProgram)
+	static GLuint APIENTRY record_glCreateProgram()
+	{
+		GLuint program = real_glCreateProgram();
+		writer.begin(id_glCreateProgram);
+		writer.put(program);
+		return program;
+	}
+
+	TRACE_REAL(glShaderSource)
+	static void APIENTRY record_glShaderSource(GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths)
+	{
+		writer.begin(id_glShaderSource);
+		writer.put(shader);
+		writer.put(count);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (lengths && lengths[i] >= 0)
+				writer.blob(strings[i], lengths[i]);
+			else
+				writer.string(strings[i]);
+		}
+		real_glShaderSource(shader, count, strings, lengths);
+	}
+
+	// Consultas: só os parâmetros de entrada; a resposta não é gravada
+	TRACE_REAL(glGetShaderiv)
+	static void APIENTRY record_glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
+	{
+		writer.begin(id_glGetShaderiv);
+		writer.put(shader);
+		writer.put(pname);
+		real_glGetShaderiv(shader, pname, params);
+	}
+
+	TRACE_REAL(glGetProgramiv)
+	static void APIENTRY record_glGetProgramiv(GLuint program, GLenum pname, GLint* params)
+	{
+		writer.begin(id_glGetProgramiv);
+		writer.put(program);
+		writer.put(pname);
+		real_glGetProgramiv(program, pname, params);
+	}
+
+	TRACE_REAL(glGetShaderInfoLog)
+	static void APIENTRY record_glGetShaderInfoLog(GLuint shader, GLsizei size, GLsizei* length, GLchar* log)
+	{
+		writer.begin(id_glGetShaderInfoLog);
+		writer.put(shader);
+		writer.put(size);
+		real_glGetShaderInfoLog(shader, size, length, log);
+	}
+
+	TRACE_REAL(glGetProgramInfoLog)
+	static void APIENTRY record_glGetProgramInfoLog(GLuint program, GLsizei size, GLsizei* length, GLchar* log)
+	{
+		writer.begin(id_glGetProgramInfoLog);
+		writer.put(program);
+		writer.put(size);
+		real_glGetProgramInfoLog(program, size, length, log);
+	}
+
+	TRACE_REAL(glGetActiveUniform)
+	static void APIENTRY record_glGetActiveUniform(GLuint program, GLuint index, GLsizei size, GLsizei* length, GLint* count, GLenum* type, GLchar* name)
+	{
+		writer.begin(id_glGetActiveUniform);
+		writer.put(program);
+		writer.put(index);
+		writer.put(size);
+		real_glGetActiveUniform(program, index, size, length, count, type, name);
+	}
+
+	TRACE_REAL(glGetIntegerv)
+	static void APIENTRY record_glGetIntegerv(GLenum pname, GLint* data)
+	{
+		writer.begin(id_glGetIntegerv);
+		writer.put(pname);
+		real_glGetIntegerv(pname, data);
+	}
+
+	TRACE_REAL(glGetInteger64v)
+	static void APIENTRY record_glGetInteger64v(GLenum pname, GLint64* data)
+	{
+		writer.begin(id_glGetInteger64v);
+		writer.put(pname);
+		real_glGetInteger64v(pname, data);
+	}
+
+	TRACE_REAL(glGetQueryObjectuiv)
+	static void APIENTRY record_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params)
+	{
+		writer.begin(id_glGetQueryObjectuiv);
+		writer.put(id);
+		writer.put(pname);
+		real_glGetQueryObjectuiv(id, pname, params);
+	}
+
+	TRACE_REAL(glGetQueryObjectui64v)
+	static void APIENTRY record_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64* params)
+	{
+		writer.begin(id_glGetQueryObjectui64v);
+		writer.put(id);
+		writer.put(pname);
+		real_glGetQueryObjectui64v(id, pname, params);
+	}
+
+	TRACE_REAL(glGetUniformLocation)
+	static GLint APIENTRY record_glGetUniformLocation(GLuint program, const GLchar* name)
+	{
+		GLint location = real_glGetUniformLocation(program, name);
+		writer.begin(id_glGetUniformLocation);
+		writer.put(program);
+		writer.string(name);
+		writer.put(location);
+		return location;
+	}
+
+	// Funções com nome de variável do shader: o nome vai como string
+	TRACE_REAL(glGetAttribLocation)
+	static GLint APIENTRY record_glGetAttribLocation(GLuint program, const GLchar* name)
+	{
+		writer.begin(id_glGetAttribLocation);
+		writer.put(program);
+		writer.string(name);
+		return real_glGetAttribLocation(program, name);
+	}
+
+	TRACE_REAL(glGetUniformBlockIndex)
+	static GLuint APIENTRY record_glGetUniformBlockIndex(GLuint program, const GLchar* name)
+	{
+		writer.begin(id_glGetUniformBlockIndex);
+		writer.put(program);
+		writer.string(name);
+		return real_glGetUniformBlockIndex(program, name);
+	}
+
+	TRACE_REAL(glBindAttribLocation)
+	static void APIENTRY record_glBindAttribLocation(GLuint program, GLuint index, const GLchar* name)
+	{
+		writer.begin(id_glBindAttribLocation);
+		writer.put(program);
+		writer.put(index);
+		writer.string(name);
+		real_glBindAttribLocation(program, index, name);
+	}
+
+	TRACE_REAL(glBindFragDataLocation)
+	static void APIENTRY record_glBindFragDataLocation(GLuint program, GLuint color, const GLchar* name)
+	{
+		writer.begin(id_glBindFragDataLocation);
+		writer.put(program);
+		writer.put(color);
+		writer.string(name);
+		real_glBindFragDataLocation(program, color, name);
+	}
+
+	TRACE_REAL(glUniformMatrix4fv)
+	static void APIENTRY record_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+	{
+		writer.begin(id_glUniformMatrix4fv);
+		writer.put(location);
+		writer.put(transpose);
+		writer.blob(value, sizeof(GLfloat) * 16 * count);
+		real_glUniformMatrix4fv(location, count, transpose, value);
+	}
+
+	TRACE_REAL(glUniform1fv)
+	static void APIENTRY record_glUniform1fv(GLint location, GLsizei count, const GLfloat* value)
+	{
+		writer.begin(id_glUniform1fv);
+		writer.put(location);
+		writer.blob(value, sizeof(GLfloat) * count);
+		real_glUniform1fv(location, count, value);
+	}
+
+	TRACE_REAL(glUniform4fv)
+	static void APIENTRY record_glUniform4fv(GLint location, GLsizei count, const GLfloat* value)
+	{
+		writer.begin(id_glUniform4fv);
+		writer.put(location);
+		writer.blob(value, sizeof(GLfloat) * 4 * count);
+		real_glUniform4fv(location, count, value);
+	}
+
+	TRACE_REAL(glBufferData)
+	static void APIENTRY record_glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		writer.begin(id_glBufferData);
+		writer.put(target);
+		writer.put((int64_t)size);
+		writer.put(usage);
+		writer.blob(data, data ? (size_t)size : 0);
+		real_glBufferData(target, size, data, usage);
+	}
+
+	TRACE_REAL(glBufferSubData)
+	static void APIENTRY record_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		writer.begin(id_glBufferSubData);
+		writer.put(target);
+		writer.put((int64_t)offset);
+		writer.blob(data, (size_t)size);
+		real_glBufferSubData(target, offset, size, data);
+	}
+
+	TRACE_REAL(glMapBufferRange)
+	static void* APIENTRY record_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		void* pointer = real_glMapBufferRange(target, offset, length, access);
+		MappedRange range;
+		range.pointer = pointer;
+		range.length = length;
+		range.access = access;
+		mapped[target] = range;
+		writer.begin(id_glMapBufferRange);
+		writer.put(target);
+		writer.put((int64_t)offset);
+		writer.put((int64_t)length);
+		writer.put(access);
+		return pointer;
+	}
+
+	// O conteúdo escrito no mapeamento vai junto com o glUnmapBuffer
+	TRACE_REAL(glUnmapBuffer)
+	static GLboolean APIENTRY record_glUnmapBuffer(GLenum target)
+	{
+		MappedRange range = mapped[target];
+		mapped.erase(target);
+		writer.begin(id_glUnmapBuffer);
+		writer.put(target);
+		bool written = range.pointer && (range.access & GL_MAP_WRITE_BIT);
+		writer.blob(range.pointer, written ? (size_t)range.length : 0);
+		return real_glUnmapBuffer(target);
+	}
+
+	TRACE_REAL(glFenceSync)
+	static GLsync APIENTRY record_glFenceSync(GLenum condition, GLbitfield flags)
+	{
+		GLsync sync = real_glFenceSync(condition, flags);
+		writer.begin(id_glFenceSync);
+		writer.put(condition);
+		writer.put(flags);
+		writer.pointer(sync);
+		return sync;
+	}
+
+	TRACE_REAL(glMultiDrawArrays)
+	static void APIENTRY record_glMultiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount)
+	{
+		writer.begin(id_glMultiDrawArrays);
+		writer.put(mode);
+		writer.blob(first, sizeof(GLint) * drawcount);
+		writer.blob(count, sizeof(GLsizei) * drawcount);
+		real_glMultiDrawArrays(mode, first, count, drawcount);
+	}
+
+	// Os índices vêm do EBO vinculado: os ponteiros são deslocamentos
+	TRACE_REAL(glMultiDrawElements)
+	static void APIENTRY record_glMultiDrawElements(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount)
+	{
+		writer.begin(id_glMultiDrawElements);
+		writer.put(mode);
+		writer.put(type);
+		writer.blob(count, sizeof(GLsizei) * drawcount);
+		std::vector<uint64_t> offsets(drawcount);
+		for (GLsizei i = 0; i < drawcount; ++i)
+			offsets[i] = (uint64_t)(uintptr_t)indices[i];
+		writer.blob(offsets.data(), sizeof(uint64_t) * drawcount);
+		real_glMultiDrawElements(mode, count, type, indices, drawcount);
+	}
+
+	// Com GL_PIXEL_PACK_BUFFER vinculado o ponteiro é um deslocamento; sem, é
+	// memória da aplicação (o reprodutor usa um buffer próprio)
+	TRACE_REAL(glReadPixels)
+	static void APIENTRY record_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
+	{
+		writer.begin(id_glReadPixels);
+		writer.put(x);
+		writer.put(y);
+		writer.put(width);
+		writer.put(height);
+		writer.put(format);
+		writer.put(type);
+		writer.put((uint8_t)(packBuffer != 0));
+		writer.pointer(pixels);
+		real_glReadPixels(x, y, width, height, format, type, pixels);
+	}
+
+#undef TRACE_REAL
+
+	// Carregador da AppWindow durante a gravação: só funções que passam pela GLAD
+	inline void* tracedProcLoader(const char* name)
+	{
+#define GL_FUNCTION(fn) if (strcmp(name, #fn) == 0) return realLoader(name);
+#include "GLFunctionList.h"
+#undef GL_FUNCTION
+		return NULL;
+	}
+}
+
+// Começa a gravação em path (chamar depois de instalar os outros ganchos, para
+// gravar as chamadas como o exercício as fez). Devolve o carregador que a
+// aplicação deve usar daqui em diante
+inline GLADloadproc startGLTrace(const std::string& path, int width, int height, GLADloadproc loader)
+{
+	using namespace gl_trace_detail;
+	if (!writer.open(path, width, height))
+	{
+		std::cout << "ERROR::GL_TRACE::CANNOT_WRITE_TRACE " << path << std::endl;
+		return loader;
+	}
+	realLoader = loader;
+
+#define TRACE_INSTALL(name) \
+	if (glad_##name) { real_##name = glad_##name; glad_##name = record_##name; handwritten[id_##name] = true; }
+
+	TRACE_INSTALL(glGenBuffers)
+	TRACE_INSTALL(glGenVertexArrays)
+	TRACE_INSTALL(glGenTextures)
+	TRACE_INSTALL(glGenQueries)
+	TRACE_INSTALL(glGenFramebuffers)
+	TRACE_INSTALL(glGenRenderbuffers)
+	TRACE_INSTALL(glDeleteBuffers)
+	TRACE_INSTALL(glDeleteVertexArrays)
+	TRACE_INSTALL(glDeleteTextures)
+	TRACE_INSTALL(glDeleteQueries)
+	TRACE_INSTALL(glDeleteFramebuffers)
+	TRACE_INSTALL(glDeleteRenderbuffers)
+	TRACE_INSTALL(glBindBuffer)
+	TRACE_INSTALL(glCreateShader)
+	TRACE_INSTALL(glCreateProgram)
+	TRACE_INSTALL(glShaderSource)
+	TRACE_INSTALL(glGetShaderiv)
+	TRACE_INSTALL(glGetProgramiv)
+	TRACE_INSTALL(glGetShaderInfoLog)
+	TRACE_INSTALL(glGetProgramInfoLog)
+	TRACE_INSTALL(glGetActiveUniform)
+	TRACE_INSTALL(glGetIntegerv)
+	TRACE_INSTALL(glGetInteger64v)
+	TRACE_INSTALL(glGetQueryObjectuiv)
+	TRACE_INSTALL(glGetQueryObjectui64v)
+	TRACE_INSTALL(glGetUniformLocation)
+	TRACE_INSTALL(glGetAttribLocation)
+	TRACE_INSTALL(glGetUniformBlockIndex)
+	TRACE_INSTALL(glBindAttribLocation)
+	TRACE_INSTALL(glBindFragDataLocation)
+	TRACE_INSTALL(glUniformMatrix4fv)
+	TRACE_INSTALL(glUniform1fv)
+	TRACE_INSTALL(glUniform4fv)
+	TRACE_INSTALL(glBufferData)
+	TRACE_INSTALL(glBufferSubData)
+	TRACE_INSTALL(glMapBufferRange)
+	TRACE_INSTALL(glUnmapBuffer)
+	TRACE_INSTALL(glFenceSync)
+	TRACE_INSTALL(glMultiDrawArrays)
+	TRACE_INSTALL(glMultiDrawElements)
+	TRACE_INSTALL(glReadPixels)
+#undef TRACE_INSTALL
+
+#define GL_FUNCTION(fn) \
+	if (glad_##fn && !handwritten[id_##fn]) GenericHook<decltype(glad_##fn), &glad_##fn>::install(id_##fn);
+#include "GLFunctionList.h"
+#undef GL_FUNCTION
+
+	return tracedProcLoader;
+}
+
+// Fim da preparação do exercício no trace (antes do primeiro frame)
+inline void recordGLTraceSetupDone()
+{
+	if (gl_trace_detail::writer.isOpen())
+		gl_trace_detail::writer.setupDone();
+}
+
+// Fim de um frame no trace (antes da troca de buffers)
+inline void recordGLTraceFrame()
+{
+	if (gl_trace_detail::writer.isOpen())
+		gl_trace_detail::writer.frame();
+}
+
+inline void finishGLTrace(std::ostream& out)
+{
+	using namespace gl_trace_detail;
+	if (!writer.isOpen())
+		return;
+	writer.close();
+	out << "GL trace: " << writer.getCalls() << " calls in " << writer.getFrames() << " frames, "
+		<< writer.getBytes() / 1024 << " KB" << std::endl;
+}
+
+// Reprodução de um trace gravado por startGLTrace
+class GLTraceReplayer
+{
+public:
+	// Lê o arquivo inteiro e associa cada função do trace a um reprodutor
+	bool load(const std::string& path)
+	{
+		FILE* file = fopen(path.c_str(), "rb");
+		if (!file)
+		{
+			std::cout << "ERROR::GL_REPLAY::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+			return false;
+		}
+		fseek(file, 0, SEEK_END);
+		data.resize((size_t)ftell(file));
+		fseek(file, 0, SEEK_SET);
+		bool ok = fread(data.data(), 1, data.size(), file) == data.size();
+		fclose(file);
+
+		if (!ok || data.size() < 26 || memcmp(data.data(), "GLTR", 4) != 0)
+		{
+			std::cout << "ERROR::GL_REPLAY::NOT_A_TRACE " << path << std::endl;
+			return false;
+		}
+		Reader r(data.data() + 4, data.data() + data.size() - 6);
+		if (r.get<uint32_t>() != gl_trace_detail::kVersion)
+		{
+			std::cout << "ERROR::GL_REPLAY::VERSION_MISMATCH " << path << std::endl;
+			return false;
+		}
+		traceWidth = (int)r.get<uint32_t>();
+		traceHeight = (int)r.get<uint32_t>();
+		uint32_t count = r.get<uint32_t>();
+		// Cada nome ocupa pelo menos os 4 bytes do tamanho
+		if (r.failed() || count > r.remaining() / sizeof(uint32_t))
+		{
+			std::cout << "ERROR::GL_REPLAY::TRUNCATED_TRACE " << path << std::endl;
+			return false;
+		}
+		functions.resize(count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			functions[i].name = r.string();
+			functions[i].player = findPlayer(functions[i].name);
+		}
+		if (r.failed())
+		{
+			std::cout << "ERROR::GL_REPLAY::TRUNCATED_TRACE " << path << std::endl;
+			return false;
+		}
+		records = r.position();
+
+		// Rodapé: marcador de fim + quantidade de frames
+		Reader footer(data.data() + data.size() - 6, data.data() + data.size());
+		if (footer.get<uint16_t>() != gl_trace_detail::kEndMarker)
+		{
+			std::cout << "ERROR::GL_REPLAY::TRUNCATED_TRACE " << path << std::endl;
+			return false;
+		}
+		frames = (int)footer.get<uint32_t>();
+		return true;
+	}
+
+	int width() const { return traceWidth; }
+	int height() const { return traceHeight; }
+	int frameCount() const { return frames; }
+
+	// Verdadeiro depois de um registro inválido ou incompleto
+	bool failed() const { return error; }
+
+	// Reproduz a preparação do exercício (shaders, geometria). Falso se o trace
+	// acabar antes do fim da preparação ou tiver um registro inválido
+	bool replaySetup()
+	{
+		// O framebuffer 0 do trace é o framebuffer em que a AppWindow desenha
+		GLint binding = 0;
+		glGetIntegerv(GL_FRAMEBUFFER_BINDING, &binding);
+		state().defaultFramebuffer = (GLuint)binding;
+		cursor = records;
+		return play();
+	}
+
+	// Reproduz as chamadas de um frame. Falso no fim do trace
+	bool replayFrame() { return play(); }
+
+	// Custo de cada função, da mais cara para a mais barata
+	void printStats(std::ostream& out) const
+	{
+		std::vector<const Function*> sorted;
+		for (size_t i = 0; i < functions.size(); ++i)
+		{
+			if (functions[i].calls)
+				sorted.push_back(&functions[i]);
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const Function* a, const Function* b) { return a->ms > b->ms; });
+		char line[160];
+		out << "Per-call cost:" << std::endl;
+		snprintf(line, sizeof(line), "  %-32s %10s %12s %10s", "function", "calls", "total ms", "avg us");
+		out << line << std::endl;
+		for (size_t i = 0; i < sorted.size(); ++i)
+		{
+			const Function& f = *sorted[i];
+			snprintf(line, sizeof(line), "  %-32s %10llu %12.3f %10.3f", f.name.c_str(), f.calls, f.ms, f.ms * 1000.0 / f.calls);
+			out << line << std::endl;
+		}
+	}
+
+private:
+	// Reproduz as chamadas até o próximo marcador (fim da preparação ou do frame)
+	// Um registro inválido ou incompleto para a reprodução com erro
+	bool play()
+	{
+		const unsigned char* end = data.data() + data.size() - 6;
+		Reader r(cursor, end);
+		while (!r.atEnd())
+		{
+			uint16_t index = r.get<uint16_t>();
+			if (index == gl_trace_detail::kFrameMarker || index == gl_trace_detail::kSetupMarker)
+			{
+				cursor = r.position();
+				return true;
+			}
+			if (index >= functions.size() || !functions[index].player)
+			{
+				std::cout << "ERROR::GL_REPLAY::UNKNOWN_FUNCTION "
+					<< (index < functions.size() ? functions[index].name : std::to_string(index)) << std::endl;
+				error = true;
+				cursor = end;
+				return false;
+			}
+			Function& f = functions[index];
+			auto start = std::chrono::steady_clock::now();
+			f.player(r);
+			f.ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			++f.calls;
+			if (r.failed())
+			{
+				std::cout << "ERROR::GL_REPLAY::TRUNCATED_RECORD " << f.name << std::endl;
+				error = true;
+				cursor = end;
+				return false;
+			}
+		}
+		cursor = end;
+		return false;
+	}
+
+	// Leitura sequencial de [begin, finish). Ler além do fim não sai da memória do
+	// trace: devolve zeros (blobs vazios) e marca failed()
+	class Reader
+	{
+	public:
+		Reader(const unsigned char* begin, const unsigned char* finish) : p(begin), end(finish) {}
+
+		bool atEnd() const { return p >= end; }
+		bool failed() const { return overrun; }
+		const unsigned char* position() const { return p; }
+		size_t remaining() const { return (size_t)(end - p); }
+
+		template <class T>
+		T get()
+		{
+			T value{};
+			if (remaining() < sizeof(T))
+			{
+				fail();
+				return value;
+			}
+			memcpy(&value, p, sizeof(T));
+			p += sizeof(T);
+			return value;
+		}
+
+		template <class T>
+		T arg()
+		{
+			if constexpr (std::is_pointer<T>::value)
+				return (T)(uintptr_t)get<uint64_t>();
+			else
+				return get<T>();
+		}
+
+		const void* blob(size_t* size)
+		{
+			*size = get<uint32_t>();
+			if (remaining() < *size)
+			{
+				fail();
+				*size = 0;
+			}
+			const void* bytes = p;
+			p += *size;
+			return bytes;
+		}
+
+		std::string string()
+		{
+			size_t size;
+			const char* s = (const char*)blob(&size);
+			return std::string(s, size);
+		}
+
+	private:
+		void fail()
+		{
+			overrun = true;
+			p = end;
+		}
+
+		const unsigned char* p;
+		const unsigned char* end;
+		bool overrun = false;
+	};
+
+	typedef void (*Player)(Reader&);
+
+	struct Function
+	{
+		std::string name;
+		Player player = NULL;
+		unsigned long long calls = 0;
+		double ms = 0.0;
+	};
+
+	// Nomes gravados -> nomes criados na reprodução
+	struct ReplayState
+	{
+		std::unordered_map<GLuint, GLuint> buffers, vertexArrays, textures, queries, framebuffers, renderbuffers, objects;
+		std::unordered_map<uint64_t, GLsync> syncs;
+		std::map<std::pair<GLuint, GLint>, GLint> locations; // (programa gravado, local gravado)
+		std::map<GLenum, void*> mapped;
+		GLuint program = 0;            // Programa em uso (nome gravado)
+		GLuint defaultFramebuffer = 0;
+		std::vector<unsigned char> scratch = std::vector<unsigned char>(1 << 16);
+	};
+
+	static ReplayState& state()
+	{
+		static ReplayState s;
+		return s;
+	}
+
+	static GLuint lookup(const std::unordered_map<GLuint, GLuint>& names, GLuint name)
+	{
+		auto it = names.find(name);
+		return it == names.end() ? name : it->second;
+	}
+
+	static GLint location(GLint recorded)
+	{
+		if (recorded < 0)
+			return recorded;
+		auto it = state().locations.find(std::make_pair(state().program, recorded));
+		return it == state().locations.end() ? recorded : it->second;
+	}
+
+	static GLchar* scratch() { return (GLchar*)state().scratch.data(); }
+
+	// Reprodutor genérico: lê os argumentos na ordem e chama o ponteiro atual da GLAD
+	template <class Proc, Proc* slot>
+	struct GenericPlayer;
+
+	template <class R, class... Args, R (APIENTRYP* slot)(Args...)>
+	struct GenericPlayer<R (APIENTRYP)(Args...), slot>
+	{
+		static void play(Reader& r)
+		{
+			std::tuple<Args...> args{ r.template arg<Args>()... };
+			std::apply(*slot, args);
+		}
+	};
+
+	// glGen*: cria a mesma quantidade e associa os nomes
+	template <void (APIENTRYP* slot)(GLsizei, GLuint*)>
+	static void playGen(Reader& r, std::unordered_map<GLuint, GLuint>& names)
+	{
+		size_t size;
+		const GLuint* recorded = (const GLuint*)r.blob(&size);
+		GLsizei n = (GLsizei)(size / sizeof(GLuint));
+		std::vector<GLuint> created(n);
+		(*slot)(n, created.data());
+		for (GLsizei i = 0; i < n; ++i)
+			names[recorded[i]] = created[i];
+	}
+
+	template <void (APIENTRYP* slot)(GLsizei, const GLuint*)>
+	static void playDelete(Reader& r, std::unordered_map<GLuint, GLuint>& names)
+	{
+		size_t size;
+		const GLuint* recorded = (const GLuint*)r.blob(&size);
+		GLsizei n = (GLsizei)(size / sizeof(GLuint));
+		std::vector<GLuint> current(n);
+		for (GLsizei i = 0; i < n; ++i)
+		{
+			current[i] = lookup(names, recorded[i]);
+			names.erase(recorded[i]);
+		}
+		(*slot)(n, current.data());
+	}
+
+	static Player findPlayer(const std::string& name)
+	{
+		static const std::unordered_map<std::string, Player> players = {
+			{ "glGenBuffers", [](Reader& r) { playGen<&glad_glGenBuffers>(r, state().buffers); } },
+			{ "glGenVertexArrays", [](Reader& r) { playGen<&glad_glGenVertexArrays>(r, state().vertexArrays); } },
+			{ "glGenTextures", [](Reader& r) { playGen<&glad_glGenTextures>(r, state().textures); } },
+			{ "glGenQueries", [](Reader& r) { playGen<&glad_glGenQueries>(r, state().queries); } },
+			{ "glGenFramebuffers", [](Reader& r) { playGen<&glad_glGenFramebuffers>(r, state().framebuffers); } },
+			{ "glGenRenderbuffers", [](Reader& r) { playGen<&glad_glGenRenderbuffers>(r, state().renderbuffers); } },
+			{ "glDeleteBuffers", [](Reader& r) { playDelete<&glad_glDeleteBuffers>(r, state().buffers); } },
+			{ "glDeleteVertexArrays", [](Reader& r) { playDelete<&glad_glDeleteVertexArrays>(r, state().vertexArrays); } },
+			{ "glDeleteTextures", [](Reader& r) { playDelete<&glad_glDeleteTextures>(r, state().textures); } },
+			{ "glDeleteQueries", [](Reader& r) { playDelete<&glad_glDeleteQueries>(r, state().queries); } },
+			{ "glDeleteFramebuffers", [](Reader& r) { playDelete<&glad_glDeleteFramebuffers>(r, state().framebuffers); } },
+			{ "glDeleteRenderbuffers", [](Reader& r) { playDelete<&glad_glDeleteRenderbuffers>(r, state().renderbuffers); } },
+			{ "glBindBuffer", [](Reader& r) { GLenum t = r.get<GLenum>(); glBindBuffer(t, lookup(state().buffers, r.get<GLuint>())); } },
+			{ "glBindVertexArray", [](Reader& r) { glBindVertexArray(lookup(state().vertexArrays, r.get<GLuint>())); } },
+			{ "glBindTexture", [](Reader& r) { GLenum t = r.get<GLenum>(); glBindTexture(t, lookup(state().textures, r.get<GLuint>())); } },
+			{ "glBindRenderbuffer", [](Reader& r) { GLenum t = r.get<GLenum>(); glBindRenderbuffer(t, lookup(state().renderbuffers, r.get<GLuint>())); } },
+			{ "glBindFramebuffer", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>();
+					GLuint f = r.get<GLuint>();
+					glBindFramebuffer(t, f ? lookup(state().framebuffers, f) : state().defaultFramebuffer);
+				} },
+			{ "glFramebufferRenderbuffer", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>(), a = r.get<GLenum>(), rt = r.get<GLenum>();
+					glFramebufferRenderbuffer(t, a, rt, lookup(state().renderbuffers, r.get<GLuint>()));
+				} },
+			{ "glBindBufferBase", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>();
+					GLuint index = r.get<GLuint>();
+					glBindBufferBase(t, index, lookup(state().buffers, r.get<GLuint>()));
+				} },
+			{ "glBindBufferRange", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>();
+					GLuint index = r.get<GLuint>();
+					GLuint buffer = lookup(state().buffers, r.get<GLuint>());
+					GLintptr offset = r.get<GLintptr>();
+					glBindBufferRange(t, index, buffer, offset, r.get<GLsizeiptr>());
+				} },
+			{ "glTexBuffer", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>(), format = r.get<GLenum>();
+					glTexBuffer(t, format, lookup(state().buffers, r.get<GLuint>()));
+				} },
+			{ "glFramebufferTexture", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>(), a = r.get<GLenum>();
+					GLuint texture = lookup(state().textures, r.get<GLuint>());
+					glFramebufferTexture(t, a, texture, r.get<GLint>());
+				} },
+			{ "glFramebufferTexture1D", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>(), a = r.get<GLenum>(), tt = r.get<GLenum>();
+					GLuint texture = lookup(state().textures, r.get<GLuint>());
+					glFramebufferTexture1D(t, a, tt, texture, r.get<GLint>());
+				} },
+			{ "glFramebufferTexture2D", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>(), a = r.get<GLenum>(), tt = r.get<GLenum>();
+					GLuint texture = lookup(state().textures, r.get<GLuint>());
+					glFramebufferTexture2D(t, a, tt, texture, r.get<GLint>());
+				} },
+			{ "glFramebufferTexture3D", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>(), a = r.get<GLenum>(), tt = r.get<GLenum>();
+					GLuint texture = lookup(state().textures, r.get<GLuint>());
+					GLint level = r.get<GLint>();
+					glFramebufferTexture3D(t, a, tt, texture, level, r.get<GLint>());
+				} },
+			{ "glFramebufferTextureLayer", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>(), a = r.get<GLenum>();
+					GLuint texture = lookup(state().textures, r.get<GLuint>());
+					GLint level = r.get<GLint>();
+					glFramebufferTextureLayer(t, a, texture, level, r.get<GLint>());
+				} },
+			{ "glBeginQuery", [](Reader& r) { GLenum t = r.get<GLenum>(); glBeginQuery(t, lookup(state().queries, r.get<GLuint>())); } },
+			{ "glBeginQueryIndexed", [](Reader& r)
+				{
+					GLenum t = r.get<GLenum>();
+					GLuint index = r.get<GLuint>();
+					glBeginQueryIndexed(t, index, lookup(state().queries, r.get<GLuint>()));
+				} },
+			{ "glBeginConditionalRender", [](Reader& r) { GLuint q = lookup(state().queries, r.get<GLuint>()); glBeginConditionalRender(q, r.get<GLenum>()); } },
+			{ "glIsBuffer", [](Reader& r) { glIsBuffer(lookup(state().buffers, r.get<GLuint>())); } },
+			{ "glIsVertexArray", [](Reader& r) { glIsVertexArray(lookup(state().vertexArrays, r.get<GLuint>())); } },
+			{ "glIsTexture", [](Reader& r) { glIsTexture(lookup(state().textures, r.get<GLuint>())); } },
+			{ "glIsQuery", [](Reader& r) { glIsQuery(lookup(state().queries, r.get<GLuint>())); } },
+			{ "glIsFramebuffer", [](Reader& r) { glIsFramebuffer(lookup(state().framebuffers, r.get<GLuint>())); } },
+			{ "glIsRenderbuffer", [](Reader& r) { glIsRenderbuffer(lookup(state().renderbuffers, r.get<GLuint>())); } },
+			{ "glIsProgram", [](Reader& r) { glIsProgram(lookup(state().objects, r.get<GLuint>())); } },
+			{ "glIsShader", [](Reader& r) { glIsShader(lookup(state().objects, r.get<GLuint>())); } },
+			{ "glUseProgram", [](Reader& r) { state().program = r.get<GLuint>(); glUseProgram(lookup(state().objects, state().program)); } },
+			{ "glCreateShader", [](Reader& r) { GLenum t = r.get<GLenum>(); state().objects[r.get<GLuint>()] = glCreateShader(t); } },
+			{ "glCreateProgram", [](Reader& r) { state().objects[r.get<GLuint>()] = glCreateProgram(); } },
+			{ "glDeleteShader", [](Reader& r) { glDeleteShader(lookup(state().objects, r.get<GLuint>())); } },
+			{ "glDeleteProgram", [](Reader& r) { glDeleteProgram(lookup(state().objects, r.get<GLuint>())); } },
+			{ "glAttachShader", [](Reader& r) { GLuint p = r.get<GLuint>(); glAttachShader(lookup(state().objects, p), lookup(state().objects, r.get<GLuint>())); } },
+			{ "glCompileShader", [](Reader& r) { glCompileShader(lookup(state().objects, r.get<GLuint>())); } },
+			{ "glLinkProgram", [](Reader& r) { glLinkProgram(lookup(state().objects, r.get<GLuint>())); } },
+			{ "glDetachShader", [](Reader& r) { GLuint p = r.get<GLuint>(); glDetachShader(lookup(state().objects, p), lookup(state().objects, r.get<GLuint>())); } },
+			{ "glValidateProgram", [](Reader& r) { glValidateProgram(lookup(state().objects, r.get<GLuint>())); } },
+			{ "glBindAttribLocation", [](Reader& r)
+				{
+					GLuint p = lookup(state().objects, r.get<GLuint>());
+					GLuint index = r.get<GLuint>();
+					std::string name = r.string();
+					glBindAttribLocation(p, index, name.c_str());
+				} },
+			{ "glBindFragDataLocation", [](Reader& r)
+				{
+					GLuint p = lookup(state().objects, r.get<GLuint>());
+					GLuint color = r.get<GLuint>();
+					std::string name = r.string();
+					glBindFragDataLocation(p, color, name.c_str());
+				} },
+			{ "glGetAttribLocation", [](Reader& r)
+				{
+					GLuint p = lookup(state().objects, r.get<GLuint>());
+					std::string name = r.string();
+					glGetAttribLocation(p, name.c_str());
+				} },
+			{ "glGetUniformBlockIndex", [](Reader& r)
+				{
+					GLuint p = lookup(state().objects, r.get<GLuint>());
+					std::string name = r.string();
+					glGetUniformBlockIndex(p, name.c_str());
+				} },
+			{ "glUniformBlockBinding", [](Reader& r)
+				{
+					GLuint p = lookup(state().objects, r.get<GLuint>());
+					GLuint index = r.get<GLuint>();
+					glUniformBlockBinding(p, index, r.get<GLuint>());
+				} },
+			{ "glShaderSource", [](Reader& r)
+				{
+					GLuint shader = lookup(state().objects, r.get<GLuint>());
+					GLsizei count = r.get<GLsizei>();
+					std::vector<const GLchar*> strings(count);
+					std::vector<GLint> lengths(count);
+					for (GLsizei i = 0; i < count; ++i)
+					{
+						size_t size;
+						strings[i] = (const GLchar*)r.blob(&size);
+						lengths[i] = (GLint)size;
+					}
+					glShaderSource(shader, count, strings.data(), lengths.data());
+				} },
+			{ "glGetShaderiv", [](Reader& r) { GLuint s = r.get<GLuint>(); glGetShaderiv(lookup(state().objects, s), r.get<GLenum>(), (GLint*)scratch()); } },
+			{ "glGetProgramiv", [](Reader& r) { GLuint p = r.get<GLuint>(); glGetProgramiv(lookup(state().objects, p), r.get<GLenum>(), (GLint*)scratch()); } },
+			{ "glGetShaderInfoLog", [](Reader& r)
+				{
+					GLuint s = r.get<GLuint>();
+					GLsizei size = std::min<GLsizei>(r.get<GLsizei>(), 1 << 15);
+					glGetShaderInfoLog(lookup(state().objects, s), size, NULL, scratch());
+				} },
+			{ "glGetProgramInfoLog", [](Reader& r)
+				{
+					GLuint p = r.get<GLuint>();
+					GLsizei size = std::min<GLsizei>(r.get<GLsizei>(), 1 << 15);
+					glGetProgramInfoLog(lookup(state().objects, p), size, NULL, scratch());
+				} },
+			{ "glGetActiveUniform", [](Reader& r)
+				{
+					GLuint p = r.get<GLuint>(), index = r.get<GLuint>();
+					GLsizei size = std::min<GLsizei>(r.get<GLsizei>(), 1 << 15);
+					GLint count;
+					GLenum type;
+					glGetActiveUniform(lookup(state().objects, p), index, size, NULL, &count, &type, scratch());
+				} },
+			{ "glGetIntegerv", [](Reader& r) { glGetIntegerv(r.get<GLenum>(), (GLint*)scratch()); } },
+			{ "glGetInteger64v", [](Reader& r) { glGetInteger64v(r.get<GLenum>(), (GLint64*)scratch()); } },
+			{ "glQueryCounter", [](Reader& r) { GLuint q = r.get<GLuint>(); glQueryCounter(lookup(state().queries, q), r.get<GLenum>()); } },
+			{ "glGetQueryObjectuiv", [](Reader& r) { GLuint q = r.get<GLuint>(); glGetQueryObjectuiv(lookup(state().queries, q), r.get<GLenum>(), (GLuint*)scratch()); } },
+			{ "glGetQueryObjectui64v", [](Reader& r) { GLuint q = r.get<GLuint>(); glGetQueryObjectui64v(lookup(state().queries, q), r.get<GLenum>(), (GLuint64*)scratch()); } },
+			{ "glGetUniformLocation", [](Reader& r)
+				{
+					GLuint p = r.get<GLuint>();
+					std::string name = r.string();
+					GLint recorded = r.get<GLint>();
+					state().locations[std::make_pair(p, recorded)] = glGetUniformLocation(lookup(state().objects, p), name.c_str());
+				} },
+			{ "glUniform1i", [](Reader& r) { GLint l = location(r.get<GLint>()); glUniform1i(l, r.get<GLint>()); } },
+			{ "glUniform1f", [](Reader& r) { GLint l = location(r.get<GLint>()); glUniform1f(l, r.get<GLfloat>()); } },
+			{ "glUniform2f", [](Reader& r)
+				{
+					GLint l = location(r.get<GLint>());
+					GLfloat x = r.get<GLfloat>(), y = r.get<GLfloat>();
+					glUniform2f(l, x, y);
+				} },
+			{ "glUniform3f", [](Reader& r)
+				{
+					GLint l = location(r.get<GLint>());
+					GLfloat x = r.get<GLfloat>(), y = r.get<GLfloat>(), z = r.get<GLfloat>();
+					glUniform3f(l, x, y, z);
+				} },
+			{ "glUniform4f", [](Reader& r)
+				{
+					GLint l = location(r.get<GLint>());
+					GLfloat x = r.get<GLfloat>(), y = r.get<GLfloat>(), z = r.get<GLfloat>(), w = r.get<GLfloat>();
+					glUniform4f(l, x, y, z, w);
+				} },
+			{ "glUniform1fv", [](Reader& r)
+				{
+					GLint l = location(r.get<GLint>());
+					size_t size;
+					const GLfloat* v = (const GLfloat*)r.blob(&size);
+					glUniform1fv(l, (GLsizei)(size / sizeof(GLfloat)), v);
+				} },
+			{ "glUniform4fv", [](Reader& r)
+				{
+					GLint l = location(r.get<GLint>());
+					size_t size;
+					const GLfloat* v = (const GLfloat*)r.blob(&size);
+					glUniform4fv(l, (GLsizei)(size / (4 * sizeof(GLfloat))), v);
+				} },
+			{ "glUniformMatrix4fv", [](Reader& r)
+				{
+					GLint l = location(r.get<GLint>());
+					GLboolean transpose = r.get<GLboolean>();
+					size_t size;
+					const GLfloat* v = (const GLfloat*)r.blob(&size);
+					glUniformMatrix4fv(l, (GLsizei)(size / (16 * sizeof(GLfloat))), transpose, v);
+				} },
+			{ "glBufferData", [](Reader& r)
+				{
+					GLenum target = r.get<GLenum>();
+					int64_t size = r.get<int64_t>();
+					GLenum usage = r.get<GLenum>();
+					size_t bytes;
+					const void* contents = r.blob(&bytes);
+					glBufferData(target, (GLsizeiptr)size, bytes ? contents : NULL, usage);
+				} },
+			{ "glBufferSubData", [](Reader& r)
+				{
+					GLenum target = r.get<GLenum>();
+					int64_t offset = r.get<int64_t>();
+					size_t bytes;
+					const void* contents = r.blob(&bytes);
+					glBufferSubData(target, (GLintptr)offset, (GLsizeiptr)bytes, contents);
+				} },
+			{ "glMapBufferRange", [](Reader& r)
+				{
+					GLenum target = r.get<GLenum>();
+					int64_t offset = r.get<int64_t>(), length = r.get<int64_t>();
+					GLbitfield access = r.get<GLbitfield>();
+					state().mapped[target] = glMapBufferRange(target, (GLintptr)offset, (GLsizeiptr)length, access);
+				} },
+			{ "glUnmapBuffer", [](Reader& r)
+				{
+					GLenum target = r.get<GLenum>();
+					size_t bytes;
+					const void* contents = r.blob(&bytes);
+					void* pointer = state().mapped[target];
+					if (pointer && bytes)
+						memcpy(pointer, contents, bytes);
+					state().mapped.erase(target);
+					glUnmapBuffer(target);
+				} },
+			{ "glFenceSync", [](Reader& r)
+				{
+					GLenum condition = r.get<GLenum>();
+					GLbitfield flags = r.get<GLbitfield>();
+					state().syncs[r.get<uint64_t>()] = glFenceSync(condition, flags);
+				} },
+			{ "glClientWaitSync", [](Reader& r)
+				{
+					GLsync sync = state().syncs[r.get<uint64_t>()];
+					GLbitfield flags = r.get<GLbitfield>();
+					glClientWaitSync(sync, flags, r.get<GLuint64>());
+				} },
+			{ "glDeleteSync", [](Reader& r)
+				{
+					uint64_t recorded = r.get<uint64_t>();
+					glDeleteSync(state().syncs[recorded]);
+					state().syncs.erase(recorded);
+				} },
+			{ "glMultiDrawArrays", [](Reader& r)
+				{
+					GLenum mode = r.get<GLenum>();
+					size_t firstBytes, countBytes;
+					const GLint* first = (const GLint*)r.blob(&firstBytes);
+					const GLsizei* count = (const GLsizei*)r.blob(&countBytes);
+					glMultiDrawArrays(mode, first, count, (GLsizei)std::min(firstBytes / sizeof(GLint), countBytes / sizeof(GLsizei)));
+				} },
+			{ "glMultiDrawElements", [](Reader& r)
+				{
+					GLenum mode = r.get<GLenum>(), type = r.get<GLenum>();
+					size_t countBytes, offsetBytes;
+					const GLsizei* count = (const GLsizei*)r.blob(&countBytes);
+					const uint64_t* offsets = (const uint64_t*)r.blob(&offsetBytes);
+					std::vector<const void*> indices(offsetBytes / sizeof(uint64_t));
+					for (size_t i = 0; i < indices.size(); ++i)
+						indices[i] = (const void*)(uintptr_t)offsets[i];
+					glMultiDrawElements(mode, count, type, indices.data(), (GLsizei)indices.size());
+				} },
+			{ "glReadPixels", [](Reader& r)
+				{
+					GLint x = r.get<GLint>(), y = r.get<GLint>();
+					GLsizei w = r.get<GLsizei>(), h = r.get<GLsizei>();
+					GLenum format = r.get<GLenum>(), type = r.get<GLenum>();
+					bool toBuffer = r.get<uint8_t>() != 0;
+					void* pixels = (void*)(uintptr_t)r.get<uint64_t>();
+					static std::vector<unsigned char> client;
+					if (!toBuffer)
+					{
+						client.resize((size_t)w * h * 16);
+						pixels = client.data();
+					}
+					glReadPixels(x, y, w, h, format, type, pixels);
+				} },
+		};
+		auto it = players.find(name);
+		if (it != players.end())
+			return it->second;
+
+		// Funções sem ponteiros (ou com deslocamentos) e sem nomes de objetos
+#define GL_FUNCTION(fn) if (name == #fn) return &GenericPlayer<decltype(glad_##fn), &glad_##fn>::play;
+#include "GLFunctionList.h"
+#undef GL_FUNCTION
+		return NULL;
+	}
+
+	std::vector<unsigned char> data;
+	std::vector<Function> functions;
+	const unsigned char* records = NULL;
+	const unsigned char* cursor = NULL;
+	int traceWidth = 0, traceHeight = 0, frames = 0;
+	bool error = false;
+};
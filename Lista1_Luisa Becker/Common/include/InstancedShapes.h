@@ -0,0 +1,214 @@
+// Desenho instanciado das formas de Shapes.h
+//
+// Cada tipo de forma (círculo, polígono, estrela, Pac-Man...) vira uma malha
+// unitária guardada uma única vez; a posição, escala, rotação e cor de cada
+// cópia ficam em um buffer de instâncias (glVertexAttribDivisor). Assim, dezenas
+// de milhares de formas custam uma chamada glDrawElementsInstanced por tipo,
+// em vez de um glUniform4f + glDrawArrays por forma.
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+//GLAD
+#include <glad/glad.h>
+
+#include "Shapes.h"
+
+// Dados de uma instância: 8 floats, lidos pelo vertex shader nos layouts 1 e 2
+struct ShapeInstance
+{
+	GLfloat x, y;         // Translação
+	GLfloat scale;        // Escala uniforme
+	GLfloat rotation;     // Rotação em radianos
+	GLfloat r, g, b, a;   // Cor
+};
+
+// Vertex shader das formas instanciadas: aplica escala, rotação e translação
+// da instância sobre a malha unitária e repassa a cor para o fragment shader
+const GLchar* const instancedVertexShaderSource = "#version 400\n"
+"layout (location = 0) in vec3 position;\n"
+"layout (location = 1) in vec4 instanceTransform;\n" // x, y, escala, rotação
+"layout (location = 2) in vec4 instanceColor;\n"
+"out vec4 vertexColor;\n"
+"void main()\n"
+"{\n"
+"float c = cos(instanceTransform.w);\n"
+"float s = sin(instanceTransform.w);\n"
+"vec2 p = mat2(c, s, -s, c) * (position.xy * instanceTransform.z) + instanceTransform.xy;\n"
+"gl_Position = vec4(p, position.z, 1.0);\n"
+"vertexColor = instanceColor;\n"
+"}\0";
+
+const GLchar* const instancedFragmentShaderSource = "#version 400\n"
+"in vec4 vertexColor;\n"
+"out vec4 color;\n"
+"void main()\n"
+"{\n"
+"color = vertexColor;\n"
+"}\n\0";
+
+class ShapeBatch
+{
+public:
+	// Registra um tipo de forma (a malha é gerada com os parâmetros de desc,
+	// normalmente com raio 1 e centro na origem) e retorna o seu índice
+	int addShape(const ShapeDesc& desc)
+	{
+		Kind kind;
+		kind.desc = desc;
+		kinds.push_back(kind);
+		return (int)kinds.size() - 1;
+	}
+
+	void addInstance(int shape, const ShapeInstance& instance)
+	{
+		kinds[shape].instances.push_back(instance);
+	}
+
+	// Acesso direto às instâncias de um tipo (para animar e chamar updateInstances)
+	std::vector<ShapeInstance>& instances(int shape)
+	{
+		return kinds[shape].instances;
+	}
+
+	GLsizei instanceCount() const
+	{
+		GLsizei total = 0;
+		for (size_t i = 0; i < kinds.size(); ++i)
+			total += (GLsizei)kinds[i].instances.size();
+		return total;
+	}
+
+	// Chamadas de desenho por frame: uma por tipo que tenha instâncias
+	GLsizei drawCalls() const
+	{
+		GLsizei calls = 0;
+		for (size_t i = 0; i < kinds.size(); ++i)
+			calls += kinds[i].instances.empty() ? 0 : 1;
+		return calls;
+	}
+
+	// Cria VAO, VBO das malhas, EBO e buffer de instâncias
+	// Todas as malhas ficam no mesmo VBO/EBO, uma depois da outra
+	void upload()
+	{
+		GLuint totalVertices = 0, totalIndices = 0;
+		for (size_t i = 0; i < kinds.size(); ++i)
+		{
+			kinds[i].baseVertex = totalVertices;
+			kinds[i].firstIndex = totalIndices;
+			kinds[i].indexCount = (GLsizei)shapeIndexCount(kinds[i].desc);
+			kinds[i].mode = shapePrimitive(kinds[i].desc);
+			totalVertices += shapeVertexCount(kinds[i].desc);
+			totalIndices += shapeIndexCount(kinds[i].desc);
+		}
+
+		glGenVertexArrays(1, &VAO);
+		glBindVertexArray(VAO);
+
+		// Malhas unitárias
+		GLsizeiptr vertexBytes = (GLsizeiptr)totalVertices * 3 * sizeof(GLfloat);
+		glGenBuffers(1, &VBO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBufferData(GL_ARRAY_BUFFER, vertexBytes, NULL, GL_STATIC_DRAW);
+		GLfloat* vertices = (GLfloat*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vertexBytes,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		for (size_t i = 0; i < kinds.size(); ++i)
+			writeShapeVertices(kinds[i].desc, vertices + (size_t)kinds[i].baseVertex * 3);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
+		glEnableVertexAttribArray(0);
+
+		GLsizeiptr indexBytes = (GLsizeiptr)totalIndices * sizeof(GLuint);
+		glGenBuffers(1, &EBO);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, NULL, GL_STATIC_DRAW);
+		GLuint* indices = (GLuint*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indexBytes,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+		for (size_t i = 0; i < kinds.size(); ++i)
+			writeShapeIndices(kinds[i].desc, indices + kinds[i].firstIndex, kinds[i].baseVertex);
+		glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+
+		// Instâncias: os atributos 1 e 2 avançam uma vez por instância
+		glGenBuffers(1, &instanceVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glEnableVertexAttribArray(1);
+		glVertexAttribDivisor(1, 1);
+		glEnableVertexAttribArray(2);
+		glVertexAttribDivisor(2, 1);
+		updateInstances(GL_STATIC_DRAW);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindVertexArray(0);
+	}
+
+	// Reenvia todas as instâncias (depois de alterar instances(...))
+	void updateInstances(GLenum usage = GL_DYNAMIC_DRAW)
+	{
+		GLuint total = 0;
+		for (size_t i = 0; i < kinds.size(); ++i)
+		{
+			kinds[i].firstInstance = total;
+			total += (GLuint)kinds[i].instances.size();
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		GLsizeiptr bytes = (GLsizeiptr)total * sizeof(ShapeInstance);
+		glBufferData(GL_ARRAY_BUFFER, bytes, NULL, usage);
+		if (bytes > 0)
+		{
+			ShapeInstance* dst = (ShapeInstance*)glMapBufferRange(GL_ARRAY_BUFFER, 0, bytes,
+				GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+			for (size_t i = 0; i < kinds.size(); ++i)
+				std::copy(kinds[i].instances.begin(), kinds[i].instances.end(), dst + kinds[i].firstInstance);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+	}
+
+	// Desenha todas as instâncias: uma chamada glDrawElementsInstanced por tipo
+	// O programa de shader (instancedVertexShaderSource) precisa estar em uso
+	void draw() const
+	{
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		for (size_t i = 0; i < kinds.size(); ++i)
+		{
+			const Kind& kind = kinds[i];
+			if (kind.instances.empty())
+				continue;
+			// Sem glDrawElementsInstancedBaseInstance na OpenGL 4.0: os ponteiros
+			// de instância são apontados para o primeiro elemento do tipo
+			GLsizeiptr offset = (GLsizeiptr)kind.firstInstance * sizeof(ShapeInstance);
+			glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(ShapeInstance), (GLvoid*)offset);
+			glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(ShapeInstance), (GLvoid*)(offset + 4 * sizeof(GLfloat)));
+			glDrawElementsInstanced(kind.mode, kind.indexCount, GL_UNSIGNED_INT,
+				(GLvoid*)(kind.firstIndex * sizeof(GLuint)), (GLsizei)kind.instances.size());
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindVertexArray(0);
+	}
+
+	void release()
+	{
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+		glDeleteBuffers(1, &EBO);
+		glDeleteBuffers(1, &instanceVBO);
+		VAO = VBO = EBO = instanceVBO = 0;
+	}
+
+private:
+	struct Kind
+	{
+		ShapeDesc desc;
+		std::vector<ShapeInstance> instances;
+		GLuint baseVertex = 0, firstIndex = 0, firstInstance = 0;
+		GLsizei indexCount = 0;
+		GLenum mode = GL_TRIANGLES;
+	};
+
+	std::vector<Kind> kinds;
+	GLuint VAO = 0, VBO = 0, EBO = 0, instanceVBO = 0;
+};
@@ -0,0 +1,253 @@
+// Otimização de malhas: vértices únicos, buffer de índices e ordem amigável ao cache
+//
+// Geometria desenhada com glDrawArrays repete vértices (o mesmo canto em duas
+// linhas, o mesmo ponto em dois triângulos) e cada cópia passa pelo vertex shader.
+// As funções daqui trabalham sobre vértices de floats intercalados:
+//   - generateIndexBuffer(): acha os vértices iguais (tabela hash sobre os bits dos
+//     floats) e devolve, para cada vértice de entrada, o índice do vértice único;
+//     esse remapeamento já é o buffer de índices da malha original
+//   - remapVertexBuffer(): escreve os vértices únicos
+//   - optimizeVertexCache(): reordena os triângulos para reaproveitar o cache de
+//     vértices transformados da GPU (Tipsify, Sander, Nehab e Barczak 2007): os
+//     triângulos saem em leques em volta de um vértice e o próximo vértice é o que
+//     ainda está no cache e tem mais triângulos pendentes. Linear no número de
+//     triângulos. Muda a ordem de desenho dos triângulos, então só use quando eles
+//     não se sobrepõem (ou com teste de profundidade)
+//   - optimizeVertexFetch(): reordena os vértices na ordem do primeiro uso, para
+//     que a leitura do VBO seja quase sequencial
+//   - analyzeVertexCache(): simula um cache FIFO de cacheSize vértices e conta
+//     quantas vezes o vertex shader roda; ACMR (vértices transformados por
+//     triângulo) vai de 3 (nenhum reuso) até perto de 0.5 em grades regulares
+
+#pragma once
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+//GLAD
+#include <glad/glad.h>
+
+// Cache de vértices transformados típico das GPUs
+const unsigned kVertexCacheSize = 16;
+
+struct VertexCacheStats
+{
+	size_t indices = 0;
+	size_t transformed = 0; // Execuções do vertex shader (faltas no cache)
+	float acmr = 0.0f;      // transformed por triângulo (indices / 3)
+	float atvr = 0.0f;      // transformed por vértice único
+};
+
+namespace mesh_optimizer_detail
+{
+	// Bits de um float com -0 igual a +0, para comparar e espalhar vértices
+	inline uint32_t floatBits(GLfloat value)
+	{
+		value += 0.0f;
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+
+	inline uint32_t hashVertex(const GLfloat* v, GLuint floats)
+	{
+		// FNV-1a sobre as palavras de 32 bits
+		uint32_t hash = 2166136261u;
+		for (GLuint i = 0; i < floats; ++i)
+			hash = (hash ^ floatBits(v[i])) * 16777619u;
+		return hash ^ (hash >> 15);
+	}
+
+	inline bool equalVertex(const GLfloat* a, const GLfloat* b, GLuint floats)
+	{
+		for (GLuint i = 0; i < floats; ++i)
+		{
+			if (floatBits(a[i]) != floatBits(b[i]))
+				return false;
+		}
+		return true;
+	}
+}
+
+// Acha os vértices repetidos entre count vértices de floatsPerVertex floats.
+// remap[i] recebe o índice do vértice único de i (os únicos ficam na ordem do
+// primeiro aparecimento). Devolve o número de vértices únicos
+inline size_t generateIndexBuffer(const GLfloat* vertices, size_t count, GLuint floatsPerVertex, GLuint* remap)
+{
+	using namespace mesh_optimizer_detail;
+	// Endereçamento aberto com sondagem linear, ocupação de no máximo 50%
+	size_t tableSize = 16;
+	while (tableSize < count * 2)
+		tableSize *= 2;
+	const GLuint kEmpty = ~0u;
+	std::vector<GLuint> table(tableSize, kEmpty); // Vértice de entrada que representa o único
+
+	size_t unique = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const GLfloat* v = vertices + i * floatsPerVertex;
+		size_t slot = hashVertex(v, floatsPerVertex) & (tableSize - 1);
+		while (table[slot] != kEmpty && !equalVertex(vertices + (size_t)table[slot] * floatsPerVertex, v, floatsPerVertex))
+			slot = (slot + 1) & (tableSize - 1);
+		if (table[slot] == kEmpty)
+		{
+			table[slot] = (GLuint)i;
+			remap[i] = (GLuint)unique++;
+		}
+		else
+			remap[i] = remap[table[slot]];
+	}
+	return unique;
+}
+
+// Escreve em dst os vértices únicos de src segundo remap (de generateIndexBuffer)
+inline void remapVertexBuffer(GLfloat* dst, const GLfloat* src, size_t count, GLuint floatsPerVertex, const GLuint* remap)
+{
+	for (size_t i = 0; i < count; ++i)
+		memcpy(dst + (size_t)remap[i] * floatsPerVertex, src + i * floatsPerVertex, floatsPerVertex * sizeof(GLfloat));
+}
+
+// Simula o cache FIFO e conta as execuções do vertex shader para os índices
+inline VertexCacheStats analyzeVertexCache(const GLuint* indices, size_t indexCount, size_t vertexCount,
+	unsigned cacheSize = kVertexCacheSize)
+{
+	VertexCacheStats stats;
+	stats.indices = indexCount;
+	// Momento em que cada vértice entrou no cache; está no cache se entrou há menos de cacheSize faltas
+	std::vector<size_t> entered(vertexCount, 0);
+	size_t time = cacheSize + 1;
+	for (size_t i = 0; i < indexCount; ++i)
+	{
+		GLuint v = indices[i];
+		if (time - entered[v] > cacheSize)
+		{
+			entered[v] = time++;
+			++stats.transformed;
+		}
+	}
+	stats.acmr = indexCount >= 3 ? (float)stats.transformed / (float)(indexCount / 3) : 0.0f;
+	stats.atvr = vertexCount ? (float)stats.transformed / (float)vertexCount : 0.0f;
+	return stats;
+}
+
+// Reordena os triângulos (indexCount / 3) para o cache de vértices (Tipsify)
+// dst pode ser o próprio indices
+inline void optimizeVertexCache(GLuint* dst, const GLuint* indices, size_t indexCount, size_t vertexCount,
+	unsigned cacheSize = kVertexCacheSize)
+{
+	size_t triangleCount = indexCount / 3;
+	if (triangleCount == 0)
+		return;
+
+	// Triângulos de cada vértice
+	std::vector<GLuint> offsets(vertexCount + 1, 0);
+	for (size_t i = 0; i < triangleCount * 3; ++i)
+		++offsets[indices[i] + 1];
+	for (size_t v = 0; v < vertexCount; ++v)
+		offsets[v + 1] += offsets[v];
+	std::vector<GLuint> adjacency(triangleCount * 3);
+	std::vector<GLuint> fill(offsets.begin(), offsets.end() - 1);
+	for (size_t i = 0; i < triangleCount * 3; ++i)
+		adjacency[fill[indices[i]]++] = (GLuint)(i / 3);
+
+	std::vector<GLuint> live(vertexCount); // Triângulos ainda não emitidos de cada vértice
+	for (size_t v = 0; v < vertexCount; ++v)
+		live[v] = offsets[v + 1] - offsets[v];
+
+	std::vector<GLuint> result;
+	result.reserve(triangleCount * 3);
+	std::vector<size_t> cacheTime(vertexCount, 0);
+	std::vector<char> emitted(triangleCount, 0);
+	std::vector<GLuint> deadEnd;     // Vértices recém-usados, para recomeçar quando o leque trava
+	std::vector<GLuint> candidates;
+	size_t time = cacheSize + 1;
+	size_t cursor = 0;               // Próximo vértice a testar quando tudo mais falhar
+	long fan = indices[0];
+
+	while (fan >= 0)
+	{
+		// Emite todos os triângulos pendentes em volta do vértice do leque
+		candidates.clear();
+		for (GLuint a = offsets[fan]; a < offsets[fan + 1]; ++a)
+		{
+			GLuint t = adjacency[a];
+			if (emitted[t])
+				continue;
+			emitted[t] = 1;
+			for (int k = 0; k < 3; ++k)
+			{
+				GLuint v = indices[t * 3 + k];
+				result.push_back(v);
+				deadEnd.push_back(v);
+				candidates.push_back(v);
+				--live[v];
+				if (time - cacheTime[v] > cacheSize)
+					cacheTime[v] = time++;
+			}
+		}
+
+		// Próximo leque: o candidato que continua no cache depois dos seus triângulos
+		// pendentes serem emitidos e que está há mais tempo nele
+		long best = -1;
+		size_t bestPriority = 0;
+		for (GLuint v : candidates)
+		{
+			if (live[v] == 0)
+				continue;
+			size_t priority = 0;
+			if (time - cacheTime[v] + 2 * live[v] <= cacheSize)
+				priority = time - cacheTime[v];
+			if (best < 0 || priority > bestPriority)
+			{
+				best = v;
+				bestPriority = priority;
+			}
+		}
+		if (best < 0)
+		{
+			// Sem candidatos: volta pela pilha de vértices recentes e depois pela ordem de entrada
+			while (!deadEnd.empty() && best < 0)
+			{
+				GLuint v = deadEnd.back();
+				deadEnd.pop_back();
+				if (live[v] > 0)
+					best = v;
+			}
+			while (best < 0 && cursor < vertexCount)
+			{
+				if (live[cursor] > 0)
+					best = (long)cursor;
+				++cursor;
+			}
+		}
+		fan = best;
+	}
+	memcpy(dst, result.data(), result.size() * sizeof(GLuint));
+}
+
+// Reordena vertexCount vértices na ordem em que os índices os usam pela primeira vez
+// e atualiza os índices. Vértices não usados vão para o fim. Devolve os vértices usados
+inline size_t optimizeVertexFetch(GLfloat* vertices, size_t vertexCount, GLuint floatsPerVertex,
+	GLuint* indices, size_t indexCount)
+{
+	const GLuint kUnused = ~0u;
+	std::vector<GLuint> order(vertexCount, kUnused);
+	size_t used = 0;
+	for (size_t i = 0; i < indexCount; ++i)
+	{
+		if (order[indices[i]] == kUnused)
+			order[indices[i]] = (GLuint)used++;
+		indices[i] = order[indices[i]];
+	}
+	size_t next = used;
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		if (order[v] == kUnused)
+			order[v] = (GLuint)next++;
+	}
+	std::vector<GLfloat> copy(vertices, vertices + vertexCount * floatsPerVertex);
+	for (size_t v = 0; v < vertexCount; ++v)
+		memcpy(vertices + (size_t)order[v] * floatsPerVertex, copy.data() + v * floatsPerVertex, floatsPerVertex * sizeof(GLfloat));
+	return used;
+}
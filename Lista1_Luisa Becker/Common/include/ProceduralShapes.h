@@ -0,0 +1,158 @@
+// Formas procedurais: a geometria é gerada no vertex shader a partir de
+// gl_VertexID e gl_InstanceID, sem nenhum VBO
+//
+// Os parâmetros de Shapes.h (ShapeDesc) viram alguns uniforms; o shader
+// calcula cada vértice do polígono, setor, estrela ou espiral, e também as
+// linhas da grade do Ex9. A chamada de desenho usa um VAO vazio (nenhum
+// atributo habilitado), então não há memória de vértices nem envio de dados.
+// As formas com preenchimento são desenhadas como GL_TRIANGLES não indexados
+// (3 vértices por segmento); as cópias de uma mesma forma podem ser
+// distribuídas em uma grade com gl_InstanceID.
+
+#pragma once
+
+//GLAD
+#include <glad/glad.h>
+
+#include "Shapes.h"
+
+// Valores do uniform shapeKind (os quatro primeiros seguem ShapeType)
+const GLint kProceduralPolygon = 0, kProceduralSector = 1, kProceduralStar = 2,
+	kProceduralSpiral = 3, kProceduralGrid = 4;
+
+// Vertex shader procedural
+// shapeParams: polígono, setor e estrela = (raio, raio interno, ângulo inicial, ângulo final)
+//              espiral = (a, b, -, ângulo final)
+//              grade   = (início, espaçamento, comprimento, -)
+// instanceGrid: (colunas, deslocamento x, deslocamento y) entre as instâncias
+const GLchar* const proceduralVertexShaderSource = "#version 400\n"
+"uniform int shapeKind;\n"
+"uniform int segments;\n"
+"uniform vec4 shapeParams;\n"
+"uniform vec2 shapeCenter;\n"
+"uniform vec3 instanceGrid;\n"
+"vec2 rimPoint(int k)\n"
+"{\n"
+"float step = shapeKind == 1 ? (shapeParams.w - shapeParams.z) / float(segments) : 6.28318530718 / float(segments);\n"
+"float angle = shapeParams.z + step * float(k);\n"
+"float r = (shapeKind == 2 && (k & 1) == 1) ? shapeParams.y : shapeParams.x;\n"
+"return r * vec2(cos(angle), sin(angle));\n"
+"}\n"
+"void main()\n"
+"{\n"
+"vec2 p = vec2(0.0);\n"
+"if (shapeKind == 4)\n"
+"{\n"
+// Grade: 4 vértices por posição i - linha vertical e linha horizontal
+"float c = shapeParams.x + shapeParams.y * float(gl_VertexID / 4);\n"
+"int v = gl_VertexID % 4;\n"
+"float e = (v & 1) == 0 ? shapeParams.x : shapeParams.x + shapeParams.z;\n"
+"p = v < 2 ? vec2(c, e) : vec2(e, c);\n"
+"}\n"
+"else if (shapeKind == 3)\n"
+"{\n"
+// Espiral r = a + b * theta: um vértice por ponto da line strip
+"float t = segments > 1 ? shapeParams.w * float(gl_VertexID) / float(segments - 1) : 0.0;\n"
+"p = (shapeParams.x + shapeParams.y * t) * vec2(cos(t), sin(t));\n"
+"}\n"
+"else\n"
+"{\n"
+// Triângulo (centro, i, i + 1); o polígono e a estrela fecham no ponto 0
+"int corner = gl_VertexID % 3;\n"
+"int k = gl_VertexID / 3 + corner - 1;\n"
+"if (shapeKind != 1 && k == segments) k = 0;\n"
+"if (corner != 0) p = rimPoint(k);\n"
+"}\n"
+"int columns = max(int(instanceGrid.x), 1);\n"
+"p += shapeCenter + vec2(gl_InstanceID % columns, gl_InstanceID / columns) * instanceGrid.yz;\n"
+"gl_Position = vec4(p, 0.0, 1.0);\n"
+"}\0";
+
+// Fragment shader com a cor do uniform inputColor, como nos exercícios
+const GLchar* const proceduralFragmentShaderSource = "#version 400\n"
+"uniform vec4 inputColor;\n"
+"out vec4 color;\n"
+"void main()\n"
+"{\n"
+"color = inputColor;\n"
+"}\n\0";
+
+// Programa procedural já linkado, com as posições dos uniforms e o VAO vazio
+struct ProceduralProgram
+{
+	GLuint program = 0;
+	GLuint emptyVAO = 0;
+	GLint kindLoc = -1, segmentsLoc = -1, paramsLoc = -1, centerLoc = -1;
+	GLint instanceGridLoc = -1, colorLoc = -1;
+};
+
+// Recebe o programa compilado com proceduralVertexShaderSource e
+// proceduralFragmentShaderSource (pela setupShader do exercício)
+inline ProceduralProgram setupProceduralProgram(GLuint program)
+{
+	ProceduralProgram p;
+	p.program = program;
+	p.kindLoc = glGetUniformLocation(program, "shapeKind");
+	p.segmentsLoc = glGetUniformLocation(program, "segments");
+	p.paramsLoc = glGetUniformLocation(program, "shapeParams");
+	p.centerLoc = glGetUniformLocation(program, "shapeCenter");
+	p.instanceGridLoc = glGetUniformLocation(program, "instanceGrid");
+	p.colorLoc = glGetUniformLocation(program, "inputColor");
+	// O perfil core exige um VAO vinculado, mesmo sem atributos
+	glGenVertexArrays(1, &p.emptyVAO);
+	return p;
+}
+
+// Vértices gerados para a forma: 3 por segmento, ou 1 por ponto da espiral
+inline GLsizei proceduralVertexCount(const ShapeDesc& d)
+{
+	return (GLsizei)shapeIndexCount(d);
+}
+
+// Desenha a forma sem VBO. Com instances > 1, as cópias ficam em uma grade de
+// columns colunas, deslocadas (dx, dy) umas das outras
+// O programa procedural precisa estar em uso (glUseProgram)
+inline void drawProceduralShape(const ProceduralProgram& p, const ShapeDesc& d,
+	GLsizei instances = 1, int columns = 1, float dx = 0.0f, float dy = 0.0f)
+{
+	GLint kind = d.type == ShapeType::Polygon ? kProceduralPolygon
+		: d.type == ShapeType::Sector ? kProceduralSector
+		: d.type == ShapeType::Star ? kProceduralStar
+		: kProceduralSpiral;
+	glUniform1i(p.kindLoc, kind);
+	glUniform1i(p.segmentsLoc, (GLint)d.segments);
+	if (kind == kProceduralSpiral)
+		glUniform4f(p.paramsLoc, d.a, d.b, 0.0f, d.endAngle);
+	else
+		glUniform4f(p.paramsLoc, d.radius, d.innerRadius, d.startAngle, d.endAngle);
+	glUniform2f(p.centerLoc, d.cx, d.cy);
+	glUniform3f(p.instanceGridLoc, (GLfloat)columns, dx, dy);
+
+	glBindVertexArray(p.emptyVAO);
+	if (instances > 1)
+		glDrawArraysInstanced(shapePrimitive(d), 0, proceduralVertexCount(d), instances);
+	else
+		glDrawArrays(shapePrimitive(d), 0, proceduralVertexCount(d));
+	glBindVertexArray(0);
+}
+
+// Grade quadriculada: lines linhas em cada direção, a primeira em start, com o
+// espaçamento step e comprimento length (a grade do Ex9: 21, -1.0, 0.1, 2.0)
+inline void drawProceduralGrid(const ProceduralProgram& p, int lines, float start, float step, float length)
+{
+	glUniform1i(p.kindLoc, kProceduralGrid);
+	glUniform4f(p.paramsLoc, start, step, length, 0.0f);
+	glUniform2f(p.centerLoc, 0.0f, 0.0f);
+	glUniform3f(p.instanceGridLoc, 1.0f, 0.0f, 0.0f);
+
+	glBindVertexArray(p.emptyVAO);
+	glDrawArrays(GL_LINES, 0, lines * 4);
+	glBindVertexArray(0);
+}
+
+inline void deleteProceduralProgram(ProceduralProgram& p)
+{
+	glDeleteVertexArrays(1, &p.emptyVAO);
+	glDeleteProgram(p.program);
+	p = ProceduralProgram();
+}
@@ -0,0 +1,288 @@
+// Medição de tempo de CPU e de GPU por trecho, exportada como trace do Chrome
+//
+// Trechos de CPU: ProfileScope mede do construtor ao destrutor com
+// std::chrono::steady_clock. Trechos de GPU: GpuProfileScope grava um
+// glQueryCounter(GL_TIMESTAMP) no início e outro no fim, e o frame inteiro é
+// medido da mesma forma. Timestamps, ao contrário de GL_TIME_ELAPSED, podem ser
+// aninhados (o frame contém os grupos de desenho). Os resultados da GPU chegam alguns
+// frames depois; as consultas ficam em kProfilerFrames conjuntos (triple
+// buffering) e os resultados de um conjunto só são lidos quando ele vai ser
+// reaproveitado, três frames depois - se ainda não estiverem prontos, o frame é
+// descartado em vez de travar a CPU esperando a GPU.
+//
+// O arquivo gerado (--trace ARQ.json na linha de comando) segue o formato de
+// eventos do Chrome: abra em chrome://tracing ou https://ui.perfetto.dev. A CPU
+// e a GPU aparecem como duas linhas; os tempos da GPU são convertidos para o
+// relógio da CPU por uma leitura de GL_TIMESTAMP feita na inicialização.
+//
+// Sem --trace os escopos só testam uma flag e não fazem nada.
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+// Conjuntos de consultas da GPU em uso ao mesmo tempo
+const int kProfilerFrames = 3;
+
+class Profiler
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	// Liga a medição e guarda o caminho do trace (o contexto precisa estar ativo)
+	// Os tempos do trace começam em start (o início do programa)
+	void init(const std::string& path, Clock::time_point start)
+	{
+		tracePath = path;
+		enabled = !tracePath.empty();
+		if (!enabled)
+			return;
+		origin = start;
+		// Calibração: mesmo instante no relógio da GPU e no da CPU
+		GLint64 gpuNow = 0;
+		glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+		gpuOrigin = gpuNow;
+		gpuOriginUs = microseconds(Clock::now());
+	}
+
+	bool isEnabled() const { return enabled; }
+
+	// Trecho de CPU já medido (begin e end do steady_clock)
+	void cpuEvent(const char* name, Clock::time_point begin, Clock::time_point end)
+	{
+		if (!enabled || events.size() >= kMaxEvents)
+			return;
+		Event e;
+		e.name = name;
+		e.thread = kCpuThread;
+		e.begin = microseconds(begin);
+		e.duration = microseconds(end) - e.begin;
+		events.push_back(e);
+	}
+
+	// Início de um trecho de GPU; devolve o índice usado em endGpu()
+	int beginGpu(const char* name)
+	{
+		if (!enabled)
+			return -1;
+		Slot& slot = slots[frame % kProfilerFrames];
+		GpuRange range;
+		range.name = name;
+		range.begin = query(slot, slot.used++);
+		range.end = query(slot, slot.used++);
+		glQueryCounter(range.begin, GL_TIMESTAMP);
+		slot.ranges.push_back(range);
+		return (int)slot.ranges.size() - 1;
+	}
+
+	void endGpu(int index)
+	{
+		if (index < 0)
+			return;
+		glQueryCounter(slots[frame % kProfilerFrames].ranges[index].end, GL_TIMESTAMP);
+	}
+
+	// Começo do frame: lê os resultados do conjunto que vai ser reaproveitado e
+	// abre o trecho de GPU do frame
+	void beginFrame()
+	{
+		if (!enabled)
+			return;
+		Slot& slot = slots[frame % kProfilerFrames];
+		collect(slot, false);
+		slot.open = true;
+		slot.frameRange = beginGpu("frame");
+	}
+
+	void endFrame()
+	{
+		if (!enabled)
+			return;
+		endGpu(slots[frame % kProfilerFrames].frameRange);
+		++frame;
+	}
+
+	// Espera os frames pendentes e grava o trace (no fim do programa)
+	void writeTrace()
+	{
+		if (!enabled)
+			return;
+		for (int i = 0; i < kProfilerFrames; ++i)
+			collect(slots[i], true);
+
+		std::ofstream file(tracePath.c_str());
+		if (!file)
+		{
+			std::cout << "ERROR::PROFILER::CANNOT_WRITE_TRACE " << tracePath << std::endl;
+			return;
+		}
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << kCpuThread << ",\"args\":{\"name\":\"CPU\"}},\n";
+		file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << kGpuThread << ",\"args\":{\"name\":\"GPU\"}}";
+		for (size_t i = 0; i < events.size(); ++i)
+		{
+			const Event& e = events[i];
+			file << ",\n{\"name\":\"" << e.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.thread
+				<< ",\"ts\":" << e.begin << ",\"dur\":" << e.duration << "}";
+		}
+		file << "\n]}\n";
+		std::cout << "Trace: " << events.size() << " events written to " << tracePath;
+		if (droppedFrames)
+			std::cout << " (" << droppedFrames << " GPU frames dropped: results not ready)";
+		std::cout << std::endl;
+	}
+
+	void release()
+	{
+		for (int i = 0; i < kProfilerFrames; ++i)
+		{
+			Slot& slot = slots[i];
+			if (!slot.queries.empty())
+				glDeleteQueries((GLsizei)slot.queries.size(), slot.queries.data());
+			slot = Slot();
+		}
+	}
+
+private:
+	static const int kCpuThread = 1, kGpuThread = 2;
+	static const size_t kMaxEvents = 1 << 20;
+
+	struct Event
+	{
+		std::string name;
+		int thread;
+		double begin;      // Microssegundos desde o início
+		double duration;
+	};
+
+	struct GpuRange
+	{
+		std::string name;
+		GLuint begin, end;
+	};
+
+	// Consultas de um frame
+	struct Slot
+	{
+		std::vector<GLuint> queries;  // Reaproveitadas de um frame para o outro
+		std::vector<GpuRange> ranges;
+		int frameRange = -1;          // Índice em ranges do trecho do frame inteiro
+		size_t used = 0;
+		bool open = false;            // Tem resultados ainda não lidos
+	};
+
+	double microseconds(Clock::time_point t) const
+	{
+		return std::chrono::duration<double, std::micro>(t - origin).count();
+	}
+
+	static GLuint query(Slot& slot, size_t index)
+	{
+		if (index == slot.queries.size())
+		{
+			GLuint q;
+			glGenQueries(1, &q);
+			slot.queries.push_back(q);
+		}
+		return slot.queries[index];
+	}
+
+	// Lê os resultados do conjunto; sem wait, só se já estiverem prontos
+	void collect(Slot& slot, bool wait)
+	{
+		if (!slot.open)
+			return;
+		// O fim do frame é o último timestamp gravado no conjunto
+		GLuint available = GL_TRUE;
+		if (!wait && slot.frameRange >= 0)
+			glGetQueryObjectuiv(slot.ranges[slot.frameRange].end, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available)
+		{
+			for (size_t i = 0; i < slot.ranges.size(); ++i)
+			{
+				GLuint64 begin = 0, end = 0;
+				glGetQueryObjectui64v(slot.ranges[i].begin, GL_QUERY_RESULT, &begin);
+				glGetQueryObjectui64v(slot.ranges[i].end, GL_QUERY_RESULT, &end);
+				addGpuEvent(slot.ranges[i].name, (double)(int64_t)(begin - gpuOrigin) / 1000.0,
+					(double)(end - begin) / 1000.0);
+			}
+		}
+		else
+			++droppedFrames;
+		slot.ranges.clear();
+		slot.frameRange = -1;
+		slot.used = 0;
+		slot.open = false;
+	}
+
+	// beginUs é relativo ao instante da calibração no relógio da GPU
+	void addGpuEvent(const std::string& name, double beginUs, double durationUs)
+	{
+		if (events.size() >= kMaxEvents)
+			return;
+		Event e;
+		e.name = name;
+		e.thread = kGpuThread;
+		e.begin = gpuOriginUs + beginUs;
+		e.duration = durationUs;
+		events.push_back(e);
+	}
+
+	bool enabled = false;
+	std::string tracePath;
+	Clock::time_point origin;
+	GLuint64 gpuOrigin = 0;
+	double gpuOriginUs = 0.0;
+	long long frame = 0;
+	unsigned droppedFrames = 0;
+	Slot slots[kProfilerFrames];
+	std::vector<Event> events;
+};
+
+// Profiler compartilhado pela aplicação (inicializado pela AppWindow com --trace)
+inline Profiler& sharedProfiler()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+// Mede o tempo de CPU do escopo
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* scopeName) : name(scopeName)
+	{
+		if (sharedProfiler().isEnabled())
+			begin = Profiler::Clock::now();
+	}
+
+	~ProfileScope()
+	{
+		if (sharedProfiler().isEnabled())
+			sharedProfiler().cpuEvent(name, begin, Profiler::Clock::now());
+	}
+
+private:
+	const char* name;
+	Profiler::Clock::time_point begin;
+};
+
+// Mede o tempo de CPU e o de GPU dos comandos enviados dentro do escopo
+class GpuProfileScope
+{
+public:
+	explicit GpuProfileScope(const char* scopeName) : cpu(scopeName), index(sharedProfiler().beginGpu(scopeName)) {}
+	~GpuProfileScope() { sharedProfiler().endGpu(index); }
+
+private:
+	ProfileScope cpu;
+	int index;
+};
@@ -0,0 +1,233 @@
+// Cache em disco dos programas de shader já linkados (glGetProgramBinary)
+//
+// A chave de cada programa é um hash (FNV-1a de 64 bits) dos códigos fonte,
+// dos defines e das strings do driver (GL_VENDOR, GL_RENDERER, GL_VERSION):
+// trocar o shader, a placa ou o driver gera outra chave. Na próxima execução o
+// binário é carregado com glProgramBinary; se o driver recusar (binário
+// antigo), o arquivo é apagado e o programa é compilado de novo.
+//
+// A GLAD do projeto é da OpenGL 4.0 e não carrega as funções de binário de
+// programa (OpenGL 4.1 / ARB_get_program_binary), então elas são carregadas
+// aqui com o mesmo carregador usado pela GLAD. Sem suporte, load() sempre
+// retorna 0 e os programas são compilados normalmente.
+//
+// Uso nas funções setupShader dos exercícios:
+//   GLuint cached = sharedProgramCache().load(vertexSource, fragmentSource);
+//   if (cached) return cached;
+//   ... glCompileShader / glLinkProgram ...
+//   sharedProgramCache().store(shaderProgram, vertexSource, fragmentSource);
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <iostream>
+#include <filesystem>
+
+//GLAD
+#include <glad/glad.h>
+
+// Constantes da OpenGL 4.1 que não estão na GLAD 4.0
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+struct ProgramCacheStats
+{
+	unsigned hits = 0;    // Programas carregados do disco
+	unsigned misses = 0;  // Programas compilados (sem arquivo no cache)
+	unsigned stale = 0;   // Binários recusados pelo driver
+	unsigned stored = 0;  // Binários gravados
+	double loadMs = 0.0;  // Tempo gasto em glProgramBinary
+};
+
+class ProgramCache
+{
+public:
+	// Carrega as funções de binário de programa (o contexto precisa estar ativo)
+	void init(GLADloadproc loader, const std::string& cacheDirectory)
+	{
+		directory = cacheDirectory;
+		getProgramBinary = (GetProgramBinaryProc)loader("glGetProgramBinary");
+		programBinary = (ProgramBinaryProc)loader("glProgramBinary");
+		programParameteri = (ProgramParameteriProc)loader("glProgramParameteri");
+
+		GLint formats = 0;
+		if (getProgramBinary && programBinary)
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		enabled = formats > 0 && !directory.empty();
+		if (!enabled)
+			return;
+
+		driver = std::string((const char*)glGetString(GL_VENDOR)) + '\n' +
+			(const char*)glGetString(GL_RENDERER) + '\n' + (const char*)glGetString(GL_VERSION);
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+	}
+
+	void disable() { enabled = false; }
+	bool isEnabled() const { return enabled; }
+	const ProgramCacheStats& getStats() const { return stats; }
+
+	// Programa já linkado a partir do cache, ou 0 se for preciso compilar
+	GLuint load(const GLchar* vertexSource, const GLchar* fragmentSource, const std::string& defines = "")
+	{
+		if (!enabled)
+			return 0;
+		auto start = std::chrono::steady_clock::now();
+
+		std::string path = pathFor(vertexSource, fragmentSource, defines);
+		FILE* file = fopen(path.c_str(), "rb");
+		if (!file)
+		{
+			++stats.misses;
+			return 0;
+		}
+		Header header;
+		std::vector<char> binary;
+		bool ok = fread(&header, sizeof(header), 1, file) == 1 && header.magic == kMagic && header.length > 0;
+		if (ok)
+		{
+			binary.resize(header.length);
+			ok = fread(binary.data(), 1, binary.size(), file) == binary.size();
+		}
+		fclose(file);
+
+		GLuint program = 0;
+		GLint success = 0;
+		if (ok)
+		{
+			program = glCreateProgram();
+			programBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+			glGetProgramiv(program, GL_LINK_STATUS, &success);
+		}
+		if (!success)
+		{
+			// Binário de outro driver ou corrompido: compila de novo e regrava
+			if (program)
+				glDeleteProgram(program);
+			std::remove(path.c_str());
+			++stats.stale;
+			++stats.misses;
+			return 0;
+		}
+
+		++stats.hits;
+		stats.loadMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return program;
+	}
+
+	// Antes do glLinkProgram: avisa o driver que o binário vai ser lido
+	void prepare(GLuint program)
+	{
+		if (enabled && programParameteri)
+			programParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	// Grava o binário de um programa recém-linkado
+	void store(GLuint program, const GLchar* vertexSource, const GLchar* fragmentSource, const std::string& defines = "")
+	{
+		if (!enabled)
+			return;
+		GLint success = 0, length = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (!success || length <= 0)
+			return;
+
+		Header header;
+		std::vector<char> binary(length);
+		GLsizei written = 0;
+		getProgramBinary(program, length, &written, &header.format, binary.data());
+		if (written <= 0)
+			return;
+		header.length = (uint32_t)written;
+
+		// Grava em um arquivo temporário e renomeia: outra execução nunca lê um arquivo pela metade
+		std::string path = pathFor(vertexSource, fragmentSource, defines);
+		std::string temporary = path + ".tmp";
+		FILE* file = fopen(temporary.c_str(), "wb");
+		if (!file)
+		{
+			std::cout << "ERROR::PROGRAM_CACHE::FILE_NOT_WRITTEN " << temporary << std::endl;
+			return;
+		}
+		bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+			fwrite(binary.data(), 1, written, file) == (size_t)written;
+		fclose(file);
+		std::error_code error;
+		if (ok)
+			std::filesystem::rename(temporary, path, error);
+		if (!ok || error)
+		{
+			std::remove(temporary.c_str());
+			return;
+		}
+		++stats.stored;
+	}
+
+	void printStats(std::ostream& out) const
+	{
+		out << "Program cache: " << stats.hits << " hits, " << stats.misses << " misses ("
+			<< stats.stale << " stale), " << stats.stored << " stored, " << stats.loadMs << " ms loading" << std::endl;
+	}
+
+private:
+	typedef void (APIENTRYP GetProgramBinaryProc)(GLuint, GLsizei, GLsizei*, GLenum*, void*);
+	typedef void (APIENTRYP ProgramBinaryProc)(GLuint, GLenum, const void*, GLsizei);
+	typedef void (APIENTRYP ProgramParameteriProc)(GLuint, GLenum, GLint);
+
+	static const uint32_t kMagic = 0x31424750; // "PGB1"
+
+	struct Header
+	{
+		uint32_t magic = kMagic;
+		GLenum format = 0;
+		uint32_t length = 0;
+	};
+
+	static void hashBytes(uint64_t& hash, const char* data, size_t size)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= (unsigned char)data[i];
+			hash *= 1099511628211ull;
+		}
+		// Separador: "ab" + "c" e "a" + "bc" geram chaves diferentes
+		hash ^= 0xFF;
+		hash *= 1099511628211ull;
+	}
+
+	std::string pathFor(const GLchar* vertexSource, const GLchar* fragmentSource, const std::string& defines) const
+	{
+		uint64_t hash = 14695981039346656037ull;
+		hashBytes(hash, driver.data(), driver.size());
+		hashBytes(hash, defines.data(), defines.size());
+		hashBytes(hash, vertexSource, strlen(vertexSource));
+		hashBytes(hash, fragmentSource, strlen(fragmentSource));
+		char name[32];
+		snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)hash);
+		return directory + "/" + name;
+	}
+
+	bool enabled = false;
+	std::string directory;
+	std::string driver;
+	GetProgramBinaryProc getProgramBinary = nullptr;
+	ProgramBinaryProc programBinary = nullptr;
+	ProgramParameteriProc programParameteri = nullptr;
+	ProgramCacheStats stats;
+};
+
+// Cache compartilhado pela aplicação (inicializado pela AppWindow)
+inline ProgramCache& sharedProgramCache()
+{
+	static ProgramCache cache;
+	return cache;
+}
@@ -0,0 +1,378 @@
+// Montador de cena em lote: junta várias partes (e várias cópias de um objeto)
+// em um único VBO intercalado com um único VAO
+//
+// Cada parte guarda só a sua primitiva, a sua camada e o intervalo de vértices
+// dentro do VBO. No desenho, as partes da mesma camada e da mesma primitiva são
+// enviadas juntas com glMultiDrawArrays - um VAO vinculado por frame e uma
+// chamada de desenho por grupo, independente de quantas partes existam.
+//
+// As partes são sempre adicionadas com 6 floats por vértice; setVertexFormat()
+// escolhe como os vértices ficam no VBO (VertexFormat.h), por exemplo posição
+// snorm16 e cor RGBA8 em 8 bytes em vez de 24.
+//
+// Com setIndexed(true), upload() junta os vértices repetidos, gera um EBO e
+// reordena os triângulos de cada parte para o cache de vértices (MeshOptimizer.h);
+// o desenho passa a usar glMultiDrawElements. Os triângulos de uma parte podem
+// mudar de ordem, então as partes indexadas não devem ter triângulos sobrepostos.
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+#include "SoftRasterizer.h"
+#include "Profiler.h"
+#include "VertexFormat.h"
+#include "MeshOptimizer.h"
+
+// Contadores por frame: o que o desenho parte a parte faria e o que o lote faz
+struct SceneBatchStats
+{
+	GLsizei parts = 0;          // Partes adicionadas
+	GLsizei drawCalls = 0;      // Chamadas de desenho do lote (glMultiDrawArrays)
+	GLsizei binds = 0;          // VAOs vinculados pelo lote
+	GLsizei naiveDrawCalls = 0; // Uma chamada por parte
+	GLsizei naiveBinds = 0;     // Um VAO por objeto desenhado separadamente
+};
+
+class SceneBatch
+{
+public:
+	// Vértices com o layout dos exercícios 8 e 9: posição (x, y, z) e cor (r, g, b)
+	static const GLuint kFloatsPerVertex = 6;
+
+	// Adiciona uma parte. vertices tem count vértices intercalados (6 floats cada);
+	// as posições são escaladas por scale e deslocadas por (dx, dy) na cópia.
+	// Camadas menores são desenhadas antes; dentro da camada, a ordem das primitivas
+	// é a da primeira parte adicionada de cada uma.
+	// objectId identifica o VAO que essa parte teria no desenho separado (para o relatório)
+	void addPart(int layer, GLenum mode, const GLfloat* vertices, GLsizei count,
+		float dx = 0.0f, float dy = 0.0f, float scale = 1.0f, int objectId = -1)
+	{
+		Part part;
+		part.layer = layer;
+		part.mode = mode;
+		part.first = (GLint)(data.size() / kFloatsPerVertex);
+		part.count = count;
+		part.order = modeOrder(layer, mode);
+		parts.push_back(part);
+		vertexCount += count;
+
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			const GLfloat* v = vertices + (size_t)i * kFloatsPerVertex;
+			data.push_back(v[0] * scale + dx);
+			data.push_back(v[1] * scale + dy);
+			data.push_back(v[2] * scale);
+			data.push_back(v[3]);
+			data.push_back(v[4]);
+			data.push_back(v[5]);
+		}
+
+		if (objectId < 0 || objectId != lastObjectId)
+			++naiveBinds;
+		lastObjectId = objectId;
+	}
+
+	// Nome do grupo (camada + primitiva) nos trechos medidos do trace (Profiler.h)
+	void setGroupName(int layer, GLenum mode, const char* name)
+	{
+		names[modeOrder(layer, mode)] = name;
+	}
+
+	// Formato dos vértices no VBO (padrão: 6 floats); chamar antes de upload()
+	void setVertexFormat(const VertexFormat& vertexFormat)
+	{
+		format = vertexFormat;
+	}
+
+	// Vértices únicos e índices (EBO) em vez de vértices repetidos; chamar antes de upload()
+	void setIndexed(bool enabled)
+	{
+		indexed = enabled;
+	}
+
+	// Envia os vértices (um VBO, um VAO) e agrupa as partes por camada e primitiva
+	// Com loader, os atributos usam glVertexAttribFormat quando a OpenGL tem (4.3)
+	void upload(GLADloadproc loader = NULL)
+	{
+		const GLfloat* vertices = data.data();
+		size_t uploadCount = (size_t)vertexCount;
+		std::vector<GLfloat> unique;
+		if (indexed)
+		{
+			buildIndexBuffer(unique);
+			vertices = unique.data();
+			uploadCount = unique.size() / kFloatsPerVertex;
+		}
+
+		std::vector<char> packed(uploadCount * format.stride);
+		VertexPackStats packStats = packVertices(format, vertices, uploadCount, packed.data());
+		if (packStats.clamped)
+			std::cout << "ERROR::SCENE_BATCH::VERTICES_OUT_OF_RANGE " << packStats.clamped
+				<< " components clamped to the " << format.name << " vertex format" << std::endl;
+		vertexBytes = packed.size();
+
+		glGenVertexArrays(1, &VAO);
+		glGenBuffers(1, &VBO);
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBufferData(GL_ARRAY_BUFFER, packed.size(), packed.data(), GL_STATIC_DRAW);
+		setupVertexAttributes(format, VBO, 0, loader);
+		if (indexed)
+		{
+			// Índices de 16 bits quando os vértices cabem
+			std::vector<GLushort> shortIndices;
+			const void* indexData = indices.data();
+			size_t indexBytes = indices.size() * sizeof(GLuint);
+			indexType = GL_UNSIGNED_INT;
+			if (uploadCount <= 0xFFFF)
+			{
+				shortIndices.assign(indices.begin(), indices.end());
+				indexData = shortIndices.data();
+				indexBytes = shortIndices.size() * sizeof(GLushort);
+				indexType = GL_UNSIGNED_SHORT;
+			}
+			glGenBuffers(1, &EBO);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, indexData, GL_STATIC_DRAW);
+			vertexBytes += indexBytes;
+			std::vector<GLuint>().swap(indices);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindVertexArray(0);
+
+		buildGroups();
+
+		// Os vértices já estão na GPU
+		std::vector<GLfloat>().swap(data);
+	}
+
+	// Desenha a cena inteira: 1 VAO e um glMultiDrawArrays (ou glMultiDrawElements) por grupo
+	void draw() const
+	{
+		glBindVertexArray(VAO);
+		for (size_t i = 0; i < groups.size(); ++i)
+		{
+			const Group& group = groups[i];
+			GpuProfileScope scope(group.name.c_str());
+			if (EBO)
+				glMultiDrawElements(group.mode, group.counts.data(), indexType, group.offsets.data(), (GLsizei)group.counts.size());
+			else
+				glMultiDrawArrays(group.mode, group.firsts.data(), group.counts.data(), (GLsizei)group.firsts.size());
+		}
+		glBindVertexArray(0);
+	}
+
+	// Desenha a cena no rasterizador em software, na mesma ordem do draw()
+	// Precisa ser chamado antes de upload(), que libera a cópia dos vértices na CPU
+	void rasterize(SoftRasterizer& raster)
+	{
+		if (data.empty())
+		{
+			std::cout << "ERROR::SCENE_BATCH::NO_CPU_VERTICES" << std::endl;
+			return;
+		}
+		buildGroups();
+		for (size_t i = 0; i < groups.size(); ++i)
+		{
+			const Group& group = groups[i];
+			for (size_t j = 0; j < group.firsts.size(); ++j)
+				raster.drawArrays(group.mode, data.data(), group.firsts[j], group.counts[j], softPositionColorLayout());
+		}
+	}
+
+	SceneBatchStats stats() const
+	{
+		SceneBatchStats s;
+		s.parts = (GLsizei)parts.size();
+		s.drawCalls = (GLsizei)groups.size();
+		s.binds = 1;
+		s.naiveDrawCalls = (GLsizei)parts.size();
+		s.naiveBinds = naiveBinds;
+		return s;
+	}
+
+	// Imprime o relatório de chamadas e vínculos economizados por frame
+	void printStats(std::ostream& out) const
+	{
+		SceneBatchStats s = stats();
+		out << "SceneBatch: " << s.parts << " parts, " << vertexCount << " vertices" << std::endl;
+		if (vertexBytes)
+			out << "  vertex data: " << vertexBytes << " bytes (" << format.name << ", " << format.stride
+				<< " bytes per vertex" << (EBO ? " + indices" : "") << ", was "
+				<< (size_t)vertexCount * kFloatsPerVertex * sizeof(GLfloat) << ")" << std::endl;
+		if (EBO)
+		{
+			out << "  indexed: " << uniqueVertices << " unique vertices (was " << vertexCount << "), vertex shader runs per frame: "
+				<< shadedVertices << " (was " << vertexCount << ")" << std::endl;
+			if (triangleIndices)
+				out << "  triangle ACMR: " << acmrIndexed << " indexed, " << acmrOptimized << " optimized (was 3)" << std::endl;
+		}
+		out << "  draw calls per frame: " << s.drawCalls << " (was " << s.naiveDrawCalls
+			<< ", saved " << (s.naiveDrawCalls - s.drawCalls) << ")" << std::endl;
+		out << "  VAO binds per frame:  " << s.binds << " (was " << s.naiveBinds
+			<< ", saved " << (s.naiveBinds - s.binds) << ")" << std::endl;
+	}
+
+	void release()
+	{
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+		if (EBO)
+			glDeleteBuffers(1, &EBO);
+		VAO = VBO = EBO = 0;
+	}
+
+private:
+	struct Part
+	{
+		int layer;
+		GLenum mode;
+		GLint first;
+		GLsizei count;
+		int order;
+	};
+
+	struct Group
+	{
+		int layer;
+		GLenum mode;
+		std::string name;
+		std::vector<GLint> firsts;
+		std::vector<GLsizei> counts;
+		std::vector<const void*> offsets; // Deslocamentos no EBO (desenho indexado)
+	};
+
+	struct ModeKey
+	{
+		int layer;
+		GLenum mode;
+		int order;
+	};
+
+	// Agrupa por (camada, primitiva) mantendo a ordem das partes dentro de cada grupo
+	void buildGroups()
+	{
+		std::vector<Part> sorted(parts);
+		std::stable_sort(sorted.begin(), sorted.end(),
+			[](const Part& a, const Part& b) { return a.layer != b.layer ? a.layer < b.layer : a.order < b.order; });
+
+		groups.clear();
+		for (size_t i = 0; i < sorted.size(); ++i)
+		{
+			if (groups.empty() || groups.back().layer != sorted[i].layer || groups.back().mode != sorted[i].mode)
+			{
+				Group group;
+				group.layer = sorted[i].layer;
+				group.mode = sorted[i].mode;
+				group.name = names[sorted[i].order];
+				groups.push_back(group);
+			}
+			groups.back().firsts.push_back(sorted[i].first);
+			groups.back().counts.push_back(sorted[i].count);
+			size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint);
+			groups.back().offsets.push_back((const void*)((size_t)sorted[i].first * indexSize));
+		}
+	}
+
+	// Vértices únicos em unique e um índice por vértice adicionado em indices: o
+	// intervalo de cada parte no EBO é o mesmo que ela tinha no VBO. Os triângulos
+	// de cada parte são reordenados para o cache e os vértices para a ordem de uso
+	void buildIndexBuffer(std::vector<GLfloat>& unique)
+	{
+		indices.resize(vertexCount);
+		uniqueVertices = generateIndexBuffer(data.data(), (size_t)vertexCount, kFloatsPerVertex, indices.data());
+		unique.resize(uniqueVertices * kFloatsPerVertex);
+		remapVertexBuffer(unique.data(), data.data(), (size_t)vertexCount, kFloatsPerVertex, indices.data());
+
+		// Cada parte é desenhada sozinha: o cache é simulado e otimizado com os
+		// índices da parte renumerados a partir de 0
+		const GLuint kNone = ~0u;
+		std::vector<GLuint> local(uniqueVertices, kNone), localToGlobal, localIndices;
+		size_t transformedIndexed = 0, transformedOptimized = 0;
+		shadedVertices = 0;
+		triangleIndices = 0;
+		for (const Part& part : parts)
+		{
+			GLuint* partIndices = indices.data() + part.first;
+			localToGlobal.clear();
+			localIndices.resize(part.count);
+			for (GLsizei i = 0; i < part.count; ++i)
+			{
+				GLuint g = partIndices[i];
+				if (local[g] == kNone)
+				{
+					local[g] = (GLuint)localToGlobal.size();
+					localToGlobal.push_back(g);
+				}
+				localIndices[i] = local[g];
+			}
+
+			VertexCacheStats before = analyzeVertexCache(localIndices.data(), part.count, localToGlobal.size());
+			if (part.mode == GL_TRIANGLES)
+			{
+				optimizeVertexCache(localIndices.data(), localIndices.data(), part.count, localToGlobal.size());
+				VertexCacheStats after = analyzeVertexCache(localIndices.data(), part.count, localToGlobal.size());
+				transformedIndexed += before.transformed;
+				transformedOptimized += after.transformed;
+				triangleIndices += part.count;
+				shadedVertices += after.transformed;
+			}
+			else
+				shadedVertices += before.transformed;
+
+			for (GLsizei i = 0; i < part.count; ++i)
+				partIndices[i] = localToGlobal[localIndices[i]];
+			for (GLuint g : localToGlobal)
+				local[g] = kNone;
+		}
+		if (triangleIndices)
+		{
+			acmrIndexed = (float)transformedIndexed / (float)(triangleIndices / 3);
+			acmrOptimized = (float)transformedOptimized / (float)(triangleIndices / 3);
+		}
+
+		optimizeVertexFetch(unique.data(), uniqueVertices, kFloatsPerVertex, indices.data(), indices.size());
+	}
+
+	// Posição da primitiva dentro da camada: a ordem em que ela apareceu pela primeira vez
+	int modeOrder(int layer, GLenum mode)
+	{
+		for (size_t i = 0; i < modeKeys.size(); ++i)
+		{
+			if (modeKeys[i].layer == layer && modeKeys[i].mode == mode)
+				return modeKeys[i].order;
+		}
+		ModeKey key = { layer, mode, (int)modeKeys.size() };
+		modeKeys.push_back(key);
+		const char* primitive = mode == GL_LINES ? " lines" : mode == GL_LINE_STRIP ? " line strip"
+			: mode == GL_TRIANGLES ? " triangles" : mode == GL_TRIANGLE_STRIP ? " triangle strip" : " primitives";
+		names.push_back("layer " + std::to_string(layer) + primitive);
+		return key.order;
+	}
+
+	std::vector<GLfloat> data;
+	std::vector<Part> parts;
+	std::vector<Group> groups;
+	std::vector<ModeKey> modeKeys;
+	std::vector<std::string> names; // Por ModeKey::order
+	GLsizei naiveBinds = 0;
+	GLsizei vertexCount = 0;
+	VertexFormat format = floatVertexFormat();
+	size_t vertexBytes = 0; // Bytes enviados ao VBO e ao EBO (0 antes de upload())
+	bool indexed = false;
+	std::vector<GLuint> indices;  // Só durante upload()
+	GLenum indexType = GL_UNSIGNED_INT;
+	size_t uniqueVertices = 0;
+	size_t shadedVertices = 0;    // Execuções do vertex shader por frame (cache FIFO simulado)
+	size_t triangleIndices = 0;
+	float acmrIndexed = 0.0f, acmrOptimized = 0.0f;
+	int lastObjectId = -1;
+	GLuint VAO = 0, VBO = 0, EBO = 0;
+};
@@ -4,6 +4,9 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <cstring>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -14,12 +17,54 @@
 // GLFW
 #include <GLFW/glfw3.h>
 
+#include "ProgramCache.h"
+
 using namespace std;
 
+// Uniform location resolved once from the cache; reuse it every frame
+// type and size come from glGetActiveUniform (size > 1 for arrays)
+struct UniformLocation
+{
+	GLint location = -1;
+	GLenum type = 0;
+	GLint size = 0;
+	bool valid() const { return location >= 0; }
+};
+
+// Typed handles: Shader::getUniform<...>() checks the GLSL type once, so the
+// set() overloads can't send a vec3 to a vec4 uniform by accident
+template <GLenum GLSLType>
+struct TypedUniform : UniformLocation {};
+
+typedef TypedUniform<GL_FLOAT> UniformFloat;
+typedef TypedUniform<GL_FLOAT_VEC2> UniformVec2;
+typedef TypedUniform<GL_FLOAT_VEC3> UniformVec3;
+typedef TypedUniform<GL_FLOAT_VEC4> UniformVec4;
+typedef TypedUniform<GL_FLOAT_MAT4> UniformMat4;
+typedef TypedUniform<GL_INT> UniformInt; // Also bool and sampler uniforms
+
+// Counters of the uniform cache since the program was linked
+struct UniformCacheStats
+{
+	unsigned long long driverLookups = 0; // glGetUniformLocation calls (only right after link)
+	unsigned long long cachedLookups = 0; // Name lookups answered by the table instead of the driver
+	unsigned long long handleSets = 0;    // Uniforms set through a handle, with no lookup at all
+	unsigned long long misses = 0;        // Names that are not active uniforms (location -1)
+
+	// Calls to glGetUniformLocation that the old setters would have made
+	unsigned long long lookupsAvoided() const { return cachedLookups + handleSets; }
+};
+
 class Shader
 {
 public:
 	GLuint ID;
+	// Wraps a program that is already linked (e.g. built by ShaderBuildQueue)
+	explicit Shader(GLuint program)
+	{
+		this->ID = program;
+		cacheUniforms();
+	}
 	// Constructor generates the shader on the fly
 	Shader(const GLchar* vertexPath, const GLchar* fragmentPath)
 	{
@@ -53,6 +98,13 @@ public:
 		}
 		const GLchar* vShaderCode = vertexCode.c_str();
 		const GLchar * fShaderCode = fragmentCode.c_str();
+		// Program linked by an earlier run (on-disk binary cache)
+		this->ID = sharedProgramCache().load(vShaderCode, fShaderCode);
+		if (this->ID)
+		{
+			cacheUniforms();
+			return;
+		}
 		// 2. Compile shaders
 		GLuint vertex, fragment;
 		GLint success;
@@ -83,6 +135,7 @@ public:
 		this->ID = glCreateProgram();
 		glAttachShader(this->ID, vertex);
 		glAttachShader(this->ID, fragment);
+		sharedProgramCache().prepare(this->ID);
 		glLinkProgram(this->ID);
 		// Print linking errors if any
 		glGetProgramiv(this->ID, GL_LINK_STATUS, &success);
@@ -94,7 +147,10 @@ public:
 		// Delete the shaders as they're linked into our program now and no longer necessery
 		glDeleteShader(vertex);
 		glDeleteShader(fragment);
+		sharedProgramCache().store(this->ID, vShaderCode, fShaderCode);
 
+		// Reflect the active uniforms once, so the setters never ask the driver again
+		cacheUniforms();
 	}
 	// Uses the current shader
 	void Use()
@@ -102,40 +158,229 @@ public:
 		glUseProgram(this->ID);
 	}
 
-	void setBool(const std::string& name, bool value) const
+	// Names are plain C strings: a literal doesn't build a std::string on every call
+	void setBool(const char* name, bool value) const
 	{
-		glUniform1i(glGetUniformLocation(this->ID, name.c_str()), (int)value);
+		glUniform1i(uniformLocation(name), (int)value);
 	}
 	// ------------------------------------------------------------------------
-	void setInt(const std::string& name, int value) const
+	void setInt(const char* name, int value) const
 	{
-		glUniform1i(glGetUniformLocation(this->ID, name.c_str()), value);
+		glUniform1i(uniformLocation(name), value);
 	}
 	// ------------------------------------------------------------------------
-	void setFloat(const std::string& name, float value) const
+	void setFloat(const char* name, float value) const
 	{
-		glUniform1f(glGetUniformLocation(this->ID, name.c_str()), value);
+		glUniform1f(uniformLocation(name), value);
 	}
 	// ------------------------------------------------------------------------
-	void setVec2(const std::string& name, float v1, float v2) const
+	void setVec2(const char* name, float v1, float v2) const
 	{
-		glUniform2f(glGetUniformLocation(this->ID, name.c_str()), v1, v2);
+		glUniform2f(uniformLocation(name), v1, v2);
 	}
 
 	// ------------------------------------------------------------------------
-	void setVec3(const std::string& name, float v1, float v2, float v3) const
+	void setVec3(const char* name, float v1, float v2, float v3) const
 	{
-		glUniform3f(glGetUniformLocation(this->ID, name.c_str()), v1, v2, v3);
+		glUniform3f(uniformLocation(name), v1, v2, v3);
 	}
 
-	void setVec4(const std::string& name, float v1, float v2, float v3, float v4) const
+	void setVec4(const char* name, float v1, float v2, float v3, float v4) const
 	{
-		glUniform4f(glGetUniformLocation(this->ID, name.c_str()), v1, v2, v3,v4);
+		glUniform4f(uniformLocation(name), v1, v2, v3,v4);
 	}
 
-	void setMat4(const std::string& name, float *v) const
+	void setMat4(const char* name, float *v) const
 	{
-		glUniformMatrix4fv(glGetUniformLocation(this->ID, name.c_str()), 1, GL_FALSE, v);
+		glUniformMatrix4fv(uniformLocation(name), 1, GL_FALSE, v);
+	}
+
+	// ------------------------------------------------------------------------
+	// Location of an active uniform from the table built after link (-1 if the
+	// name is not an active uniform, which glUniform* silently ignores)
+	GLint uniformLocation(const char* name) const
+	{
+		const CachedUniform* u = findUniform(name);
+		if (!u)
+		{
+			++stats.misses;
+			return -1;
+		}
+		++stats.cachedLookups;
+		return u->info.location;
+	}
+
+	// Resolves a typed handle once, checking the type declared in the shader:
+	//   UniformVec4 color = shader.getUniform<GL_FLOAT_VEC4>("inputColor");
+	//   ... every frame: shader.set(color, 1.0f, 0.0f, 0.0f, 1.0f);
+	template <GLenum GLSLType>
+	TypedUniform<GLSLType> getUniform(const char* name) const
+	{
+		TypedUniform<GLSLType> handle;
+		const CachedUniform* u = findUniform(name);
+		if (!u)
+		{
+			std::cout << "ERROR::SHADER::UNIFORM_NOT_FOUND " << name << std::endl;
+			return handle;
+		}
+		if (!typeMatches(GLSLType, u->info.type))
+		{
+			std::cout << "ERROR::SHADER::UNIFORM_TYPE_MISMATCH " << name << std::endl;
+			return handle;
+		}
+		static_cast<UniformLocation&>(handle) = u->info;
+		return handle;
+	}
+
+	void set(const UniformInt& u, int value) const
+	{
+		glUniform1i(u.location, value);
+		++stats.handleSets;
+	}
+
+	void set(const UniformFloat& u, float value) const
+	{
+		glUniform1f(u.location, value);
+		++stats.handleSets;
+	}
+
+	void set(const UniformVec2& u, float v1, float v2) const
+	{
+		glUniform2f(u.location, v1, v2);
+		++stats.handleSets;
+	}
+
+	void set(const UniformVec3& u, float v1, float v2, float v3) const
+	{
+		glUniform3f(u.location, v1, v2, v3);
+		++stats.handleSets;
+	}
+
+	void set(const UniformVec4& u, float v1, float v2, float v3, float v4) const
+	{
+		glUniform4f(u.location, v1, v2, v3, v4);
+		++stats.handleSets;
+	}
+
+	void set(const UniformMat4& u, const float* v) const
+	{
+		glUniformMatrix4fv(u.location, 1, GL_FALSE, v);
+		++stats.handleSets;
+	}
+
+	// Number of names in the table (array elements count one by one)
+	size_t uniformCount() const { return uniforms.size(); }
+
+	const UniformCacheStats& uniformStats() const { return stats; }
+
+	void printUniformStats(std::ostream& out) const
+	{
+		out << "Shader " << ID << ": " << uniforms.size() << " cached uniform names, "
+			<< stats.driverLookups << " driver lookups at link" << std::endl;
+		out << "  lookups avoided: " << stats.lookupsAvoided() << " (" << stats.cachedLookups
+			<< " by name, " << stats.handleSets << " by handle), misses: " << stats.misses << std::endl;
+	}
+
+private:
+	struct CachedUniform
+	{
+		std::string name;
+		UniformLocation info;
+	};
+
+	// Sorted by name: binary search with strcmp, no std::string built per lookup
+	std::vector<CachedUniform> uniforms;
+	mutable UniformCacheStats stats;
+
+	void cacheUniforms()
+	{
+		uniforms.clear();
+		GLint count = 0, maxLength = 0;
+		glGetProgramiv(this->ID, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(this->ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+		std::vector<GLchar> buffer(maxLength + 1);
+		for (GLint i = 0; i < count; ++i)
+		{
+			GLsizei length = 0;
+			GLint size = 0;
+			GLenum type = 0;
+			glGetActiveUniform(this->ID, (GLuint)i, (GLsizei)buffer.size(), &length, &size, &type, buffer.data());
+			std::string name(buffer.data(), length);
+
+			// Uniforms inside uniform blocks have no location
+			GLint location = glGetUniformLocation(this->ID, name.c_str());
+			++stats.driverLookups;
+			if (location < 0)
+				continue;
+
+			// Arrays come as "name[0]": register "name", "name[0]" and every element
+			std::string base = name;
+			if (base.size() > 3 && base.compare(base.size() - 3, 3, "[0]") == 0)
+				base.erase(base.size() - 3);
+			addUniform(base, location, type, size);
+			if (size > 1 || base != name)
+			{
+				addUniform(base + "[0]", location, type, size);
+				for (GLint e = 1; e < size; ++e)
+				{
+					std::string element = base + "[" + std::to_string(e) + "]";
+					GLint elementLocation = glGetUniformLocation(this->ID, element.c_str());
+					++stats.driverLookups;
+					addUniform(element, elementLocation, type, 1);
+				}
+			}
+		}
+		std::sort(uniforms.begin(), uniforms.end(),
+			[](const CachedUniform& a, const CachedUniform& b) { return a.name < b.name; });
+	}
+
+	void addUniform(const std::string& name, GLint location, GLenum type, GLint size)
+	{
+		CachedUniform u;
+		u.name = name;
+		u.info.location = location;
+		u.info.type = type;
+		u.info.size = size;
+		uniforms.push_back(u);
+	}
+
+	const CachedUniform* findUniform(const char* name) const
+	{
+		size_t lo = 0, hi = uniforms.size();
+		while (lo < hi)
+		{
+			size_t mid = (lo + hi) / 2;
+			int c = std::strcmp(uniforms[mid].name.c_str(), name);
+			if (c == 0)
+				return &uniforms[mid];
+			if (c < 0)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return NULL;
+	}
+
+	// Int handles also accept bool and sampler uniforms (set with glUniform1i)
+	static bool typeMatches(GLenum wanted, GLenum actual)
+	{
+		if (wanted == actual)
+			return true;
+		if (wanted != GL_INT)
+			return false;
+		switch (actual)
+		{
+		case GL_BOOL:
+		case GL_SAMPLER_1D:
+		case GL_SAMPLER_2D:
+		case GL_SAMPLER_3D:
+		case GL_SAMPLER_CUBE:
+		case GL_SAMPLER_2D_ARRAY:
+		case GL_SAMPLER_BUFFER:
+			return true;
+		default:
+			return false;
+		}
 	}
 };
 
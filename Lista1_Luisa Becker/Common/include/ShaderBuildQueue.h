@@ -0,0 +1,253 @@
+// Fila de compilação de programas de shader
+//
+// add() envia todos os programas para o driver (glCompileShader e
+// glLinkProgram) sem perguntar pelo resultado: quem bloqueia é a consulta de
+// GL_COMPILE_STATUS / GL_LINK_STATUS, então ela só é feita quando o programa
+// já terminou. Com GL_KHR_parallel_shader_compile (ou a versão ARB), o driver
+// compila em threads próprias e poll() consulta GL_COMPLETION_STATUS_KHR, que
+// nunca bloqueia; assim a aplicação monta a geometria e as texturas enquanto
+// os shaders compilam, e só chama finish() quando precisa dos programas.
+// Sem a extensão, poll() e finish() conferem os programas na ordem em que
+// foram enviados.
+//
+// Os programas passam antes pelo cache de binários (ProgramCache.h).
+//
+// Uso:
+//   ShaderBuildQueue shaders(app.getProcLoader());
+//   int main = shaders.add(vertexShaderSource, fragmentShaderSource);
+//   ... geometria, texturas ...
+//   shaders.finish();
+//   GLuint shaderID = shaders.program(main);
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+#include "ProgramCache.h"
+
+// Constante de GL_KHR_parallel_shader_compile, que não está na GLAD 4.0
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+struct ShaderBuildStats
+{
+	unsigned submitted = 0;   // Programas enviados com add()
+	unsigned fromCache = 0;   // Programas que vieram do cache de binários
+	unsigned failed = 0;      // Programas com erro de compilação ou linkagem
+	unsigned pollsBusy = 0;   // Consultas a GL_COMPLETION_STATUS que encontraram o programa compilando
+	double submitMs = 0.0;    // Tempo dentro de add()
+	double waitMs = 0.0;      // Tempo bloqueado em finish()
+};
+
+class ShaderBuildQueue
+{
+public:
+	// Procura a extensão de compilação paralela e libera as threads do driver
+	explicit ShaderBuildQueue(GLADloadproc loader)
+	{
+		GLint count = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+		const char* function = NULL;
+		for (GLint i = 0; i < count && !function; ++i)
+		{
+			std::string name = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+			if (name == "GL_KHR_parallel_shader_compile")
+				function = "glMaxShaderCompilerThreadsKHR";
+			else if (name == "GL_ARB_parallel_shader_compile")
+				function = "glMaxShaderCompilerThreadsARB";
+		}
+		if (function)
+		{
+			MaxShaderCompilerThreadsProc maxThreads = (MaxShaderCompilerThreadsProc)loader(function);
+			parallel = maxThreads != NULL;
+			// 0xFFFFFFFF: quantas threads o driver quiser
+			if (maxThreads)
+				maxThreads(0xFFFFFFFFu);
+		}
+	}
+
+	bool isParallel() const { return parallel; }
+
+	// Envia um programa; defines (linhas "#define ...") entram logo depois do #version
+	// Retorna o identificador usado em ready() e program()
+	int add(const GLchar* vertexSource, const GLchar* fragmentSource, const std::string& defines = "")
+	{
+		auto start = std::chrono::steady_clock::now();
+		Job job;
+		job.vertexSource = vertexSource;
+		job.fragmentSource = fragmentSource;
+		job.defines = defines;
+
+		job.program = sharedProgramCache().load(vertexSource, fragmentSource, defines);
+		if (job.program)
+		{
+			job.done = true;
+			++stats.fromCache;
+		}
+		else
+		{
+			job.vertex = compile(GL_VERTEX_SHADER, withDefines(job.vertexSource, defines));
+			job.fragment = compile(GL_FRAGMENT_SHADER, withDefines(job.fragmentSource, defines));
+			job.program = glCreateProgram();
+			glAttachShader(job.program, job.vertex);
+			glAttachShader(job.program, job.fragment);
+			sharedProgramCache().prepare(job.program);
+			glLinkProgram(job.program);
+		}
+
+		jobs.push_back(job);
+		++stats.submitted;
+		stats.submitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		return (int)jobs.size() - 1;
+	}
+
+	// Lê os códigos fonte de arquivos (como a classe Shader) e envia o programa
+	int addFiles(const std::string& vertexPath, const std::string& fragmentPath, const std::string& defines = "")
+	{
+		std::string vertexCode, fragmentCode;
+		if (!readFile(vertexPath, vertexCode) || !readFile(fragmentPath, fragmentCode))
+			std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ" << std::endl;
+		return add(vertexCode.c_str(), fragmentCode.c_str(), defines);
+	}
+
+	// Confere os programas que já terminaram, sem bloquear quando há compilação
+	// paralela. Retorna verdadeiro quando todos estão prontos
+	bool poll()
+	{
+		bool all = true;
+		for (size_t i = 0; i < jobs.size(); ++i)
+		{
+			if (jobs[i].done)
+				continue;
+			if (parallel)
+			{
+				GLint complete = GL_FALSE;
+				glGetProgramiv(jobs[i].program, GL_COMPLETION_STATUS_KHR, &complete);
+				if (!complete)
+				{
+					++stats.pollsBusy;
+					all = false;
+					continue;
+				}
+			}
+			finalize(jobs[i]);
+		}
+		return all;
+	}
+
+	// Espera todos os programas ficarem prontos
+	void finish()
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < jobs.size(); ++i)
+		{
+			if (!jobs[i].done)
+				finalize(jobs[i]);
+		}
+		stats.waitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	bool ready(int id) const { return jobs[id].done; }
+
+	// Programa linkado (0 enquanto não estiver pronto ou se falhou)
+	GLuint program(int id) const
+	{
+		return jobs[id].done && jobs[id].ok ? jobs[id].program : 0;
+	}
+
+	const ShaderBuildStats& getStats() const { return stats; }
+
+	void printStats(std::ostream& out) const
+	{
+		out << "Shader build queue: " << stats.submitted << " programs (" << stats.fromCache << " from cache, "
+			<< stats.failed << " failed), parallel compile " << (parallel ? "on" : "off") << std::endl;
+		out << "  submit " << stats.submitMs << " ms, blocked " << stats.waitMs << " ms, busy polls "
+			<< stats.pollsBusy << std::endl;
+	}
+
+private:
+	typedef void (APIENTRYP MaxShaderCompilerThreadsProc)(GLuint);
+
+	struct Job
+	{
+		std::string vertexSource, fragmentSource, defines;
+		GLuint vertex = 0, fragment = 0, program = 0;
+		bool done = false, ok = true;
+	};
+
+	static GLuint compile(GLenum type, const std::string& source)
+	{
+		GLuint shader = glCreateShader(type);
+		const GLchar* code = source.c_str();
+		glShaderSource(shader, 1, &code, NULL);
+		glCompileShader(shader);
+		return shader;
+	}
+
+	static std::string withDefines(const std::string& source, const std::string& defines)
+	{
+		if (defines.empty())
+			return source;
+		size_t line = source.compare(0, 8, "#version") == 0 ? source.find('\n') : std::string::npos;
+		if (line == std::string::npos)
+			return defines + "\n" + source;
+		return source.substr(0, line + 1) + defines + "\n" + source.substr(line + 1);
+	}
+
+	static bool readFile(const std::string& path, std::string& contents)
+	{
+		std::ifstream file(path.c_str());
+		if (!file)
+			return false;
+		std::stringstream stream;
+		stream << file.rdbuf();
+		contents = stream.str();
+		return true;
+	}
+
+	// Só aqui o status é consultado: com o programa pronto, a consulta não espera
+	void finalize(Job& job)
+	{
+		GLint success;
+		GLchar infoLog[512];
+		glGetShaderiv(job.vertex, GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			glGetShaderInfoLog(job.vertex, 512, NULL, infoLog);
+			std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+		}
+		glGetShaderiv(job.fragment, GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			glGetShaderInfoLog(job.fragment, 512, NULL, infoLog);
+			std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+		}
+		glGetProgramiv(job.program, GL_LINK_STATUS, &success);
+		if (!success)
+		{
+			glGetProgramInfoLog(job.program, 512, NULL, infoLog);
+			std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+			job.ok = false;
+			++stats.failed;
+		}
+		glDeleteShader(job.vertex);
+		glDeleteShader(job.fragment);
+		job.vertex = job.fragment = 0;
+		if (job.ok)
+			sharedProgramCache().store(job.program, job.vertexSource.c_str(), job.fragmentSource.c_str(), job.defines);
+		job.done = true;
+	}
+
+	std::vector<Job> jobs;
+	bool parallel = false;
+	ShaderBuildStats stats;
+};
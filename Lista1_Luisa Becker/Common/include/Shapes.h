@@ -0,0 +1,298 @@
+// Gerador paramétrico das formas 2D dos exercícios (círculo, polígono, Pac-Man,
+// fatia de pizza, estrela e espiral) em malhas indexadas (VBO + EBO)
+//
+// Os vértices são escritos direto no destino fornecido por quem chama (um array
+// qualquer ou um buffer mapeado com glMapBufferRange), sem arrays na pilha.
+// Os senos e cossenos da borda são avaliados em blocos: uma tabela com os
+// incrementos de ângulo de um bloco é calculada uma vez, e cada bloco só chama
+// cos/sin para o seu ângulo inicial - o resto é uma rotação (4 mult + 2 somas),
+// que o compilador consegue vetorizar.
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Tipos de forma suportados
+enum class ShapeType
+{
+	Polygon, // Polígono regular fechado (círculo = polígono com muitos lados)
+	Sector,  // Setor circular entre startAngle e endAngle (Pac-Man, fatia de pizza)
+	Star,    // Estrela: borda alternando entre radius e innerRadius
+	Spiral   // Espiral de Arquimedes r = a + b * theta, desenhada como linha
+};
+
+// Parâmetros de uma forma - use as funções xxxShape() abaixo para preencher
+struct ShapeDesc
+{
+	ShapeType type = ShapeType::Polygon;
+	GLuint segments = 0;      // Lados do polígono, divisões do arco, pontas*2 da estrela ou pontos da espiral
+	float radius = 0.5f;      // Raio (externo, no caso da estrela)
+	float innerRadius = 0.0f; // Raio interno da estrela
+	float startAngle = 0.0f;  // Ângulo inicial (radianos)
+	float endAngle = 0.0f;    // Ângulo final (radianos) - setor e espiral
+	float a = 0.0f, b = 0.0f; // Constantes da espiral r = a + b * theta
+	float cx = 0.0f, cy = 0.0f; // Centro da forma
+};
+
+// Malha já enviada para a OpenGL
+struct ShapeMesh
+{
+	GLuint VAO = 0, VBO = 0, EBO = 0;
+	GLenum mode = GL_TRIANGLES;
+	GLsizei indexCount = 0;
+};
+
+inline ShapeDesc polygonShape(GLuint sides, float radius)
+{
+	ShapeDesc d;
+	d.type = ShapeType::Polygon;
+	d.segments = sides;
+	d.radius = radius;
+	return d;
+}
+
+inline ShapeDesc circleShape(float radius, GLuint segments = 36)
+{
+	return polygonShape(segments, radius);
+}
+
+inline ShapeDesc sectorShape(float radius, float startAngle, float endAngle, GLuint segments)
+{
+	ShapeDesc d;
+	d.type = ShapeType::Sector;
+	d.segments = segments;
+	d.radius = radius;
+	d.startAngle = startAngle;
+	d.endAngle = endAngle;
+	return d;
+}
+
+// Pac-Man: arco de 270 graus com a boca centrada no eixo x
+inline ShapeDesc pacmanShape(float radius, GLuint segments = 30, float mouthAngle = (float)(M_PI / 2.0))
+{
+	return sectorShape(radius, mouthAngle / 2.0f, (float)(2.0 * M_PI) - mouthAngle / 2.0f, segments);
+}
+
+// Fatia de pizza: setor de 60 graus centrado no eixo x
+inline ShapeDesc pizzaSliceShape(float radius, GLuint segments = 30, float sliceAngle = (float)(M_PI / 3.0))
+{
+	return sectorShape(radius, -sliceAngle / 2.0f, sliceAngle / 2.0f, segments);
+}
+
+inline ShapeDesc starShape(GLuint points, float outerRadius, float innerRadius)
+{
+	ShapeDesc d;
+	d.type = ShapeType::Star;
+	d.segments = points * 2;
+	d.radius = outerRadius;
+	d.innerRadius = innerRadius;
+	return d;
+}
+
+inline ShapeDesc spiralShape(float a, float b, float maxTheta, GLuint points)
+{
+	ShapeDesc d;
+	d.type = ShapeType::Spiral;
+	d.segments = points;
+	d.a = a;
+	d.b = b;
+	d.endAngle = maxTheta;
+	return d;
+}
+
+// Primitiva usada para desenhar a malha indexada
+inline GLenum shapePrimitive(const ShapeDesc& d)
+{
+	return d.type == ShapeType::Spiral ? GL_LINE_STRIP : GL_TRIANGLES;
+}
+
+// Quantidade de pontos na borda (sem o centro)
+inline GLuint shapeRimCount(const ShapeDesc& d)
+{
+	return d.type == ShapeType::Sector ? d.segments + 1 : d.segments;
+}
+
+// Quantidade de vértices da malha: centro + borda (a espiral não tem centro)
+// O vértice de fechamento não é repetido - quem fecha a forma é o índice
+inline GLuint shapeVertexCount(const ShapeDesc& d)
+{
+	return d.type == ShapeType::Spiral ? d.segments : shapeRimCount(d) + 1;
+}
+
+// Um triângulo por segmento; a espiral é uma line strip com um índice por ponto
+inline GLuint shapeIndexCount(const ShapeDesc& d)
+{
+	return d.type == ShapeType::Spiral ? d.segments : d.segments * 3;
+}
+
+namespace shapes_detail
+{
+	const GLuint kTrigBlock = 64; // Pontos avaliados por chamada de cos/sin
+
+	// Escreve count pontos (x, y, 0) com ângulo start + k * step e raio r0 + k * dr.
+	// Se alternate for verdadeiro, os pontos ímpares usam rAlt (estrela).
+	inline void writeRim(GLfloat* dst, GLuint stride, GLuint count, float cx, float cy,
+		double start, double step, float r0, float dr, bool alternate, float rAlt)
+	{
+		GLuint tableSize = count < kTrigBlock ? count : kTrigBlock;
+		GLfloat ct[kTrigBlock], st[kTrigBlock];
+		for (GLuint j = 0; j < tableSize; ++j)
+		{
+			ct[j] = (GLfloat)std::cos(step * j);
+			st[j] = (GLfloat)std::sin(step * j);
+		}
+
+		for (GLuint base = 0; base < count; base += kTrigBlock)
+		{
+			GLuint n = count - base < kTrigBlock ? count - base : kTrigBlock;
+			double anchor = start + step * base;
+			GLfloat ca = (GLfloat)std::cos(anchor);
+			GLfloat sa = (GLfloat)std::sin(anchor);
+			GLfloat* out = dst + (size_t)base * stride;
+			for (GLuint j = 0; j < n; ++j)
+			{
+				GLuint k = base + j;
+				GLfloat r = (alternate && (k & 1u)) ? rAlt : r0 + dr * (GLfloat)k;
+				out[(size_t)j * stride + 0] = cx + r * (ca * ct[j] - sa * st[j]); // x
+				out[(size_t)j * stride + 1] = cy + r * (sa * ct[j] + ca * st[j]); // y
+				out[(size_t)j * stride + 2] = 0.0f;                               // z
+			}
+		}
+	}
+}
+
+// Escreve os vértices (x, y, z) da forma em dst, pulando stride floats entre
+// um vértice e o próximo (stride = 3 para posições puras, 6 para posição + cor...)
+inline void writeShapeVertices(const ShapeDesc& d, GLfloat* dst, GLuint stride = 3)
+{
+	if (d.segments == 0)
+		return;
+
+	if (d.type == ShapeType::Spiral)
+	{
+		double step = d.segments > 1 ? (double)d.endAngle / (d.segments - 1) : 0.0;
+		shapes_detail::writeRim(dst, stride, d.segments, d.cx, d.cy,
+			0.0, step, d.a, d.b * (float)step, false, 0.0f);
+		return;
+	}
+
+	// Vértice central
+	dst[0] = d.cx;
+	dst[1] = d.cy;
+	dst[2] = 0.0f;
+
+	double start = d.startAngle;
+	double step = d.type == ShapeType::Sector
+		? ((double)d.endAngle - d.startAngle) / d.segments
+		: 2.0 * M_PI / d.segments;
+	shapes_detail::writeRim(dst + stride, stride, shapeRimCount(d), d.cx, d.cy,
+		start, step, d.radius, 0.0f, d.type == ShapeType::Star, d.innerRadius);
+}
+
+// Escreve os índices da forma em dst, somando baseVertex a cada índice
+// (permite empacotar várias formas no mesmo VBO/EBO)
+inline void writeShapeIndices(const ShapeDesc& d, GLuint* dst, GLuint baseVertex = 0)
+{
+	if (d.type == ShapeType::Spiral)
+	{
+		for (GLuint i = 0; i < d.segments; ++i)
+			dst[i] = baseVertex + i;
+		return;
+	}
+
+	// Triângulos (centro, i, i + 1) - o polígono e a estrela fecham no primeiro ponto da borda
+	GLuint rim = shapeRimCount(d);
+	bool closed = d.type != ShapeType::Sector;
+	for (GLuint i = 0; i < d.segments; ++i)
+	{
+		GLuint next = (closed && i + 1 == rim) ? 0 : i + 1;
+		dst[3 * i + 0] = baseVertex;
+		dst[3 * i + 1] = baseVertex + 1 + i;
+		dst[3 * i + 2] = baseVertex + 1 + next;
+	}
+}
+
+// Desfaz um uploadShape que falhou: desvincula e apaga o VAO e os buffers já criados
+inline ShapeMesh abandonShapeUpload(ShapeMesh& mesh)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+	glDeleteVertexArrays(1, &mesh.VAO);
+	glDeleteBuffers(1, &mesh.VBO);
+	glDeleteBuffers(1, &mesh.EBO);
+	return ShapeMesh();
+}
+
+// Cria VAO, VBO e EBO para a forma, escrevendo os dados direto nos buffers
+// mapeados (nenhuma cópia intermediária na memória do processo)
+// Apenas atributo coordenada nos vértices (layout 0, vec3)
+// Se um buffer não puder ser mapeado (alocação grande demais), devolve uma malha vazia
+inline ShapeMesh uploadShape(const ShapeDesc& d)
+{
+	ShapeMesh mesh;
+	mesh.mode = shapePrimitive(d);
+	mesh.indexCount = (GLsizei)shapeIndexCount(d);
+
+	GLsizeiptr vertexBytes = (GLsizeiptr)shapeVertexCount(d) * 3 * sizeof(GLfloat);
+	GLsizeiptr indexBytes = (GLsizeiptr)mesh.indexCount * sizeof(GLuint);
+
+	glGenVertexArrays(1, &mesh.VAO);
+	glBindVertexArray(mesh.VAO);
+
+	glGenBuffers(1, &mesh.VBO);
+	glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+	glBufferData(GL_ARRAY_BUFFER, vertexBytes, NULL, GL_STATIC_DRAW);
+	GLfloat* vertices = (GLfloat*)glMapBufferRange(GL_ARRAY_BUFFER, 0, vertexBytes,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (!vertices)
+	{
+		std::cout << "ERROR::SHAPES::MAP_FAILED vertex buffer, " << vertexBytes << " bytes" << std::endl;
+		return abandonShapeUpload(mesh);
+	}
+	writeShapeVertices(d, vertices);
+	glUnmapBuffer(GL_ARRAY_BUFFER);
+
+	// O EBO fica registrado no VAO
+	glGenBuffers(1, &mesh.EBO);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, NULL, GL_STATIC_DRAW);
+	GLuint* indices = (GLuint*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, indexBytes,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (!indices)
+	{
+		std::cout << "ERROR::SHAPES::MAP_FAILED index buffer, " << indexBytes << " bytes" << std::endl;
+		return abandonShapeUpload(mesh);
+	}
+	writeShapeIndices(d, indices);
+	glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
+	glEnableVertexAttribArray(0);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+
+	return mesh;
+}
+
+// Desenha a malha inteira (o VAO precisa estar vinculado)
+inline void drawShape(const ShapeMesh& mesh)
+{
+	glDrawElements(mesh.mode, mesh.indexCount, GL_UNSIGNED_INT, (GLvoid*)0);
+}
+
+inline void deleteShape(ShapeMesh& mesh)
+{
+	glDeleteVertexArrays(1, &mesh.VAO);
+	glDeleteBuffers(1, &mesh.VBO);
+	glDeleteBuffers(1, &mesh.EBO);
+	mesh = ShapeMesh();
+}
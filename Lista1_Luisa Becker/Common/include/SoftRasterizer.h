@@ -0,0 +1,597 @@
+// Rasterizador em software: executa na CPU as primitivas usadas nos exercícios
+// (GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, GL_LINES, GL_LINE_STRIP,
+// GL_LINE_LOOP e GL_POINTS) e desenha em um framebuffer na memória, sem OpenGL
+//
+// Os vértices seguem os layouts dos exercícios: só a posição (x, y, z), com a cor
+// do uniform inputColor (Ex5 a Ex7), ou posição + cor intercaladas (Ex8 e Ex9).
+// Como nos vertex shaders dos exercícios, as posições já estão em NDC (w = 1);
+// não há teste de profundidade nem blending, que nenhum exercício habilita.
+//
+// Cada chamada de desenho monta os triângulos (linhas e pontos viram
+// quadriláteros de dois triângulos) e os distribui nas listas dos tiles de 64x64
+// pixels que eles tocam. Em finish(), os tiles são rasterizados em paralelo, um
+// tile por thread de cada vez, com as funções de aresta avaliadas em 4 pixels
+// por instrução (SSE2). Dentro de um tile os triângulos são desenhados na ordem
+// em que foram enviados, então a imagem é a mesma com qualquer número de threads.
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+
+//GLAD (apenas as constantes das primitivas)
+#include <glad/glad.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOFT_RASTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Layout dos vértices de uma chamada de desenho
+struct SoftVertexLayout
+{
+	GLuint stride = 3;      // Floats por vértice
+	GLint colorOffset = -1; // Início da cor (r, g, b) no vértice; -1 usa o inputColor
+};
+
+// Ex5 a Ex7: posição (x, y, z) e cor do uniform inputColor
+inline SoftVertexLayout softPositionLayout()
+{
+	return SoftVertexLayout();
+}
+
+// Ex8 e Ex9: posição (x, y, z) e cor (r, g, b) intercaladas
+inline SoftVertexLayout softPositionColorLayout()
+{
+	SoftVertexLayout layout;
+	layout.stride = 6;
+	layout.colorOffset = 3;
+	return layout;
+}
+
+// Contadores do último finish()
+struct SoftRasterStats
+{
+	size_t triangles = 0;  // Triângulos montados (linhas e pontos contam 2)
+	size_t binEntries = 0; // Referências de triângulos nas listas dos tiles
+	size_t fullTiles = 0;  // Referências em que o triângulo cobre o tile inteiro
+	size_t tiles = 0;
+	unsigned threads = 0;
+	double finishMs = 0.0; // Tempo da rasterização dos tiles
+};
+
+class SoftRasterizer
+{
+public:
+	static const int kTileSize = 64;
+
+	// threads = 0 usa todos os núcleos da máquina
+	SoftRasterizer(int width, int height, unsigned threads = 0)
+		: width(width), height(height)
+	{
+		tilesX = (width + kTileSize - 1) / kTileSize;
+		tilesY = (height + kTileSize - 1) / kTileSize;
+		// As linhas têm tiles inteiros: os 4 pixels de cada passo SIMD nunca saem do buffer
+		pitch = tilesX * kTileSize;
+		color.assign((size_t)pitch * tilesY * kTileSize, 0);
+		bins.resize((size_t)tilesX * tilesY);
+
+		threadCount = threads ? threads : std::thread::hardware_concurrency();
+		if (threadCount == 0)
+			threadCount = 1;
+	}
+
+	// Equivalente ao glUniform4f do inputColor, para vértices sem cor
+	void setInputColor(float r, float g, float b, float a = 1.0f)
+	{
+		inputColor[0] = r;
+		inputColor[1] = g;
+		inputColor[2] = b;
+		inputColor[3] = a;
+	}
+
+	void setLineWidth(float w) { lineWidth = w < 1.0f ? 1.0f : w; }
+	void setPointSize(float s) { pointSize = s < 1.0f ? 1.0f : s; }
+
+	// Equivalente a glClearColor + glClear(GL_COLOR_BUFFER_BIT): descarta o que
+	// ainda não foi rasterizado, e cada tile é limpo no início do próximo finish()
+	void clear(float r, float g, float b, float a = 1.0f)
+	{
+		float c[4] = { r, g, b, a };
+		clearColor = packColor(c);
+		pendingClear = true;
+		triangles.clear();
+		for (size_t i = 0; i < bins.size(); ++i)
+			bins[i].clear();
+	}
+
+	// Equivalente a glDrawArrays: count vértices a partir de first
+	void drawArrays(GLenum mode, const GLfloat* vertices, GLint first, GLsizei count,
+		const SoftVertexLayout& layout)
+	{
+		if (count <= 0)
+			return;
+		fetchVertices(vertices + (size_t)first * layout.stride, count, layout);
+		assemble(mode, NULL, count);
+	}
+
+	// Equivalente a glDrawElements com índices GL_UNSIGNED_INT
+	void drawElements(GLenum mode, const GLuint* indices, GLsizei count,
+		const GLfloat* vertices, const SoftVertexLayout& layout)
+	{
+		if (count <= 0)
+			return;
+		// Cada vértice referenciado é transformado uma única vez
+		GLuint maxIndex = *std::max_element(indices, indices + count);
+		fetchVertices(vertices, (GLsizei)maxIndex + 1, layout);
+		assemble(mode, indices, count);
+	}
+
+	// Rasteriza todos os tiles em paralelo; depois disso pixels() tem a imagem
+	void finish()
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		lastStats = SoftRasterStats();
+		lastStats.triangles = triangles.size();
+		lastStats.tiles = bins.size();
+		for (size_t i = 0; i < bins.size(); ++i)
+		{
+			lastStats.binEntries += bins[i].size();
+			for (size_t j = 0; j < bins[i].size(); ++j)
+				lastStats.fullTiles += (bins[i][j] & kFullTile) ? 1 : 0;
+		}
+
+		std::atomic<size_t> nextTile(0);
+		auto worker = [this, &nextTile]()
+		{
+			for (;;)
+			{
+				size_t tile = nextTile.fetch_add(1);
+				if (tile >= bins.size())
+					break;
+				rasterizeTile((int)tile);
+			}
+		};
+
+		unsigned workers = (unsigned)std::min<size_t>(threadCount, bins.size());
+		std::vector<std::thread> pool;
+		for (unsigned i = 1; i < workers; ++i)
+			pool.emplace_back(worker);
+		worker(); // A thread que chamou também trabalha
+		for (size_t i = 0; i < pool.size(); ++i)
+			pool[i].join();
+
+		triangles.clear();
+		for (size_t i = 0; i < bins.size(); ++i)
+			bins[i].clear();
+		pendingClear = false;
+
+		lastStats.threads = workers;
+		lastStats.finishMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	const SoftRasterStats& stats() const { return lastStats; }
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	unsigned getThreadCount() const { return threadCount; }
+
+	// Pixels RGBA8 (r no byte menos significativo), linha de cima primeiro,
+	// com getPitch() pixels por linha
+	const uint32_t* pixels() const { return color.data(); }
+	int getPitch() const { return pitch; }
+
+	// Pixel (x, y) com y = 0 na linha de cima da imagem
+	uint32_t pixel(int x, int y) const
+	{
+		return color[(size_t)y * pitch + x];
+	}
+
+	// Grava a imagem no formato PPM binário (P6)
+	bool writePPM(const std::string& path) const
+	{
+		FILE* file = fopen(path.c_str(), "wb");
+		if (!file)
+		{
+			std::cout << "ERROR::SOFT_RASTER::FILE_NOT_WRITTEN " << path << std::endl;
+			return false;
+		}
+		fprintf(file, "P6\n%d %d\n255\n", width, height);
+		std::vector<unsigned char> row((size_t)width * 3);
+		for (int y = 0; y < height; ++y)
+		{
+			const uint32_t* src = color.data() + (size_t)y * pitch;
+			for (int x = 0; x < width; ++x)
+			{
+				row[x * 3 + 0] = (unsigned char)(src[x] & 0xFF);
+				row[x * 3 + 1] = (unsigned char)((src[x] >> 8) & 0xFF);
+				row[x * 3 + 2] = (unsigned char)((src[x] >> 16) & 0xFF);
+			}
+			fwrite(row.data(), 1, row.size(), file);
+		}
+		fclose(file);
+		return true;
+	}
+
+private:
+	// Vértice já em coordenadas de tela (pixels, y para baixo)
+	struct ScreenVertex
+	{
+		float x, y;
+		float c[4];
+	};
+
+	// Triângulo pronto para rasterizar. Aresta i: E(x, y) = A*x + B*y + C, positiva
+	// no interior; E0/área, E1/área e E2/área são os pesos dos vértices 0, 1 e 2
+	struct Triangle
+	{
+		float A[3], B[3];
+		double C[3];
+		bool topLeft[3];            // Desempate dos pixels exatamente sobre a aresta
+		int minX, minY, maxX, maxY; // Pixels cobertos pela caixa envolvente
+		bool flat;                  // Mesma cor nos três vértices
+		uint32_t flatColor;
+		float dcdx[4], dcdy[4];     // Plano de cada canal de cor
+		double c0[4];
+	};
+
+	// Bit mais alto da entrada do tile: o triângulo cobre o tile inteiro
+	static const uint32_t kFullTile = 0x80000000u;
+
+	static uint32_t packColor(const float c[4])
+	{
+		uint32_t packed = 0;
+		for (int k = 0; k < 4; ++k)
+		{
+			float v = c[k] < 0.0f ? 0.0f : (c[k] > 1.0f ? 1.0f : c[k]);
+			packed |= (uint32_t)(v * 255.0f + 0.5f) << (8 * k);
+		}
+		return packed;
+	}
+
+	// Coordenadas de tela com 4 bits de subpixel: com elas as funções de aresta
+	// perto de zero são exatas em float, e arestas compartilhadas não deixam frestas
+	static float snap(float v)
+	{
+		return std::floor(v * 16.0f + 0.5f) / 16.0f;
+	}
+
+	void fetchVertices(const GLfloat* vertices, GLsizei count, const SoftVertexLayout& layout)
+	{
+		fetch.resize(count);
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			const GLfloat* v = vertices + (size_t)i * layout.stride;
+			ScreenVertex& s = fetch[i];
+			s.x = (v[0] * 0.5f + 0.5f) * width;
+			s.y = (0.5f - v[1] * 0.5f) * height;
+			if (layout.colorOffset >= 0)
+			{
+				s.c[0] = v[layout.colorOffset + 0];
+				s.c[1] = v[layout.colorOffset + 1];
+				s.c[2] = v[layout.colorOffset + 2];
+				s.c[3] = 1.0f;
+			}
+			else
+				std::copy(inputColor, inputColor + 4, s.c);
+		}
+	}
+
+	// Montagem das primitivas a partir dos vértices transformados
+	void assemble(GLenum mode, const GLuint* indices, GLsizei count)
+	{
+		#define SOFT_VERTEX(i) fetch[indices ? indices[i] : (i)]
+		switch (mode)
+		{
+		case GL_TRIANGLES:
+			for (GLsizei i = 0; i + 2 < count; i += 3)
+				addTriangle(SOFT_VERTEX(i), SOFT_VERTEX(i + 1), SOFT_VERTEX(i + 2));
+			break;
+		case GL_TRIANGLE_STRIP:
+			for (GLsizei i = 0; i + 2 < count; ++i)
+			{
+				if (i & 1)
+					addTriangle(SOFT_VERTEX(i + 1), SOFT_VERTEX(i), SOFT_VERTEX(i + 2));
+				else
+					addTriangle(SOFT_VERTEX(i), SOFT_VERTEX(i + 1), SOFT_VERTEX(i + 2));
+			}
+			break;
+		case GL_TRIANGLE_FAN:
+			for (GLsizei i = 1; i + 1 < count; ++i)
+				addTriangle(SOFT_VERTEX(0), SOFT_VERTEX(i), SOFT_VERTEX(i + 1));
+			break;
+		case GL_LINES:
+			for (GLsizei i = 0; i + 1 < count; i += 2)
+				addLine(SOFT_VERTEX(i), SOFT_VERTEX(i + 1));
+			break;
+		case GL_LINE_STRIP:
+		case GL_LINE_LOOP:
+			for (GLsizei i = 0; i + 1 < count; ++i)
+				addLine(SOFT_VERTEX(i), SOFT_VERTEX(i + 1));
+			if (mode == GL_LINE_LOOP && count > 1)
+				addLine(SOFT_VERTEX(count - 1), SOFT_VERTEX(0));
+			break;
+		case GL_POINTS:
+			for (GLsizei i = 0; i < count; ++i)
+				addPoint(SOFT_VERTEX(i));
+			break;
+		default:
+			std::cout << "ERROR::SOFT_RASTER::UNSUPPORTED_PRIMITIVE 0x" << std::hex << mode << std::dec << std::endl;
+			break;
+		}
+		#undef SOFT_VERTEX
+	}
+
+	// Linha larga como na OpenGL sem antialiasing: um paralelogramo deslocado
+	// lineWidth pixels na direção menor (vertical se a linha for mais horizontal)
+	void addLine(const ScreenVertex& a, const ScreenVertex& b)
+	{
+		float dx = b.x - a.x, dy = b.y - a.y;
+		if (dx == 0.0f && dy == 0.0f)
+			return;
+		float half = lineWidth * 0.5f;
+		float ox = std::fabs(dx) >= std::fabs(dy) ? 0.0f : half;
+		float oy = ox == 0.0f ? half : 0.0f;
+		ScreenVertex a0 = a, a1 = a, b0 = b, b1 = b;
+		a0.x -= ox; a0.y -= oy;
+		a1.x += ox; a1.y += oy;
+		b0.x -= ox; b0.y -= oy;
+		b1.x += ox; b1.y += oy;
+		addTriangle(a0, b0, b1);
+		addTriangle(a0, b1, a1);
+	}
+
+	// Ponto: quadrado de pointSize pixels centrado no vértice
+	void addPoint(const ScreenVertex& p)
+	{
+		float half = pointSize * 0.5f;
+		ScreenVertex v[4] = { p, p, p, p };
+		v[0].x -= half; v[0].y -= half;
+		v[1].x += half; v[1].y -= half;
+		v[2].x += half; v[2].y += half;
+		v[3].x -= half; v[3].y += half;
+		addTriangle(v[0], v[1], v[2]);
+		addTriangle(v[0], v[2], v[3]);
+	}
+
+	// Prepara as funções de aresta e distribui o triângulo nos tiles que ele toca
+	void addTriangle(const ScreenVertex& s0, const ScreenVertex& s1, const ScreenVertex& s2)
+	{
+		const ScreenVertex* v[3] = { &s0, &s1, &s2 };
+		float x[3], y[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			x[i] = snap(v[i]->x);
+			y[i] = snap(v[i]->y);
+		}
+
+		// Sem culling: os triângulos no sentido contrário têm dois vértices trocados
+		double area = (double)(x[1] - x[0]) * (y[2] - y[0]) - (double)(y[1] - y[0]) * (x[2] - x[0]);
+		if (area == 0.0)
+			return;
+		if (area < 0.0)
+		{
+			std::swap(v[1], v[2]);
+			std::swap(x[1], x[2]);
+			std::swap(y[1], y[2]);
+			area = -area;
+		}
+
+		Triangle t;
+		float minXf = std::min(x[0], std::min(x[1], x[2]));
+		float maxXf = std::max(x[0], std::max(x[1], x[2]));
+		float minYf = std::min(y[0], std::min(y[1], y[2]));
+		float maxYf = std::max(y[0], std::max(y[1], y[2]));
+		// Pixel (px, py) é coberto quando o seu centro (px + 0.5, py + 0.5) está dentro
+		t.minX = std::max(0, (int)std::ceil(minXf - 0.5f));
+		t.maxX = std::min(width - 1, (int)std::floor(maxXf - 0.5f));
+		t.minY = std::max(0, (int)std::ceil(minYf - 0.5f));
+		t.maxY = std::min(height - 1, (int)std::floor(maxYf - 0.5f));
+		if (t.minX > t.maxX || t.minY > t.maxY)
+			return;
+
+		// Aresta i liga os dois vértices que não são o vértice i
+		for (int i = 0; i < 3; ++i)
+		{
+			int a = (i + 1) % 3, b = (i + 2) % 3;
+			t.A[i] = y[a] - y[b];
+			t.B[i] = x[b] - x[a];
+			t.C[i] = -((double)t.A[i] * x[a] + (double)t.B[i] * y[a]);
+			// Cada aresta compartilhada aparece com sinais opostos nos dois
+			// triângulos, então só um deles fica com os pixels sobre ela
+			t.topLeft[i] = t.A[i] > 0.0f || (t.A[i] == 0.0f && t.B[i] < 0.0f);
+		}
+
+		t.flat = true;
+		for (int k = 0; k < 4; ++k)
+			t.flat = t.flat && v[0]->c[k] == v[1]->c[k] && v[0]->c[k] == v[2]->c[k];
+		t.flatColor = packColor(v[0]->c);
+		double invArea = 1.0 / area;
+		for (int k = 0; k < 4; ++k)
+		{
+			t.dcdx[k] = (float)((t.A[0] * v[0]->c[k] + t.A[1] * v[1]->c[k] + t.A[2] * v[2]->c[k]) * invArea);
+			t.dcdy[k] = (float)((t.B[0] * v[0]->c[k] + t.B[1] * v[1]->c[k] + t.B[2] * v[2]->c[k]) * invArea);
+			t.c0[k] = (t.C[0] * v[0]->c[k] + t.C[1] * v[1]->c[k] + t.C[2] * v[2]->c[k]) * invArea;
+		}
+
+		uint32_t index = (uint32_t)triangles.size();
+		triangles.push_back(t);
+		binTriangle(t, index);
+	}
+
+	// Testa os cantos de cada tile da caixa envolvente contra as três arestas:
+	// tiles totalmente fora de uma aresta são descartados, e tiles totalmente
+	// dentro das três são marcados para serem pintados sem teste por pixel
+	void binTriangle(const Triangle& t, uint32_t index)
+	{
+		int tx0 = t.minX / kTileSize, tx1 = t.maxX / kTileSize;
+		int ty0 = t.minY / kTileSize, ty1 = t.maxY / kTileSize;
+		for (int ty = ty0; ty <= ty1; ++ty)
+		{
+			double cy0 = ty * kTileSize + 0.5, cy1 = cy0 + kTileSize - 1;
+			for (int tx = tx0; tx <= tx1; ++tx)
+			{
+				double cx0 = tx * kTileSize + 0.5, cx1 = cx0 + kTileSize - 1;
+				bool outside = false, full = true;
+				for (int i = 0; i < 3 && !outside; ++i)
+				{
+					double maxE = t.A[i] * (t.A[i] > 0.0f ? cx1 : cx0) + t.B[i] * (t.B[i] > 0.0f ? cy1 : cy0) + t.C[i];
+					double minE = t.A[i] * (t.A[i] > 0.0f ? cx0 : cx1) + t.B[i] * (t.B[i] > 0.0f ? cy0 : cy1) + t.C[i];
+					outside = maxE < 0.0;
+					full = full && minE > 0.0;
+				}
+				if (!outside)
+					bins[(size_t)ty * tilesX + tx].push_back(index | (full ? kFullTile : 0u));
+			}
+		}
+	}
+
+	void rasterizeTile(int tile)
+	{
+		int x0 = (tile % tilesX) * kTileSize;
+		int y0 = (tile / tilesX) * kTileSize;
+		if (pendingClear)
+		{
+			for (int y = y0; y < y0 + kTileSize; ++y)
+				std::fill_n(color.data() + (size_t)y * pitch + x0, kTileSize, clearColor);
+		}
+
+		const std::vector<uint32_t>& bin = bins[tile];
+		for (size_t i = 0; i < bin.size(); ++i)
+		{
+			const Triangle& t = triangles[bin[i] & ~kFullTile];
+			if (bin[i] & kFullTile)
+			{
+				shadeSpan(t, x0, y0, x0 + kTileSize - 1, y0 + kTileSize - 1, false);
+				continue;
+			}
+			// Caixa envolvente recortada no tile, começando em múltiplo de 4 pixels
+			int minX = std::max(t.minX, x0) & ~3;
+			int maxX = std::min(t.maxX, x0 + kTileSize - 1);
+			int minY = std::max(t.minY, y0);
+			int maxY = std::min(t.maxY, y0 + kTileSize - 1);
+			shadeSpan(t, minX, minY, maxX, maxY, true);
+		}
+	}
+
+	// Pinta o retângulo [minX, maxX] x [minY, maxY] (minX múltiplo de 4); com
+	// testEdges falso, todos os pixels do retângulo estão dentro do triângulo
+	void shadeSpan(const Triangle& t, int minX, int minY, int maxX, int maxY, bool testEdges)
+	{
+		if (!testEdges && t.flat)
+		{
+			for (int y = minY; y <= maxY; ++y)
+				std::fill_n(color.data() + (size_t)y * pitch + minX, maxX - minX + 1, t.flatColor);
+			return;
+		}
+
+		for (int y = minY; y <= maxY; ++y)
+		{
+			uint32_t* row = color.data() + (size_t)y * pitch;
+			double cy = y + 0.5;
+			for (int x = minX; x <= maxX; x += 4)
+			{
+				double cx = x + 0.5;
+				// Valores exatos no primeiro pixel do grupo; os outros 3 somam A
+				float e[3], c[4];
+				for (int k = 0; k < 3; ++k)
+					e[k] = (float)(t.A[k] * cx + t.B[k] * cy + t.C[k]);
+				if (!t.flat)
+				{
+					for (int k = 0; k < 4; ++k)
+						c[k] = (float)(t.c0[k] + t.dcdx[k] * cx + t.dcdy[k] * cy);
+				}
+				shade4(t, row + x, e, c, testEdges);
+			}
+		}
+	}
+
+#ifdef SOFT_RASTER_SSE2
+	// 4 pixels consecutivos: máscara de cobertura pelas 3 arestas e cor interpolada
+	static void shade4(const Triangle& t, uint32_t* dst, const float e[3], const float c[4], bool testEdges)
+	{
+		const __m128 lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+		const __m128 zero = _mm_setzero_ps();
+		__m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		if (testEdges)
+		{
+			for (int k = 0; k < 3; ++k)
+			{
+				__m128 ek = _mm_add_ps(_mm_set1_ps(e[k]), _mm_mul_ps(_mm_set1_ps(t.A[k]), lanes));
+				mask = _mm_and_ps(mask, t.topLeft[k] ? _mm_cmpge_ps(ek, zero) : _mm_cmpgt_ps(ek, zero));
+			}
+			if (_mm_movemask_ps(mask) == 0)
+				return;
+		}
+
+		__m128i pixels;
+		if (t.flat)
+			pixels = _mm_set1_epi32((int)t.flatColor);
+		else
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 scale = _mm_set1_ps(255.0f);
+			const __m128 half = _mm_set1_ps(0.5f);
+			pixels = _mm_setzero_si128();
+			for (int k = 0; k < 4; ++k)
+			{
+				__m128 ck = _mm_add_ps(_mm_set1_ps(c[k]), _mm_mul_ps(_mm_set1_ps(t.dcdx[k]), lanes));
+				ck = _mm_min_ps(_mm_max_ps(ck, zero), one);
+				__m128i bytes = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(ck, scale), half));
+				pixels = _mm_or_si128(pixels, _mm_sll_epi32(bytes, _mm_cvtsi32_si128(8 * k)));
+			}
+		}
+
+		__m128i m = _mm_castps_si128(mask);
+		__m128i old = _mm_loadu_si128((const __m128i*)dst);
+		_mm_storeu_si128((__m128i*)dst, _mm_or_si128(_mm_and_si128(m, pixels), _mm_andnot_si128(m, old)));
+	}
+#else
+	static void shade4(const Triangle& t, uint32_t* dst, const float e[3], const float c[4], bool testEdges)
+	{
+		for (int j = 0; j < 4; ++j)
+		{
+			bool inside = true;
+			for (int k = 0; k < 3 && testEdges; ++k)
+			{
+				float ek = e[k] + t.A[k] * j;
+				inside = inside && (t.topLeft[k] ? ek >= 0.0f : ek > 0.0f);
+			}
+			if (!inside)
+				continue;
+			if (t.flat)
+			{
+				dst[j] = t.flatColor;
+				continue;
+			}
+			float cj[4];
+			for (int k = 0; k < 4; ++k)
+				cj[k] = c[k] + t.dcdx[k] * j;
+			dst[j] = packColor(cj);
+		}
+	}
+#endif
+
+	int width, height;
+	int tilesX, tilesY, pitch;
+	unsigned threadCount;
+
+	std::vector<uint32_t> color;              // Framebuffer RGBA8
+	std::vector<Triangle> triangles;          // Triângulos desde o último finish()
+	std::vector<std::vector<uint32_t>> bins;  // Índices dos triângulos de cada tile
+	std::vector<ScreenVertex> fetch;          // Vértices da chamada de desenho atual
+
+	float inputColor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	float lineWidth = 1.0f, pointSize = 1.0f;
+	uint32_t clearColor = 0;
+	bool pendingClear = false;
+	SoftRasterStats lastStats;
+};
@@ -0,0 +1,306 @@
+// Buffer em anel para geometria que muda a cada frame (vértices e índices)
+//
+// Um único buffer com kStreamFrames regiões (triple buffering): no frame N a
+// aplicação escreve na região N % 3 enquanto a GPU ainda pode estar lendo as
+// outras duas. Ao fim de cada frame um fence (glFenceSync) marca a região; antes
+// de reescrevê-la, beginFrame() espera esse fence - em uso normal ele já foi
+// sinalizado e a espera não acontece.
+//
+// Com glBufferStorage (OpenGL 4.4 / ARB_buffer_storage) o buffer é mapeado uma
+// única vez, com GL_MAP_PERSISTENT_BIT e GL_MAP_COHERENT_BIT: os vértices são
+// escritos direto na memória que a GPU lê, sem cópia do driver e sem o
+// sincronismo implícito de glBufferData/glBufferSubData. A GLAD do projeto é
+// da OpenGL 4.0, então glBufferStorage é carregada aqui com o carregador da
+// AppWindow. Sem ela, cada alocação é mapeada com glMapBufferRange e
+// GL_MAP_UNSYNCHRONIZED_BIT (os fences continuam garantindo a segurança).
+//
+// Uso em um frame:
+//   stream.beginFrame();
+//   GLintptr offset;
+//   GLfloat* v = (GLfloat*)stream.allocate(bytes, 3 * sizeof(GLfloat), &offset);
+//   ... escreve os vértices em v ...
+//   stream.unmap();  // antes de desenhar (só faz algo sem glBufferStorage)
+//   ... desenho usando offset ...
+//   stream.endFrame();
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+
+//GLAD
+#include <glad/glad.h>
+
+#include "Shapes.h"
+#include "Curves.h"
+
+// Constantes da OpenGL 4.4 que não estão na GLAD 4.0
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
+// Regiões do anel: a CPU escreve uma enquanto a GPU lê as anteriores
+const int kStreamFrames = 3;
+
+struct StreamBufferStats
+{
+	unsigned long long frames = 0;
+	unsigned long long bytesWritten = 0;
+	unsigned fenceWaits = 0;   // Frames em que a região ainda estava em uso pela GPU
+	double waitMs = 0.0;       // Tempo total esperando fences
+	unsigned overflows = 0;    // Alocações que não couberam na região do frame
+};
+
+class StreamBuffer
+{
+public:
+	// Cria o buffer com kStreamFrames regiões de bytesPerFrame bytes
+	// (o contexto precisa estar ativo)
+	void init(GLADloadproc loader, GLsizeiptr bytesPerFrame)
+	{
+		// Folga de 64 bytes para o alinhamento das alocações
+		regionSize = (bytesPerFrame + 64 + 255) / 256 * 256;
+		GLsizeiptr total = regionSize * kStreamFrames;
+
+		BufferStorageProc bufferStorage = loader ? (BufferStorageProc)loader("glBufferStorage") : NULL;
+		glGenBuffers(1, &id);
+		glBindBuffer(GL_ARRAY_BUFFER, id);
+		if (bufferStorage)
+		{
+			GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			bufferStorage(GL_ARRAY_BUFFER, total, NULL, flags);
+			persistentBase = (char*)glMapBufferRange(GL_ARRAY_BUFFER, 0, total, flags);
+		}
+		if (!persistentBase)
+		{
+			// Sem glBufferStorage (ou o mapeamento falhou): buffer comum
+			if (bufferStorage)
+			{
+				glDeleteBuffers(1, &id);
+				glGenBuffers(1, &id);
+				glBindBuffer(GL_ARRAY_BUFFER, id);
+			}
+			glBufferData(GL_ARRAY_BUFFER, total, NULL, GL_STREAM_DRAW);
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	GLuint buffer() const { return id; }
+	bool isPersistent() const { return persistentBase != NULL; }
+	GLsizeiptr frameCapacity() const { return regionSize; }
+	const StreamBufferStats& getStats() const { return stats; }
+
+	// Começa a escrita do frame: espera a GPU liberar a região da vez
+	void beginFrame()
+	{
+		GLsync& fence = fences[region];
+		if (fence)
+		{
+			GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+			if (result == GL_TIMEOUT_EXPIRED)
+			{
+				auto start = std::chrono::steady_clock::now();
+				++stats.fenceWaits;
+				do
+					result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+				while (result == GL_TIMEOUT_EXPIRED);
+				stats.waitMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			}
+			glDeleteSync(fence);
+			fence = 0;
+		}
+		head = region * regionSize;
+	}
+
+	// Reserva bytes na região do frame, com o início múltiplo de alignment (o
+	// tamanho do vértice, para usar o deslocamento como baseVertex/first).
+	// Retorna o ponteiro para escrita e, em offset, a posição dentro do buffer;
+	// NULL se não couber
+	void* allocate(GLsizeiptr bytes, GLsizeiptr alignment, GLintptr* offset)
+	{
+		unmap();
+		GLintptr start = (head + alignment - 1) / alignment * alignment;
+		if (start + bytes > (region + 1) * regionSize)
+		{
+			std::cout << "ERROR::STREAM_BUFFER::FRAME_OVERFLOW " << bytes << " bytes" << std::endl;
+			++stats.overflows;
+			return NULL;
+		}
+		head = start + bytes;
+		*offset = start;
+		stats.bytesWritten += bytes;
+
+		if (persistentBase)
+			return persistentBase + start;
+		glBindBuffer(GL_ARRAY_BUFFER, id);
+		mapped = glMapBufferRange(GL_ARRAY_BUFFER, start, bytes,
+			GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		return mapped;
+	}
+
+	// Fecha o mapeamento da última alocação (necessário antes de desenhar
+	// quando não há mapeamento persistente)
+	void unmap()
+	{
+		if (!mapped)
+			return;
+		glBindBuffer(GL_ARRAY_BUFFER, id);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		mapped = NULL;
+	}
+
+	// Depois das chamadas de desenho do frame: marca a região e passa para a próxima
+	void endFrame()
+	{
+		unmap();
+		fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		region = (region + 1) % kStreamFrames;
+		++stats.frames;
+	}
+
+	void printStats(std::ostream& out) const
+	{
+		out << "Stream buffer: " << (persistentBase ? "persistent mapping" : "unsynchronized glMapBufferRange")
+			<< ", " << kStreamFrames << " x " << regionSize << " bytes, " << stats.bytesWritten << " bytes in "
+			<< stats.frames << " frames, " << stats.fenceWaits << " fence waits (" << stats.waitMs << " ms)";
+		if (stats.overflows)
+			out << ", " << stats.overflows << " overflows";
+		out << std::endl;
+	}
+
+	void release()
+	{
+		unmap();
+		for (int i = 0; i < kStreamFrames; ++i)
+		{
+			if (fences[i])
+				glDeleteSync(fences[i]);
+			fences[i] = 0;
+		}
+		if (persistentBase)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, id);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			persistentBase = NULL;
+		}
+		glDeleteBuffers(1, &id);
+		id = 0;
+	}
+
+private:
+	typedef void (APIENTRYP BufferStorageProc)(GLenum, GLsizeiptr, const void*, GLbitfield);
+
+	GLuint id = 0;
+	GLsizeiptr regionSize = 0;
+	int region = 0;
+	GLintptr head = 0;
+	char* persistentBase = NULL;
+	void* mapped = NULL;
+	GLsync fences[kStreamFrames] = {};
+	StreamBufferStats stats;
+};
+
+// Desenho de geometria escrita no anel no frame atual
+struct StreamedDraw
+{
+	GLenum mode = GL_TRIANGLES;
+	GLsizei count = 0;        // Índices (indexed) ou vértices
+	GLint baseVertex = 0;     // Primeiro vértice dentro do buffer
+	GLintptr indexOffset = 0; // Posição dos índices no buffer
+	bool indexed = false;
+};
+
+// VAO que lê posições (layout 0, vec3) e índices do anel
+// O deslocamento de cada frame entra no desenho (baseVertex), não no VAO
+inline GLuint createStreamPositionVAO(const StreamBuffer& stream)
+{
+	GLuint VAO;
+	glGenVertexArrays(1, &VAO);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, stream.buffer());
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, stream.buffer());
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
+	glEnableVertexAttribArray(0);
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	return VAO;
+}
+
+// Escreve os vértices e índices da forma (Shapes.h) no anel
+inline StreamedDraw streamShape(StreamBuffer& stream, const ShapeDesc& d)
+{
+	StreamedDraw draw;
+	const GLsizeiptr vertexSize = 3 * sizeof(GLfloat);
+	GLintptr vertexOffset, indexOffset;
+	GLfloat* vertices = (GLfloat*)stream.allocate(shapeVertexCount(d) * vertexSize, vertexSize, &vertexOffset);
+	if (!vertices)
+		return draw;
+	writeShapeVertices(d, vertices);
+	GLuint* indices = (GLuint*)stream.allocate(shapeIndexCount(d) * sizeof(GLuint), sizeof(GLuint), &indexOffset);
+	if (!indices)
+		return draw;
+	writeShapeIndices(d, indices);
+	stream.unmap();
+
+	draw.mode = shapePrimitive(d);
+	draw.count = (GLsizei)shapeIndexCount(d);
+	draw.baseVertex = (GLint)(vertexOffset / vertexSize);
+	draw.indexOffset = indexOffset;
+	draw.indexed = true;
+	return draw;
+}
+
+// Tessela a curva (Curves.h) entre t0 e t1 direto no anel, como GL_LINE_STRIP
+template <class Curve>
+StreamedDraw streamCurve(StreamBuffer& stream, const Curve& curve, double t0, double t1, const CurveTessOptions& options)
+{
+	StreamedDraw draw;
+	const GLsizeiptr vertexSize = 3 * sizeof(GLfloat);
+	GLuint count = countCurveVertices(curve, t0, t1, options);
+	GLintptr offset;
+	GLfloat* vertices = (GLfloat*)stream.allocate(count * vertexSize, vertexSize, &offset);
+	if (!vertices)
+		return draw;
+	tessellateCurve(curve, t0, t1, options, [vertices](const GLfloat* chunk, GLuint n, GLuint first)
+	{
+		std::copy(chunk, chunk + n * 3, vertices + (size_t)first * 3);
+	});
+	stream.unmap();
+
+	draw.mode = GL_LINE_STRIP;
+	draw.count = (GLsizei)count;
+	draw.baseVertex = (GLint)(offset / vertexSize);
+	return draw;
+}
+
+// Copia count posições (vec3) prontas para o anel, para desenhar com mode
+inline StreamedDraw streamVertices(StreamBuffer& stream, const GLfloat* positions, GLsizei count, GLenum mode)
+{
+	StreamedDraw draw;
+	const GLsizeiptr vertexSize = 3 * sizeof(GLfloat);
+	GLintptr offset;
+	GLfloat* vertices = (GLfloat*)stream.allocate(count * vertexSize, vertexSize, &offset);
+	if (!vertices)
+		return draw;
+	std::copy(positions, positions + (size_t)count * 3, vertices);
+	stream.unmap();
+
+	draw.mode = mode;
+	draw.count = count;
+	draw.baseVertex = (GLint)(offset / vertexSize);
+	return draw;
+}
+
+// Desenha a geometria do frame (o VAO de createStreamPositionVAO precisa estar vinculado)
+inline void drawStreamed(const StreamedDraw& draw)
+{
+	if (draw.indexed)
+		glDrawElementsBaseVertex(draw.mode, draw.count, GL_UNSIGNED_INT, (GLvoid*)draw.indexOffset, draw.baseVertex);
+	else
+		glDrawArrays(draw.mode, draw.baseVertex, draw.count);
+}
@@ -0,0 +1,299 @@
+// Formatos de vértice compactos para as cenas 2D
+//
+// Os exercícios 8 e 9 guardam cada vértice como 6 floats (x, y, z, r, g, b):
+// 24 bytes, com z sempre 0 e cores que só precisam de 8 bits por canal. Um
+// VertexFormat descreve como a posição e a cor ficam no VBO:
+//   - posição: 3 ou 2 floats, 2 half floats ou 2 snorm16 (inteiros de 16 bits
+//     normalizados para [-1, 1], bons para coordenadas já em NDC)
+//   - cor: 3 floats ou 4 unorm8 (RGBA de 0 a 255, normalizados para [0, 1])
+// Com posição snorm16 ou half e cor unorm8 o vértice tem 8 bytes, 3x menos memória e
+// banda de vértices. Os shaders não mudam: "in vec3 position" recebe z = 0 quando
+// só há 2 componentes, e "in vec3 color" ignora o alfa.
+//
+// packVertices() converte em bloco o layout de 6 floats para o formato;
+// setupVertexAttributes() configura o VAO vinculado com glVertexAttribFormat e
+// glBindVertexBuffer quando o contexto é OpenGL 4.3 ou tem
+// GL_ARB_vertex_attrib_binding, ou, sem eles, com glVertexAttribPointer.
+//
+// A GLAD do projeto é da OpenGL 4.0: as três funções da 4.3 são carregadas aqui
+// com o carregador da AppWindow e não passam pelos ganchos instalados nos
+// ponteiros da GLAD. O cache de estado (GLStateCache.h) e os contadores do
+// Benchmark não as veem; durante a gravação de um trace (GLTrace.h) o
+// carregador não as encontra e o caminho com glVertexAttribPointer é usado.
+//
+// snorm16 usa a regra da OpenGL 4.2+ (c / 32767): -1, 0 e 1 são exatos. Posições
+// fora de [-1, 1] são limitadas e contadas em VertexPackStats::clamped; para elas,
+// use half.
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+
+//GLAD
+#include <glad/glad.h>
+
+// Um atributo no VBO, nos termos de glVertexAttribPointer
+struct VertexAttribute
+{
+	GLint components = 0;
+	GLenum type = GL_FLOAT;
+	GLboolean normalized = GL_FALSE;
+	GLuint offset = 0; // Bytes desde o início do vértice
+};
+
+struct VertexFormat
+{
+	const char* name = "float";
+	VertexAttribute position;
+	VertexAttribute color;
+	GLsizei stride = 0;
+};
+
+struct VertexPackStats
+{
+	size_t vertices = 0;
+	size_t clamped = 0; // Componentes fora do intervalo do tipo (snorm16, unorm8)
+};
+
+// Bytes de um componente do tipo
+inline GLuint vertexTypeSize(GLenum type)
+{
+	return type == GL_UNSIGNED_BYTE ? 1 : type == GL_SHORT || type == GL_HALF_FLOAT ? 2 : 4;
+}
+
+// Monta o formato: posição (components, type) seguida da cor (components, type),
+// cada atributo alinhado em 4 bytes
+inline VertexFormat makeVertexFormat(const char* name, GLint positionComponents, GLenum positionType,
+	GLint colorComponents, GLenum colorType)
+{
+	VertexFormat format;
+	format.name = name;
+	format.position.components = positionComponents;
+	format.position.type = positionType;
+	format.position.normalized = positionType == GL_SHORT ? GL_TRUE : GL_FALSE;
+	format.position.offset = 0;
+	format.color.components = colorComponents;
+	format.color.type = colorType;
+	format.color.normalized = colorType == GL_UNSIGNED_BYTE ? GL_TRUE : GL_FALSE;
+	format.color.offset = (positionComponents * vertexTypeSize(positionType) + 3) / 4 * 4;
+	format.stride = (GLsizei)((format.color.offset + colorComponents * vertexTypeSize(colorType) + 3) / 4 * 4);
+	return format;
+}
+
+// Layout original dos exercícios: 24 bytes
+inline VertexFormat floatVertexFormat() { return makeVertexFormat("float", 3, GL_FLOAT, 3, GL_FLOAT); }
+
+// Só x e y em float, cor RGBA8: 12 bytes
+inline VertexFormat float2VertexFormat() { return makeVertexFormat("float2", 2, GL_FLOAT, 4, GL_UNSIGNED_BYTE); }
+
+// x e y em half float, cor RGBA8: 8 bytes
+inline VertexFormat halfVertexFormat() { return makeVertexFormat("half", 2, GL_HALF_FLOAT, 4, GL_UNSIGNED_BYTE); }
+
+// x e y em snorm16, cor RGBA8: 8 bytes
+inline VertexFormat snorm16VertexFormat() { return makeVertexFormat("snorm16", 2, GL_SHORT, 4, GL_UNSIGNED_BYTE); }
+
+// Formato pelo nome (float, float2, half, snorm16); falso se o nome não existe
+inline bool findVertexFormat(const char* name, VertexFormat* format)
+{
+	const VertexFormat formats[] = { floatVertexFormat(), float2VertexFormat(), halfVertexFormat(), snorm16VertexFormat() };
+	for (const VertexFormat& f : formats)
+	{
+		if (strcmp(f.name, name) == 0)
+		{
+			*format = f;
+			return true;
+		}
+	}
+	std::cout << "ERROR::VERTEX_FORMAT::UNKNOWN_FORMAT " << name << std::endl;
+	return false;
+}
+
+// Conversões de um componente
+
+inline GLshort floatToSnorm16(float value, size_t* clamped)
+{
+	if (!(value >= -1.0f && value <= 1.0f))
+	{
+		++*clamped;
+		value = value > 0.0f ? 1.0f : -1.0f;
+	}
+	return (GLshort)lrintf(value * 32767.0f);
+}
+
+inline GLubyte floatToUnorm8(float value, size_t* clamped)
+{
+	if (!(value >= 0.0f && value <= 1.0f))
+	{
+		++*clamped;
+		value = value > 0.0f ? 1.0f : 0.0f;
+	}
+	return (GLubyte)lrintf(value * 255.0f);
+}
+
+// float para half (IEEE 754 binário de 16 bits), arredondando para o par mais próximo
+inline GLushort floatToHalf(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	uint32_t sign = (bits >> 16) & 0x8000u;
+	uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+	if (magnitude >= 0x7F800000u) // Infinito ou NaN
+		return (GLushort)(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+	if (magnitude >= 0x477FF000u) // Acima do maior half (65504) depois de arredondar
+		return (GLushort)(sign | 0x7C00u);
+	if (magnitude < 0x38800000u) // Subnormal em half (ou zero)
+	{
+		if (magnitude < 0x33000000u)
+			return (GLushort)sign;
+		uint32_t exponent = magnitude >> 23;
+		uint32_t mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+		uint32_t shift = 126 - exponent; // De 14 a 24
+		uint32_t half = mantissa >> shift;
+		uint32_t rest = mantissa & ((1u << shift) - 1);
+		uint32_t middle = 1u << (shift - 1);
+		if (rest > middle || (rest == middle && (half & 1u)))
+			++half;
+		return (GLushort)(sign | half);
+	}
+	// Normal: rebase o expoente (127 -> 15) e arredonda os 13 bits descartados
+	uint32_t half = (magnitude - 0x38000000u) >> 13;
+	uint32_t rest = magnitude & 0x1FFFu;
+	if (rest > 0x1000u || (rest == 0x1000u && (half & 1u)))
+		++half;
+	return (GLushort)(sign | half);
+}
+
+// Conversões em bloco: count elementos de components componentes, com passos
+// (em bytes) independentes na origem e no destino
+
+inline void packFloat(const GLfloat* src, size_t srcStride, size_t count, int components, char* dst, size_t dstStride)
+{
+	for (size_t i = 0; i < count; ++i, src = (const GLfloat*)((const char*)src + srcStride), dst += dstStride)
+		memcpy(dst, src, components * sizeof(GLfloat));
+}
+
+inline void packHalf(const GLfloat* src, size_t srcStride, size_t count, int components, char* dst, size_t dstStride)
+{
+	for (size_t i = 0; i < count; ++i, src = (const GLfloat*)((const char*)src + srcStride), dst += dstStride)
+	{
+		GLushort packed[4];
+		for (int c = 0; c < components; ++c)
+			packed[c] = floatToHalf(src[c]);
+		memcpy(dst, packed, components * sizeof(GLushort));
+	}
+}
+
+inline void packSnorm16(const GLfloat* src, size_t srcStride, size_t count, int components, char* dst, size_t dstStride,
+	size_t* clamped)
+{
+	for (size_t i = 0; i < count; ++i, src = (const GLfloat*)((const char*)src + srcStride), dst += dstStride)
+	{
+		GLshort packed[4];
+		for (int c = 0; c < components; ++c)
+			packed[c] = floatToSnorm16(src[c], clamped);
+		memcpy(dst, packed, components * sizeof(GLshort));
+	}
+}
+
+// A origem tem sourceComponents componentes; os que faltam recebem 1 (alfa opaco)
+inline void packUnorm8(const GLfloat* src, size_t srcStride, size_t count, int sourceComponents, int components,
+	char* dst, size_t dstStride, size_t* clamped)
+{
+	for (size_t i = 0; i < count; ++i, src = (const GLfloat*)((const char*)src + srcStride), dst += dstStride)
+	{
+		for (int c = 0; c < components; ++c)
+			dst[c] = (char)(c < sourceComponents ? floatToUnorm8(src[c], clamped) : 255);
+	}
+}
+
+// Converte count vértices de 6 floats (x, y, z, r, g, b) para o formato, em dst
+// (count * format.stride bytes). Com posição de 2 componentes o z é descartado
+inline VertexPackStats packVertices(const VertexFormat& format, const GLfloat* src, size_t count, void* dst)
+{
+	const size_t srcStride = 6 * sizeof(GLfloat);
+	VertexPackStats stats;
+	stats.vertices = count;
+	char* out = (char*)dst;
+	memset(out, 0, count * format.stride);
+
+	const VertexAttribute& p = format.position;
+	if (p.type == GL_SHORT)
+		packSnorm16(src, srcStride, count, p.components, out + p.offset, format.stride, &stats.clamped);
+	else if (p.type == GL_HALF_FLOAT)
+		packHalf(src, srcStride, count, p.components, out + p.offset, format.stride);
+	else
+		packFloat(src, srcStride, count, p.components, out + p.offset, format.stride);
+
+	const VertexAttribute& c = format.color;
+	if (c.type == GL_UNSIGNED_BYTE)
+		packUnorm8(src + 3, srcStride, count, 3, c.components, out + c.offset, format.stride, &stats.clamped);
+	else
+		packFloat(src + 3, srcStride, count, c.components, out + c.offset, format.stride);
+	return stats;
+}
+
+// Formato de atributo separado do buffer: OpenGL 4.3 ou GL_ARB_vertex_attrib_binding
+// no contexto atual
+inline bool hasVertexAttribBinding()
+{
+	if (GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3))
+		return true;
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; ++i)
+	{
+		if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i), "GL_ARB_vertex_attrib_binding") == 0)
+			return true;
+	}
+	return false;
+}
+
+// Configura posição (positionLocation) e cor (colorLocation) no VAO vinculado,
+// lendo de buffer a partir de baseOffset
+// Com loader e hasVertexAttribBinding(), o formato fica separado do buffer
+// (glVertexAttribFormat, ponto de vínculo 0); senão, usa glVertexAttribPointer
+// com buffer em GL_ARRAY_BUFFER
+inline void setupVertexAttributes(const VertexFormat& format, GLuint buffer, GLintptr baseOffset = 0,
+	GLADloadproc loader = NULL, GLuint positionLocation = 0, GLuint colorLocation = 1)
+{
+	typedef void (APIENTRYP VertexAttribFormatProc)(GLuint, GLint, GLenum, GLboolean, GLuint);
+	typedef void (APIENTRYP VertexAttribBindingProc)(GLuint, GLuint);
+	typedef void (APIENTRYP BindVertexBufferProc)(GLuint, GLuint, GLintptr, GLsizei);
+
+	VertexAttribFormatProc attribFormat = NULL;
+	VertexAttribBindingProc attribBinding = NULL;
+	BindVertexBufferProc bindVertexBuffer = NULL;
+	if (loader && hasVertexAttribBinding())
+	{
+		attribFormat = (VertexAttribFormatProc)loader("glVertexAttribFormat");
+		attribBinding = (VertexAttribBindingProc)loader("glVertexAttribBinding");
+		bindVertexBuffer = (BindVertexBufferProc)loader("glBindVertexBuffer");
+	}
+
+	const VertexAttribute* attributes[2] = { &format.position, &format.color };
+	GLuint locations[2] = { positionLocation, colorLocation };
+	if (attribFormat && attribBinding && bindVertexBuffer)
+	{
+		for (int i = 0; i < 2; ++i)
+		{
+			// Antes das chamadas fora da GLAD: pelo cache de estado, faz o vínculo de VAO pendente
+			glEnableVertexAttribArray(locations[i]);
+			attribFormat(locations[i], attributes[i]->components, attributes[i]->type, attributes[i]->normalized, attributes[i]->offset);
+			attribBinding(locations[i], 0);
+		}
+		bindVertexBuffer(0, buffer, baseOffset, format.stride);
+		return;
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	for (int i = 0; i < 2; ++i)
+	{
+		glVertexAttribPointer(locations[i], attributes[i]->components, attributes[i]->type, attributes[i]->normalized,
+			format.stride, (GLvoid*)(baseOffset + attributes[i]->offset));
+		glEnableVertexAttribArray(locations[i]);
+	}
+}
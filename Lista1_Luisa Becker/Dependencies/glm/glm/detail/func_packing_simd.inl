@@ -1,9 +1,101 @@
 /// @ref core
 /// @file glm/detail/func_packing_simd.inl
 
+#include "../simd/packing.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
 namespace glm{
 namespace detail
 {
+	template <>
+	struct compute_unorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint pack(vec2 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_unorm(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f), _mm_set1_ps(65535.0f));
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_ivec4_to_u16(i)));
+		}
+
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_from_u16(_mm_cvtsi32_si128(static_cast<int>(p)));
+			GLM_ALIGN(16) float Result[4];
+			_mm_store_ps(Result, glm_vec4_unpack_unorm(i, _mm_set1_ps(1.5259021896696421759365224689097e-5f)));
+			return vec2(Result[0], Result[1]);
+		}
+	};
+
+	template <>
+	struct compute_snorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint pack(vec2 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_snorm(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f), _mm_set1_ps(32767.0f));
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_ivec4_to_i16(i)));
+		}
+
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_from_i16(_mm_cvtsi32_si128(static_cast<int>(p)));
+			GLM_ALIGN(16) float Result[4];
+			_mm_store_ps(Result, glm_vec4_unpack_snorm(i, _mm_set1_ps(3.0518509475997192297128208258309e-5f)));
+			return vec2(Result[0], Result[1]);
+		}
+	};
+
+	template <>
+	struct compute_unorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint pack(vec4 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_unorm(_mm_loadu_ps(&v[0]), _mm_set1_ps(255.0f));
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_ivec4_to_u8(i)));
+		}
 
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_from_u8(_mm_cvtsi32_si128(static_cast<int>(p)));
+			vec4 Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_vec4_unpack_unorm(i, _mm_set1_ps(0.0039215686274509803921568627451f)));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_snorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint pack(vec4 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_snorm(_mm_loadu_ps(&v[0]), _mm_set1_ps(127.0f));
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_ivec4_to_i8(i)));
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_from_i8(_mm_cvtsi32_si128(static_cast<int>(p)));
+			vec4 Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_vec4_unpack_snorm(i, _mm_set1_ps(0.0078740157480315f)));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_half2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint pack(vec2 const & v)
+		{
+			return static_cast<uint>(_mm_cvtsi128_si32(glm_vec4_to_half(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f))));
+		}
+
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint p)
+		{
+			GLM_ALIGN(16) float Result[4];
+			_mm_store_ps(Result, glm_vec4_from_half(_mm_cvtsi32_si128(static_cast<int>(p))));
+			return vec2(Result[0], Result[1]);
+		}
+	};
 }//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -5,8 +5,83 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::sin, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::cos, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_sincos
+	{
+		GLM_FUNC_QUALIFIER static void call(vecType<T, P> const & x, vecType<T, P> & s, vecType<T, P> & c)
+		{
+			s = compute_sin<vecType, T, P, Aligned>::call(x);
+			c = compute_cos<vecType, T, P, Aligned>::call(x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_tan
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::tan, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_asin
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::asin, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_acos
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::acos, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_atan
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & x)
+		{
+			return detail::functor1<T, T, P, vecType>::call(std::atan, x);
+		}
+	};
+
+	template <template <class, precision> class vecType, typename T, precision P, bool Aligned>
+	struct compute_atan2
+	{
+		GLM_FUNC_QUALIFIER static vecType<T, P> call(vecType<T, P> const & y, vecType<T, P> const & x)
+		{
+			return detail::functor2<T, P, vecType>::call(::std::atan2, y, x);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template <typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -43,7 +118,8 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> sin(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(sin, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sin' only accept floating-point inputs");
+		return detail::compute_sin<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// cos
@@ -52,7 +128,25 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> cos(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(cos, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cos' only accept floating-point inputs");
+		return detail::compute_cos<vecType, T, P, detail::is_aligned<P>::value>::call(v);
+	}
+
+	// sincos
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void sincos(genType angle, genType & s, genType & c)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<genType>::is_iec559, "'sincos' only accept floating-point input");
+
+		s = std::sin(angle);
+		c = std::cos(angle);
+	}
+
+	template <typename T, precision P, template <typename, precision> class vecType>
+	GLM_FUNC_QUALIFIER void sincos(vecType<T, P> const & angle, vecType<T, P> & s, vecType<T, P> & c)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sincos' only accept floating-point inputs");
+		detail::compute_sincos<vecType, T, P, detail::is_aligned<P>::value>::call(angle, s, c);
 	}
 
 	// tan
@@ -61,7 +155,8 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> tan(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(tan, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'tan' only accept floating-point inputs");
+		return detail::compute_tan<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// asin
@@ -70,7 +165,8 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> asin(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(asin, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'asin' only accept floating-point inputs");
+		return detail::compute_asin<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// acos
@@ -79,7 +175,8 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> acos(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(acos, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'acos' only accept floating-point inputs");
+		return detail::compute_acos<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// atan
@@ -94,7 +191,8 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> atan(vecType<T, P> const & a, vecType<T, P> const & b)
 	{
-		return detail::functor2<T, P, vecType>::call(::std::atan2, a, b);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'atan' only accept floating-point inputs");
+		return detail::compute_atan2<vecType, T, P, detail::is_aligned<P>::value>::call(a, b);
 	}
 
 	using std::atan;
@@ -102,7 +200,8 @@ namespace glm
 	template <typename T, precision P, template <typename, precision> class vecType>
 	GLM_FUNC_QUALIFIER vecType<T, P> atan(vecType<T, P> const & v)
 	{
-		return detail::functor1<T, T, P, vecType>::call(atan, v);
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'atan' only accept floating-point inputs");
+		return detail::compute_atan<vecType, T, P, detail::is_aligned<P>::value>::call(v);
 	}
 
 	// sinh
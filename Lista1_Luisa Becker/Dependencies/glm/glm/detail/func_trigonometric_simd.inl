@@ -0,0 +1,99 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <precision P>
+	struct compute_sin<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_sin(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_cos<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_cos(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_sincos<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tvec4<float, P> const & v, tvec4<float, P> & s, tvec4<float, P> & c)
+		{
+			glm_vec4_sincos(v.data, s.data, c.data);
+		}
+	};
+
+	template <precision P>
+	struct compute_tan<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_tan(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_asin<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_asin(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_acos<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_acos(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_atan<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & v)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_atan(v.data);
+			return result;
+		}
+	};
+
+	template <precision P>
+	struct compute_atan2<tvec4, float, P, true>
+	{
+		GLM_FUNC_QUALIFIER static tvec4<float, P> call(tvec4<float, P> const & y, tvec4<float, P> const & x)
+		{
+			tvec4<float, P> result(uninitialize);
+			result.data = glm_vec4_atan2(y.data, x.data);
+			return result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -3,8 +3,93 @@
 
 #include "func_matrix.hpp"
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template <typename T, precision P, bool Aligned>
+	struct compute_mat4_add
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
+		{
+			return tmat4x4<T, P>(
+				m1[0] + m2[0],
+				m1[1] + m2[1],
+				m1[2] + m2[2],
+				m1[3] + m2[3]);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_mat4_sub
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
+		{
+			return tmat4x4<T, P>(
+				m1[0] - m2[0],
+				m1[1] - m2[1],
+				m1[2] - m2[2],
+				m1[3] - m2[3]);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_mat4_mul_vec4
+	{
+		GLM_FUNC_QUALIFIER static tvec4<T, P> call(tmat4x4<T, P> const & m, tvec4<T, P> const & v)
+		{
+			tvec4<T, P> const Mov0(v[0]);
+			tvec4<T, P> const Mov1(v[1]);
+			tvec4<T, P> const Mul0 = m[0] * Mov0;
+			tvec4<T, P> const Mul1 = m[1] * Mov1;
+			tvec4<T, P> const Add0 = Mul0 + Mul1;
+			tvec4<T, P> const Mov2(v[2]);
+			tvec4<T, P> const Mov3(v[3]);
+			tvec4<T, P> const Mul2 = m[2] * Mov2;
+			tvec4<T, P> const Mul3 = m[3] * Mov3;
+			tvec4<T, P> const Add1 = Mul2 + Mul3;
+			tvec4<T, P> const Add2 = Add0 + Add1;
+			return Add2;
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_vec4_mul_mat4
+	{
+		GLM_FUNC_QUALIFIER static tvec4<T, P> call(tvec4<T, P> const & v, tmat4x4<T, P> const & m)
+		{
+			return tvec4<T, P>(
+				m[0][0] * v[0] + m[0][1] * v[1] + m[0][2] * v[2] + m[0][3] * v[3],
+				m[1][0] * v[0] + m[1][1] * v[1] + m[1][2] * v[2] + m[1][3] * v[3],
+				m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2] + m[2][3] * v[3],
+				m[3][0] * v[0] + m[3][1] * v[1] + m[3][2] * v[2] + m[3][3] * v[3]);
+		}
+	};
+
+	template <typename T, precision P, bool Aligned>
+	struct compute_mat4_mul
+	{
+		GLM_FUNC_QUALIFIER static tmat4x4<T, P> call(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
+		{
+			typename tmat4x4<T, P>::col_type const SrcA0 = m1[0];
+			typename tmat4x4<T, P>::col_type const SrcA1 = m1[1];
+			typename tmat4x4<T, P>::col_type const SrcA2 = m1[2];
+			typename tmat4x4<T, P>::col_type const SrcA3 = m1[3];
+
+			typename tmat4x4<T, P>::col_type const SrcB0 = m2[0];
+			typename tmat4x4<T, P>::col_type const SrcB1 = m2[1];
+			typename tmat4x4<T, P>::col_type const SrcB2 = m2[2];
+			typename tmat4x4<T, P>::col_type const SrcB3 = m2[3];
+
+			tmat4x4<T, P> Result(uninitialize);
+			Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
+			Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
+			Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
+			Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
+			return Result;
+		}
+	};
+}//namespace detail
+
 	// -- Constructors --
 
 #	if !GLM_HAS_DEFAULTED_FUNCTIONS || !defined(GLM_FORCE_NO_CTOR_INIT)
@@ -446,11 +531,7 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> operator+(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
 	{
-		return tmat4x4<T, P>(
-			m1[0] + m2[0],
-			m1[1] + m2[1],
-			m1[2] + m2[2],
-			m1[3] + m2[3]);
+		return detail::compute_mat4_add<T, P, detail::is_aligned<P>::value>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
@@ -476,11 +557,7 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> operator-(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
 	{
-		return tmat4x4<T, P>(
-			m1[0] - m2[0],
-			m1[1] - m2[1],
-			m1[2] - m2[2],
-			m1[3] - m2[3]);
+		return detail::compute_mat4_sub<T, P, detail::is_aligned<P>::value>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
@@ -510,45 +587,7 @@ namespace glm
 		typename tmat4x4<T, P>::row_type const & v
 	)
 	{
-/*
-		__m128 v0 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 v1 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 v2 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 v3 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(m[0].data, v0);
-		__m128 m1 = _mm_mul_ps(m[1].data, v1);
-		__m128 a0 = _mm_add_ps(m0, m1);
-
-		__m128 m2 = _mm_mul_ps(m[2].data, v2);
-		__m128 m3 = _mm_mul_ps(m[3].data, v3);
-		__m128 a1 = _mm_add_ps(m2, m3);
-
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		return typename tmat4x4<T, P>::col_type(a2);
-*/
-
-		typename tmat4x4<T, P>::col_type const Mov0(v[0]);
-		typename tmat4x4<T, P>::col_type const Mov1(v[1]);
-		typename tmat4x4<T, P>::col_type const Mul0 = m[0] * Mov0;
-		typename tmat4x4<T, P>::col_type const Mul1 = m[1] * Mov1;
-		typename tmat4x4<T, P>::col_type const Add0 = Mul0 + Mul1;
-		typename tmat4x4<T, P>::col_type const Mov2(v[2]);
-		typename tmat4x4<T, P>::col_type const Mov3(v[3]);
-		typename tmat4x4<T, P>::col_type const Mul2 = m[2] * Mov2;
-		typename tmat4x4<T, P>::col_type const Mul3 = m[3] * Mov3;
-		typename tmat4x4<T, P>::col_type const Add1 = Mul2 + Mul3;
-		typename tmat4x4<T, P>::col_type const Add2 = Add0 + Add1;
-		return Add2;
-
-/*
-		return typename tmat4x4<T, P>::col_type(
-			m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2] + m[3][0] * v[3],
-			m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2] + m[3][1] * v[3],
-			m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2] + m[3][2] * v[3],
-			m[0][3] * v[0] + m[1][3] * v[1] + m[2][3] * v[2] + m[3][3] * v[3]);
-*/
+		return detail::compute_mat4_mul_vec4<T, P, detail::is_aligned<P>::value>::call(m, v);
 	}
 
 	template <typename T, precision P>
@@ -558,11 +597,7 @@ namespace glm
 		tmat4x4<T, P> const & m
 	)
 	{
-		return typename tmat4x4<T, P>::row_type(
-			m[0][0] * v[0] + m[0][1] * v[1] + m[0][2] * v[2] + m[0][3] * v[3],
-			m[1][0] * v[0] + m[1][1] * v[1] + m[1][2] * v[2] + m[1][3] * v[3],
-			m[2][0] * v[0] + m[2][1] * v[1] + m[2][2] * v[2] + m[2][3] * v[3],
-			m[3][0] * v[0] + m[3][1] * v[1] + m[3][2] * v[2] + m[3][3] * v[3]);
+		return detail::compute_vec4_mul_mat4<T, P, detail::is_aligned<P>::value>::call(v, m);
 	}
 
 	template <typename T, precision P>
@@ -600,22 +635,7 @@ namespace glm
 	template <typename T, precision P>
 	GLM_FUNC_QUALIFIER tmat4x4<T, P> operator*(tmat4x4<T, P> const & m1, tmat4x4<T, P> const & m2)
 	{
-		typename tmat4x4<T, P>::col_type const SrcA0 = m1[0];
-		typename tmat4x4<T, P>::col_type const SrcA1 = m1[1];
-		typename tmat4x4<T, P>::col_type const SrcA2 = m1[2];
-		typename tmat4x4<T, P>::col_type const SrcA3 = m1[3];
-
-		typename tmat4x4<T, P>::col_type const SrcB0 = m2[0];
-		typename tmat4x4<T, P>::col_type const SrcB1 = m2[1];
-		typename tmat4x4<T, P>::col_type const SrcB2 = m2[2];
-		typename tmat4x4<T, P>::col_type const SrcB3 = m2[3];
-
-		tmat4x4<T, P> Result(uninitialize);
-		Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
-		Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
-		Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
-		Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
-		return Result;
+		return detail::compute_mat4_mul<T, P, detail::is_aligned<P>::value>::call(m1, m2);
 	}
 
 	template <typename T, precision P>
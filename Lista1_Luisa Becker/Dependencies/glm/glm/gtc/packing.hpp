@@ -573,6 +573,110 @@ namespace glm
 	/// @see gtc_packing
 	/// @see uint8 packUnorm2x3_1x2(vec3 const & v)
 	GLM_FUNC_DECL vec3 unpackUnorm2x3_1x2(uint8 p);
+
+	/// Converts count normalized floating-point values of v into 8-bit unsigned integer values written to p.
+	/// Each value is converted like packUnorm1x8, four values at a time with SIMD instructions when available.
+	///
+	/// @see gtc_packing
+	/// @see uint8 packUnorm1x8(float v)
+	/// @see void unpackUnorm1x8(uint8 const * p, float * v, std::size_t count)
+	GLM_FUNC_DECL void packUnorm1x8(float const * v, uint8 * p, std::size_t count);
+
+	/// Converts count 8-bit unsigned integer values of p into normalized floating-point values written to v.
+	///
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x8(uint8 p)
+	/// @see void packUnorm1x8(float const * v, uint8 * p, std::size_t count)
+	GLM_FUNC_DECL void unpackUnorm1x8(uint8 const * p, float * v, std::size_t count);
+
+	/// Converts count normalized floating-point values of v into 8-bit signed integer values written to p.
+	/// Each value is converted like packSnorm1x8, four values at a time with SIMD instructions when available.
+	///
+	/// @see gtc_packing
+	/// @see uint8 packSnorm1x8(float v)
+	/// @see void unpackSnorm1x8(uint8 const * p, float * v, std::size_t count)
+	GLM_FUNC_DECL void packSnorm1x8(float const * v, uint8 * p, std::size_t count);
+
+	/// Converts count 8-bit signed integer values of p into normalized floating-point values written to v.
+	///
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x8(uint8 p)
+	/// @see void packSnorm1x8(float const * v, uint8 * p, std::size_t count)
+	GLM_FUNC_DECL void unpackSnorm1x8(uint8 const * p, float * v, std::size_t count);
+
+	/// Converts count normalized floating-point values of v into 16-bit unsigned integer values written to p.
+	/// Each value is converted like packUnorm1x16, four values at a time with SIMD instructions when available.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packUnorm1x16(float v)
+	/// @see void unpackUnorm1x16(uint16 const * p, float * v, std::size_t count)
+	GLM_FUNC_DECL void packUnorm1x16(float const * v, uint16 * p, std::size_t count);
+
+	/// Converts count 16-bit unsigned integer values of p into normalized floating-point values written to v.
+	///
+	/// @see gtc_packing
+	/// @see float unpackUnorm1x16(uint16 p)
+	/// @see void packUnorm1x16(float const * v, uint16 * p, std::size_t count)
+	GLM_FUNC_DECL void unpackUnorm1x16(uint16 const * p, float * v, std::size_t count);
+
+	/// Converts count normalized floating-point values of v into 16-bit signed integer values written to p.
+	/// Each value is converted like packSnorm1x16, four values at a time with SIMD instructions when available.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packSnorm1x16(float v)
+	/// @see void unpackSnorm1x16(uint16 const * p, float * v, std::size_t count)
+	GLM_FUNC_DECL void packSnorm1x16(float const * v, uint16 * p, std::size_t count);
+
+	/// Converts count 16-bit signed integer values of p into normalized floating-point values written to v.
+	///
+	/// @see gtc_packing
+	/// @see float unpackSnorm1x16(uint16 p)
+	/// @see void packSnorm1x16(float const * v, uint16 * p, std::size_t count)
+	GLM_FUNC_DECL void unpackSnorm1x16(uint16 const * p, float * v, std::size_t count);
+
+	/// Converts count floating-point values of v into 16-bit floating-point values written to p.
+	/// With SIMD instructions, ties are rounded to even like the F16C instructions,
+	/// so a value exactly halfway between two halfs may differ from packHalf1x16 by one unit.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float v)
+	/// @see void unpackHalf1x16(uint16 const * p, float * v, std::size_t count)
+	GLM_FUNC_DECL void packHalf1x16(float const * v, uint16 * p, std::size_t count);
+
+	/// Converts count 16-bit floating-point values of p into 32-bit floating-point values written to v.
+	///
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 v)
+	/// @see void packHalf1x16(float const * v, uint16 * p, std::size_t count)
+	GLM_FUNC_DECL void unpackHalf1x16(uint16 const * p, float * v, std::size_t count);
+
+	/// Packs the count vectors of v like packSnorm3x10_1x2 into p.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packSnorm3x10_1x2(vec4 const & v)
+	/// @see void unpackSnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t count)
+	GLM_FUNC_DECL void packSnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t count);
+
+	/// Unpacks the count values of p like unpackSnorm3x10_1x2 into v.
+	///
+	/// @see gtc_packing
+	/// @see vec4 unpackSnorm3x10_1x2(uint32 p)
+	/// @see void packSnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t count)
+	GLM_FUNC_DECL void unpackSnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t count);
+
+	/// Packs the count vectors of v like packUnorm3x10_1x2 into p.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packUnorm3x10_1x2(vec4 const & v)
+	/// @see void unpackUnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t count)
+	GLM_FUNC_DECL void packUnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t count);
+
+	/// Unpacks the count values of p like unpackUnorm3x10_1x2 into v.
+	///
+	/// @see gtc_packing
+	/// @see vec4 unpackUnorm3x10_1x2(uint32 p)
+	/// @see void packUnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t count)
+	GLM_FUNC_DECL void unpackUnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t count);
 	/// @}
 }// namespace glm
 
@@ -2,6 +2,7 @@
 /// @file glm/gtc/packing.inl
 
 #include "../common.hpp"
+#include "../packing.hpp"
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
@@ -349,8 +350,182 @@ namespace detail
 			return tvec4<float, P>(detail::toFloat32(v.x), detail::toFloat32(v.y), detail::toFloat32(v.z), detail::toFloat32(v.w));
 		}
 	};
+
+	template <bool Simd>
+	struct compute_unorm4x16
+	{
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const & v)
+		{
+			u16vec4 const Topack(round(clamp(v , 0.0f, 1.0f) * 65535.0f));
+			uint64 Packed = 0;
+			memcpy(&Packed, &Topack, sizeof(Packed));
+			return Packed;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 p)
+		{
+			uint16 Unpack[4];
+			memcpy(Unpack, &p, sizeof(Unpack));
+			return vec4(Unpack[0], Unpack[1], Unpack[2], Unpack[3]) * 1.5259021896696421759365224689097e-5f; // 1.0 / 65535.0
+		}
+	};
+
+	template <bool Simd>
+	struct compute_snorm4x16
+	{
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const & v)
+		{
+			i16vec4 const Topack(round(clamp(v ,-1.0f, 1.0f) * 32767.0f));
+			uint64 Packed = 0;
+			memcpy(&Packed, &Topack, sizeof(Packed));
+			return Packed;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 p)
+		{
+			int16 Unpack[4];
+			memcpy(Unpack, &p, sizeof(Unpack));
+			return clamp(
+				vec4(Unpack[0], Unpack[1], Unpack[2], Unpack[3]) * 3.0518509475997192297128208258309e-5f, //1.0f / 32767.0f,
+				-1.0f, 1.0f);
+		}
+	};
+
+	template <bool Simd>
+	struct compute_half4x16
+	{
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const & v)
+		{
+			i16vec4 const Unpack(
+				detail::toFloat16(v.x),
+				detail::toFloat16(v.y),
+				detail::toFloat16(v.z),
+				detail::toFloat16(v.w));
+			uint64 Packed = 0;
+			memcpy(&Packed, &Unpack, sizeof(Packed));
+			return Packed;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 v)
+		{
+			int16 Unpack[4];
+			memcpy(Unpack, &v, sizeof(Unpack));
+			return vec4(
+				detail::toFloat32(Unpack[0]),
+				detail::toFloat32(Unpack[1]),
+				detail::toFloat32(Unpack[2]),
+				detail::toFloat32(Unpack[3]));
+		}
+	};
+
+	template <bool Simd>
+	struct compute_snorm3x10_1x2
+	{
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const & v)
+		{
+			detail::i10i10i10i2 Result;
+			Result.data.x = int(round(clamp(v.x,-1.0f, 1.0f) * 511.f));
+			Result.data.y = int(round(clamp(v.y,-1.0f, 1.0f) * 511.f));
+			Result.data.z = int(round(clamp(v.z,-1.0f, 1.0f) * 511.f));
+			Result.data.w = int(round(clamp(v.w,-1.0f, 1.0f) *   1.f));
+			return Result.pack;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 v)
+		{
+			detail::i10i10i10i2 Unpack;
+			Unpack.pack = v;
+			vec4 Result;
+			Result.x = clamp(float(Unpack.data.x) / 511.f, -1.0f, 1.0f);
+			Result.y = clamp(float(Unpack.data.y) / 511.f, -1.0f, 1.0f);
+			Result.z = clamp(float(Unpack.data.z) / 511.f, -1.0f, 1.0f);
+			Result.w = clamp(float(Unpack.data.w) /   1.f, -1.0f, 1.0f);
+			return Result;
+		}
+	};
+
+	template <bool Simd>
+	struct compute_unorm3x10_1x2
+	{
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const & v)
+		{
+			uvec4 const Unpack(round(clamp(v, 0.0f, 1.0f) * vec4(1023.f, 1023.f, 1023.f, 3.f)));
+
+			detail::u10u10u10u2 Result;
+			Result.data.x = Unpack.x;
+			Result.data.y = Unpack.y;
+			Result.data.z = Unpack.z;
+			Result.data.w = Unpack.w;
+			return Result.pack;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 v)
+		{
+			vec4 const ScaleFactors(1.0f / 1023.f, 1.0f / 1023.f, 1.0f / 1023.f, 1.0f / 3.f);
+
+			detail::u10u10u10u2 Unpack;
+			Unpack.pack = v;
+			return vec4(Unpack.data.x, Unpack.data.y, Unpack.data.z, Unpack.data.w) * ScaleFactors;
+		}
+	};
+
+	// Converts the values of a stream four at a time, the remaining values are padded with zeros
+	template <typename packType, typename blockType, blockType (*Pack)(vec4 const &)>
+	GLM_FUNC_QUALIFIER void pack_stream(float const * v, packType * p, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(sizeof(blockType) == sizeof(packType) * 4, "Invalid block type");
+
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			blockType const Block = Pack(vec4(v[i + 0], v[i + 1], v[i + 2], v[i + 3]));
+			memcpy(p + i, &Block, sizeof(Block));
+		}
+
+		if(i < count)
+		{
+			float Tail[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+			memcpy(Tail, v + i, sizeof(float) * (count - i));
+			blockType const Block = Pack(vec4(Tail[0], Tail[1], Tail[2], Tail[3]));
+			memcpy(p + i, &Block, sizeof(packType) * (count - i));
+		}
+	}
+
+	template <typename packType, typename blockType, vec4 (*Unpack)(blockType)>
+	GLM_FUNC_QUALIFIER void unpack_stream(packType const * p, float * v, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(sizeof(blockType) == sizeof(packType) * 4, "Invalid block type");
+
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			blockType Block = 0;
+			memcpy(&Block, p + i, sizeof(Block));
+			vec4 const Result(Unpack(Block));
+			v[i + 0] = Result.x;
+			v[i + 1] = Result.y;
+			v[i + 2] = Result.z;
+			v[i + 3] = Result.w;
+		}
+
+		if(i < count)
+		{
+			blockType Block = 0;
+			memcpy(&Block, p + i, sizeof(packType) * (count - i));
+			vec4 const Result(Unpack(Block));
+			for(std::size_t j = 0; i + j < count; ++j)
+				v[i + j] = Result[static_cast<length_t>(j)];
+		}
+	}
 }//namespace detail
+}//namespace glm
 
+#if GLM_ARCH != GLM_ARCH_PURE && GLM_HAS_UNRESTRICTED_UNIONS
+#	include "packing_simd.inl"
+#endif
+
+namespace glm
+{
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
 	{
 		return static_cast<uint8>(round(clamp(v, 0.0f, 1.0f) * 255.0f));
@@ -425,17 +600,12 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packUnorm4x16(vec4 const & v)
 	{
-		u16vec4 const Topack(round(clamp(v , 0.0f, 1.0f) * 65535.0f));
-		uint64 Packed = 0;
-		memcpy(&Packed, &Topack, sizeof(Packed));
-		return Packed;
+		return detail::compute_unorm4x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm4x16(uint64 p)
 	{
-		u16vec4 Unpack(uninitialize);
-		memcpy(&Unpack, &p, sizeof(Unpack));
-		return vec4(Unpack) * 1.5259021896696421759365224689097e-5f; // 1.0 / 65535.0
+		return detail::compute_unorm4x16<GLM_ARCH != GLM_ARCH_PURE>::unpack(p);
 	}
 
 	GLM_FUNC_QUALIFIER uint16 packSnorm1x16(float v)
@@ -457,19 +627,12 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packSnorm4x16(vec4 const & v)
 	{
-		i16vec4 const Topack(round(clamp(v ,-1.0f, 1.0f) * 32767.0f));
-		uint64 Packed = 0;
-		memcpy(&Packed, &Topack, sizeof(Packed));
-		return Packed;
+		return detail::compute_snorm4x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackSnorm4x16(uint64 p)
 	{
-		i16vec4 Unpack(uninitialize);
-		memcpy(&Unpack, &p, sizeof(Unpack));
-		return clamp(
-			vec4(Unpack) * 3.0518509475997192297128208258309e-5f, //1.0f / 32767.0f,
-			-1.0f, 1.0f);
+		return detail::compute_snorm4x16<GLM_ARCH != GLM_ARCH_PURE>::unpack(p);
 	}
 
 	GLM_FUNC_QUALIFIER uint16 packHalf1x16(float v)
@@ -489,25 +652,12 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const & v)
 	{
-		i16vec4 const Unpack(
-			detail::toFloat16(v.x),
-			detail::toFloat16(v.y),
-			detail::toFloat16(v.z),
-			detail::toFloat16(v.w));
-		uint64 Packed = 0;
-		memcpy(&Packed, &Unpack, sizeof(Packed));
-		return Packed;
+		return detail::compute_half4x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
 	}
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackHalf4x16(uint64 v)
 	{
-		i16vec4 Unpack(uninitialize);
-		memcpy(&Unpack, &v, sizeof(Unpack));
-		return vec4(
-			detail::toFloat32(Unpack.x),
-			detail::toFloat32(Unpack.y),
-			detail::toFloat32(Unpack.z),
-			detail::toFloat32(Unpack.w));
+		return detail::compute_half4x16<GLM_ARCH != GLM_ARCH_PURE>::unpack(v);
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const & v)
@@ -554,45 +704,22 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint32 packSnorm3x10_1x2(vec4 const & v)
 	{
-		detail::i10i10i10i2 Result;
-		Result.data.x = int(round(clamp(v.x,-1.0f, 1.0f) * 511.f));
-		Result.data.y = int(round(clamp(v.y,-1.0f, 1.0f) * 511.f));
-		Result.data.z = int(round(clamp(v.z,-1.0f, 1.0f) * 511.f));
-		Result.data.w = int(round(clamp(v.w,-1.0f, 1.0f) *   1.f));
-		return Result.pack;
+		return detail::compute_snorm3x10_1x2<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackSnorm3x10_1x2(uint32 v)
 	{
-		detail::i10i10i10i2 Unpack;
-		Unpack.pack = v;
-		vec4 Result;
-		Result.x = clamp(float(Unpack.data.x) / 511.f, -1.0f, 1.0f);
-		Result.y = clamp(float(Unpack.data.y) / 511.f, -1.0f, 1.0f);
-		Result.z = clamp(float(Unpack.data.z) / 511.f, -1.0f, 1.0f);
-		Result.w = clamp(float(Unpack.data.w) /   1.f, -1.0f, 1.0f);
-		return Result;
+		return detail::compute_snorm3x10_1x2<GLM_ARCH != GLM_ARCH_PURE>::unpack(v);
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packUnorm3x10_1x2(vec4 const & v)
 	{
-		uvec4 const Unpack(round(clamp(v, 0.0f, 1.0f) * vec4(1023.f, 1023.f, 1023.f, 3.f)));
-
-		detail::u10u10u10u2 Result;
-		Result.data.x = Unpack.x;
-		Result.data.y = Unpack.y;
-		Result.data.z = Unpack.z;
-		Result.data.w = Unpack.w;
-		return Result.pack;
+		return detail::compute_unorm3x10_1x2<GLM_ARCH != GLM_ARCH_PURE>::pack(v);
 	}
 
 	GLM_FUNC_QUALIFIER vec4 unpackUnorm3x10_1x2(uint32 v)
 	{
-		vec4 const ScaleFactors(1.0f / 1023.f, 1.0f / 1023.f, 1.0f / 1023.f, 1.0f / 3.f);
-
-		detail::u10u10u10u2 Unpack;
-		Unpack.pack = v;
-		return vec4(Unpack.data.x, Unpack.data.y, Unpack.data.z, Unpack.data.w) * ScaleFactors;
+		return detail::compute_unorm3x10_1x2<GLM_ARCH != GLM_ARCH_PURE>::unpack(v);
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packF2x11_1x10(vec3 const & v)
@@ -777,5 +904,79 @@ namespace detail
 		Unpack.pack = v;
 		return vec3(Unpack.data.x, Unpack.data.y, Unpack.data.z) * ScaleFactor;
 	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x8(float const * v, uint8 * p, std::size_t count)
+	{
+		detail::pack_stream<uint8, uint, packUnorm4x8>(v, p, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x8(uint8 const * p, float * v, std::size_t count)
+	{
+		detail::unpack_stream<uint8, uint, unpackUnorm4x8>(p, v, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x8(float const * v, uint8 * p, std::size_t count)
+	{
+		detail::pack_stream<uint8, uint, packSnorm4x8>(v, p, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x8(uint8 const * p, float * v, std::size_t count)
+	{
+		detail::unpack_stream<uint8, uint, unpackSnorm4x8>(p, v, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x16(float const * v, uint16 * p, std::size_t count)
+	{
+		detail::pack_stream<uint16, uint64, packUnorm4x16>(v, p, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x16(uint16 const * p, float * v, std::size_t count)
+	{
+		detail::unpack_stream<uint16, uint64, unpackUnorm4x16>(p, v, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm1x16(float const * v, uint16 * p, std::size_t count)
+	{
+		detail::pack_stream<uint16, uint64, packSnorm4x16>(v, p, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm1x16(uint16 const * p, float * v, std::size_t count)
+	{
+		detail::unpack_stream<uint16, uint64, unpackSnorm4x16>(p, v, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf1x16(float const * v, uint16 * p, std::size_t count)
+	{
+		detail::pack_stream<uint16, uint64, packHalf4x16>(v, p, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf1x16(uint16 const * p, float * v, std::size_t count)
+	{
+		detail::unpack_stream<uint16, uint64, unpackHalf4x16>(p, v, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			p[i] = packSnorm3x10_1x2(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			v[i] = unpackSnorm3x10_1x2(p[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec4 const * v, uint32 * p, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			p[i] = packUnorm3x10_1x2(v[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const * p, vec4 * v, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			v[i] = unpackUnorm3x10_1x2(p[i]);
+	}
 }//namespace glm
 
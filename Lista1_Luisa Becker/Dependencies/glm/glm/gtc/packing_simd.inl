@@ -0,0 +1,108 @@
+/// @ref gtc_packing
+/// @file glm/gtc/packing_simd.inl
+
+#include "../simd/packing.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template <>
+	struct compute_unorm4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_unorm(_mm_loadu_ps(&v[0]), _mm_set1_ps(65535.0f));
+			uint64 Packed = 0;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed), glm_ivec4_to_u16(i));
+			return Packed;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 p)
+		{
+			glm_ivec4 const i = glm_ivec4_from_u16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&p)));
+			vec4 Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_vec4_unpack_unorm(i, _mm_set1_ps(1.5259021896696421759365224689097e-5f)));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_snorm4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_snorm(_mm_loadu_ps(&v[0]), _mm_set1_ps(32767.0f));
+			uint64 Packed = 0;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed), glm_ivec4_to_i16(i));
+			return Packed;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 p)
+		{
+			glm_ivec4 const i = glm_ivec4_from_i16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&p)));
+			vec4 Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_vec4_unpack_snorm(i, _mm_set1_ps(3.0518509475997192297128208258309e-5f)));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_half4x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const & v)
+		{
+			uint64 Packed = 0;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Packed), glm_vec4_to_half(_mm_loadu_ps(&v[0])));
+			return Packed;
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 v)
+		{
+			vec4 Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_vec4_from_half(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&v))));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_snorm3x10_1x2<true>
+	{
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_snorm(_mm_loadu_ps(&v[0]), _mm_setr_ps(511.0f, 511.0f, 511.0f, 1.0f));
+			return glm_ivec4_pack_3x10_1x2(i);
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 v)
+		{
+			// Divide rather than multiply by the reciprocal to match the scalar rounding
+			glm_vec4 const f = _mm_div_ps(_mm_cvtepi32_ps(glm_ivec4_unpack_i3x10_1x2(v)), _mm_setr_ps(511.0f, 511.0f, 511.0f, 1.0f));
+			vec4 Result(uninitialize);
+			_mm_storeu_ps(&Result[0], _mm_min_ps(_mm_max_ps(f, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f)));
+			return Result;
+		}
+	};
+
+	template <>
+	struct compute_unorm3x10_1x2<true>
+	{
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const & v)
+		{
+			glm_ivec4 const i = glm_vec4_pack_unorm(_mm_loadu_ps(&v[0]), _mm_setr_ps(1023.0f, 1023.0f, 1023.0f, 3.0f));
+			return glm_ivec4_pack_3x10_1x2(i);
+		}
+
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 v)
+		{
+			glm_vec4 const Scale = _mm_setr_ps(1.0f / 1023.f, 1.0f / 1023.f, 1.0f / 1023.f, 1.0f / 3.f);
+			vec4 Result(uninitialize);
+			_mm_storeu_ps(&Result[0], glm_vec4_unpack_unorm(glm_ivec4_unpack_u3x10_1x2(v), Scale));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,84 @@
+/// @ref gtx_transform_array
+/// @file glm/gtx/transform_array.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_transform_array GLM_GTX_transform_array
+/// @ingroup gtx
+///
+/// @brief Transforms arrays of vectors by a matrix.
+///
+/// The float versions process blocks of 4, 8 or 16 vectors at once with SSE2, AVX or AVX-512 instructions,
+/// loading the vectors in structure of arrays form. When OpenMP is enabled, large arrays are split into
+/// chunks transformed by several threads.
+///
+/// The input and output arrays may be the same array, other overlaps are not supported.
+///
+/// <glm/gtx/transform_array.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../mat3x3.hpp"
+#include "../mat4x4.hpp"
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_transform_array extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_array
+	/// @{
+
+	/// Computes out[i] = m * v[i] for count vectors.
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transform(tmat4x4<T, P> const & m, tvec4<T, P> const * v, tvec4<T, P> * out, std::size_t count);
+
+	/// Computes out[i] = m * v[i] for count vectors.
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transform(tmat3x3<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count);
+
+	/// Transforms count positions with an implicit w of 1: out[i] = vec3(m * vec4(v[i], 1)).
+	/// There is no perspective division.
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPositions(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count);
+
+	/// Transforms count positions with an implicit w of 1 to homogeneous coordinates: out[i] = m * vec4(v[i], 1).
+	/// Useful to get clip space positions for culling.
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPositions(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec4<T, P> * out, std::size_t count);
+
+	/// Transforms count 2d positions with an implicit z of 1: out[i] = vec2(m * vec3(v[i], 1)).
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformPositions(tmat3x3<T, P> const & m, tvec2<T, P> const * v, tvec2<T, P> * out, std::size_t count);
+
+	/// Transforms count directions with an implicit w of 0: out[i] = mat3(m) * v[i].
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformDirections(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count);
+
+	/// Transforms count normals by the inverse transpose of the upper 3 * 3 matrix of m.
+	/// The results are not normalized.
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformNormals(tmat4x4<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count);
+
+	/// Transforms count normals by the inverse transpose of m.
+	/// The results are not normalized.
+	/// From GLM_GTX_transform_array extension.
+	template <typename T, precision P>
+	GLM_FUNC_DECL void transformNormals(tmat3x3<T, P> const & m, tvec3<T, P> const * v, tvec3<T, P> * out, std::size_t count);
+
+	/// @}
+}// namespace glm
+
+#include "transform_array.inl"
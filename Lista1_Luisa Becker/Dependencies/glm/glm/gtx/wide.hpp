@@ -0,0 +1,606 @@
+/// @ref gtx_wide
+/// @file glm/gtx/wide.hpp
+///
+/// @see core (dependence)
+/// @see gtx_transform_array (dependence)
+///
+/// @defgroup gtx_wide GLM_GTX_wide
+/// @ingroup gtx
+///
+/// @brief Structure of arrays vector types processing several vectors at once.
+///
+/// twide<T, L> holds L lanes of T and twvec2, twvec3 and twvec4 store each component in a separate twide,
+/// so that vec3x8 is 8 vec3 with their x, y and z in three registers. Every operation applies lane by lane,
+/// a dot product is two multiply and adds for the L vectors with no horizontal reduction.
+///
+/// twide<float, 4>, twide<float, 8> and twide<float, 16> use SSE2, AVX and AVX-512 registers, the widths
+/// above the instruction set being made of several registers. Other types use arrays of L values.
+///
+/// Comparisons return twmask lane masks, combined with all(), any() and selected with mix().
+/// load() and store() convert between twvecN and arrays of L tvecN.
+///
+/// <glm/gtx/wide.hpp> need to be included to use these functionalities.
+
+#pragma once
+
+// Dependency:
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "transform_array.hpp"
+
+#if GLM_MESSAGES == GLM_MESSAGES_ENABLED && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_wide extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	template <typename T, length_t L>
+	struct wide_array
+	{
+		T data[L];
+	};
+
+	template <typename T, length_t L>
+	struct compute_wide;
+}//namespace detail
+
+	/// @addtogroup gtx_wide
+	/// @{
+
+	template <typename T, length_t L> struct twmask;
+
+	/// L lanes of T.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	struct twide
+	{
+		typedef T value_type;
+		typedef twide<T, L> type;
+		typedef twmask<T, L> mask_type;
+		typedef typename detail::compute_wide<T, L>::type storage_type;
+
+		storage_type data;
+
+		/// Return the count of lanes
+		typedef length_t length_type;
+		GLM_FUNC_DECL static length_type length(){return L;}
+
+		GLM_FUNC_DECL T operator[](length_type i) const;
+
+		GLM_FUNC_DECL twide();
+		GLM_FUNC_DECL explicit twide(ctor);
+		GLM_FUNC_DECL twide(T const & scalar);
+		GLM_FUNC_DECL explicit twide(storage_type const & d);
+
+		GLM_FUNC_DECL twide<T, L> & operator+=(twide<T, L> const & v);
+		GLM_FUNC_DECL twide<T, L> & operator-=(twide<T, L> const & v);
+		GLM_FUNC_DECL twide<T, L> & operator*=(twide<T, L> const & v);
+		GLM_FUNC_DECL twide<T, L> & operator/=(twide<T, L> const & v);
+	};
+
+	/// Lane mask resulting of the comparison of two twide<T, L>.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	struct twmask
+	{
+		typedef bool value_type;
+		typedef twmask<T, L> type;
+		typedef typename detail::compute_wide<T, L>::mask_type storage_type;
+
+		storage_type data;
+
+		typedef length_t length_type;
+		GLM_FUNC_DECL static length_type length(){return L;}
+
+		GLM_FUNC_DECL bool operator[](length_type i) const;
+
+		GLM_FUNC_DECL twmask();
+		GLM_FUNC_DECL explicit twmask(ctor);
+		GLM_FUNC_DECL explicit twmask(bool b);
+		GLM_FUNC_DECL explicit twmask(storage_type const & d);
+	};
+
+	/// Two components vectors of wide components W, a twide or a twmask.
+	/// From GLM_GTX_wide extension.
+	template <typename W>
+	struct twvec2
+	{
+		typedef W component_type;
+		typedef typename W::value_type value_type;
+		typedef twvec2<W> type;
+
+		W x, y;
+
+		typedef length_t length_type;
+		GLM_FUNC_DECL static length_type length(){return 2;}
+
+		GLM_FUNC_DECL W & operator[](length_type i);
+		GLM_FUNC_DECL W const & operator[](length_type i) const;
+
+		GLM_FUNC_DECL twvec2();
+		GLM_FUNC_DECL explicit twvec2(ctor);
+		GLM_FUNC_DECL explicit twvec2(W const & scalar);
+		GLM_FUNC_DECL twvec2(W const & x, W const & y);
+
+		/// Copies v in every lane
+		template <precision P>
+		GLM_FUNC_DECL explicit twvec2(tvec2<value_type, P> const & v);
+
+		GLM_FUNC_DECL twvec2<W> & operator+=(twvec2<W> const & v);
+		GLM_FUNC_DECL twvec2<W> & operator-=(twvec2<W> const & v);
+		GLM_FUNC_DECL twvec2<W> & operator*=(twvec2<W> const & v);
+		GLM_FUNC_DECL twvec2<W> & operator/=(twvec2<W> const & v);
+		GLM_FUNC_DECL twvec2<W> & operator*=(W const & s);
+		GLM_FUNC_DECL twvec2<W> & operator/=(W const & s);
+	};
+
+	/// Three components vectors of wide components W, a twide or a twmask.
+	/// From GLM_GTX_wide extension.
+	template <typename W>
+	struct twvec3
+	{
+		typedef W component_type;
+		typedef typename W::value_type value_type;
+		typedef twvec3<W> type;
+
+		W x, y, z;
+
+		typedef length_t length_type;
+		GLM_FUNC_DECL static length_type length(){return 3;}
+
+		GLM_FUNC_DECL W & operator[](length_type i);
+		GLM_FUNC_DECL W const & operator[](length_type i) const;
+
+		GLM_FUNC_DECL twvec3();
+		GLM_FUNC_DECL explicit twvec3(ctor);
+		GLM_FUNC_DECL explicit twvec3(W const & scalar);
+		GLM_FUNC_DECL twvec3(W const & x, W const & y, W const & z);
+
+		/// Copies v in every lane
+		template <precision P>
+		GLM_FUNC_DECL explicit twvec3(tvec3<value_type, P> const & v);
+
+		GLM_FUNC_DECL twvec3<W> & operator+=(twvec3<W> const & v);
+		GLM_FUNC_DECL twvec3<W> & operator-=(twvec3<W> const & v);
+		GLM_FUNC_DECL twvec3<W> & operator*=(twvec3<W> const & v);
+		GLM_FUNC_DECL twvec3<W> & operator/=(twvec3<W> const & v);
+		GLM_FUNC_DECL twvec3<W> & operator*=(W const & s);
+		GLM_FUNC_DECL twvec3<W> & operator/=(W const & s);
+	};
+
+	/// Four components vectors of wide components W, a twide or a twmask.
+	/// From GLM_GTX_wide extension.
+	template <typename W>
+	struct twvec4
+	{
+		typedef W component_type;
+		typedef typename W::value_type value_type;
+		typedef twvec4<W> type;
+
+		W x, y, z, w;
+
+		typedef length_t length_type;
+		GLM_FUNC_DECL static length_type length(){return 4;}
+
+		GLM_FUNC_DECL W & operator[](length_type i);
+		GLM_FUNC_DECL W const & operator[](length_type i) const;
+
+		GLM_FUNC_DECL twvec4();
+		GLM_FUNC_DECL explicit twvec4(ctor);
+		GLM_FUNC_DECL explicit twvec4(W const & scalar);
+		GLM_FUNC_DECL twvec4(W const & x, W const & y, W const & z, W const & w);
+
+		/// Copies v in every lane
+		template <precision P>
+		GLM_FUNC_DECL explicit twvec4(tvec4<value_type, P> const & v);
+
+		GLM_FUNC_DECL twvec4<W> & operator+=(twvec4<W> const & v);
+		GLM_FUNC_DECL twvec4<W> & operator-=(twvec4<W> const & v);
+		GLM_FUNC_DECL twvec4<W> & operator*=(twvec4<W> const & v);
+		GLM_FUNC_DECL twvec4<W> & operator/=(twvec4<W> const & v);
+		GLM_FUNC_DECL twvec4<W> & operator*=(W const & s);
+		GLM_FUNC_DECL twvec4<W> & operator/=(W const & s);
+	};
+
+	/// @}
+
+namespace detail
+{
+	// The template template parameter of the twvecN functions would also match tvecN and its default precision
+	template <typename vecType, typename R>
+	struct wide_vec_enable
+	{};
+
+	template <typename W, typename R>
+	struct wide_vec_enable<twvec2<W>, R>
+	{
+		typedef R type;
+	};
+
+	template <typename W, typename R>
+	struct wide_vec_enable<twvec3<W>, R>
+	{
+		typedef R type;
+	};
+
+	template <typename W, typename R>
+	struct wide_vec_enable<twvec4<W>, R>
+	{
+		typedef R type;
+	};
+}//namespace detail
+
+	/// @addtogroup gtx_wide
+	/// @{
+
+	typedef twide<float, 4> floatx4;
+	typedef twide<float, 8> floatx8;
+	typedef twide<float, 16> floatx16;
+
+	typedef twmask<float, 4> boolx4;
+	typedef twmask<float, 8> boolx8;
+	typedef twmask<float, 16> boolx16;
+
+	typedef twvec2<floatx4> vec2x4;
+	typedef twvec3<floatx4> vec3x4;
+	typedef twvec4<floatx4> vec4x4;
+	typedef twvec2<floatx8> vec2x8;
+	typedef twvec3<floatx8> vec3x8;
+	typedef twvec4<floatx8> vec4x8;
+	typedef twvec2<floatx16> vec2x16;
+	typedef twvec3<floatx16> vec3x16;
+	typedef twvec4<floatx16> vec4x16;
+
+	typedef twvec2<boolx4> bvec2x4;
+	typedef twvec3<boolx4> bvec3x4;
+	typedef twvec4<boolx4> bvec4x4;
+	typedef twvec2<boolx8> bvec2x8;
+	typedef twvec3<boolx8> bvec3x8;
+	typedef twvec4<boolx8> bvec4x8;
+	typedef twvec2<boolx16> bvec2x16;
+	typedef twvec3<boolx16> bvec3x16;
+	typedef twvec4<boolx16> bvec4x16;
+
+	// -- twide operators and functions --
+
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator-(twide<T, L> const & v);
+
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator+(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator+(twide<T, L> const & a, typename twide<T, L>::value_type const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator+(typename twide<T, L>::value_type const & a, twide<T, L> const & b);
+
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator-(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator-(twide<T, L> const & a, typename twide<T, L>::value_type const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator-(typename twide<T, L>::value_type const & a, twide<T, L> const & b);
+
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator*(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator*(twide<T, L> const & a, typename twide<T, L>::value_type const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator*(typename twide<T, L>::value_type const & a, twide<T, L> const & b);
+
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator/(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator/(twide<T, L> const & a, typename twide<T, L>::value_type const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> operator/(typename twide<T, L>::value_type const & a, twide<T, L> const & b);
+
+	/// Lane by lane comparisons.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> lessThan(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> lessThanEqual(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> greaterThan(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> greaterThanEqual(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> equal(twide<T, L> const & a, twide<T, L> const & b);
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> notEqual(twide<T, L> const & a, twide<T, L> const & b);
+
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> abs(twide<T, L> const & x);
+
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> min(twide<T, L> const & x, twide<T, L> const & y);
+
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> min(twide<T, L> const & x, T y);
+
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> max(twide<T, L> const & x, twide<T, L> const & y);
+
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> max(twide<T, L> const & x, T y);
+
+	/// Returns min(max(x, minVal), maxVal) for each lane.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> clamp(twide<T, L> const & x, twide<T, L> const & minVal, twide<T, L> const & maxVal);
+
+	/// Returns min(max(x, minVal), maxVal) for each lane.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> clamp(twide<T, L> const & x, T minVal, T maxVal);
+
+	/// Returns x + a * (y - x) for each lane.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> mix(twide<T, L> const & x, twide<T, L> const & y, twide<T, L> const & a);
+
+	/// Returns x + a * (y - x) for each lane.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> mix(twide<T, L> const & x, twide<T, L> const & y, T a);
+
+	/// Returns y in the lanes where a is true, x otherwise.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> mix(twide<T, L> const & x, twide<T, L> const & y, twmask<T, L> const & a);
+
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> sqrt(twide<T, L> const & x);
+
+	/// Returns 1 / sqrt(x), no approximation is used.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twide<T, L> inversesqrt(twide<T, L> const & x);
+
+	/// Loads L values from p.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL void load(twide<T, L> & v, T const * p);
+
+	/// Stores the L lanes of v to p.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL void store(twide<T, L> const & v, T * p);
+
+	// -- twmask operators and functions --
+
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> operator&&(twmask<T, L> const & a, twmask<T, L> const & b);
+
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> operator||(twmask<T, L> const & a, twmask<T, L> const & b);
+
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL twmask<T, L> not_(twmask<T, L> const & m);
+
+	/// Returns true if any lane of m is true.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL bool any(twmask<T, L> const & m);
+
+	/// Returns true if all the lanes of m are true.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L>
+	GLM_FUNC_DECL bool all(twmask<T, L> const & m);
+
+	// -- twvec2 operators and functions --
+
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator-(twvec2<W> const & v);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator+(twvec2<W> const & a, twvec2<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator+(twvec2<W> const & a, typename twvec2<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator+(typename twvec2<W>::component_type const & a, twvec2<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator-(twvec2<W> const & a, twvec2<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator-(twvec2<W> const & a, typename twvec2<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator-(typename twvec2<W>::component_type const & a, twvec2<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator*(twvec2<W> const & a, twvec2<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator*(twvec2<W> const & a, typename twvec2<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator*(typename twvec2<W>::component_type const & a, twvec2<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator/(twvec2<W> const & a, twvec2<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator/(twvec2<W> const & a, typename twvec2<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec2<W> operator/(typename twvec2<W>::component_type const & a, twvec2<W> const & b);
+
+	// -- twvec3 operators and functions --
+
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator-(twvec3<W> const & v);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator+(twvec3<W> const & a, twvec3<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator+(twvec3<W> const & a, typename twvec3<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator+(typename twvec3<W>::component_type const & a, twvec3<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator-(twvec3<W> const & a, twvec3<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator-(twvec3<W> const & a, typename twvec3<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator-(typename twvec3<W>::component_type const & a, twvec3<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator*(twvec3<W> const & a, twvec3<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator*(twvec3<W> const & a, typename twvec3<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator*(typename twvec3<W>::component_type const & a, twvec3<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator/(twvec3<W> const & a, twvec3<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator/(twvec3<W> const & a, typename twvec3<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> operator/(typename twvec3<W>::component_type const & a, twvec3<W> const & b);
+
+	// -- twvec4 operators and functions --
+
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator-(twvec4<W> const & v);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator+(twvec4<W> const & a, twvec4<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator+(twvec4<W> const & a, typename twvec4<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator+(typename twvec4<W>::component_type const & a, twvec4<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator-(twvec4<W> const & a, twvec4<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator-(twvec4<W> const & a, typename twvec4<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator-(typename twvec4<W>::component_type const & a, twvec4<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator*(twvec4<W> const & a, twvec4<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator*(twvec4<W> const & a, typename twvec4<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator*(typename twvec4<W>::component_type const & a, twvec4<W> const & b);
+
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator/(twvec4<W> const & a, twvec4<W> const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator/(twvec4<W> const & a, typename twvec4<W>::component_type const & b);
+	template <typename W>
+	GLM_FUNC_DECL twvec4<W> operator/(typename twvec4<W>::component_type const & a, twvec4<W> const & b);
+
+	// -- Functions of twvec2, twvec3 and twvec4 --
+
+	/// Returns the dot products of x and y in each lane.
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, W>::type dot(vecType<W> const & x, vecType<W> const & y);
+
+	/// Returns the cross products of x and y in each lane.
+	/// From GLM_GTX_wide extension.
+	template <typename W>
+	GLM_FUNC_DECL twvec3<W> cross(twvec3<W> const & x, twvec3<W> const & y);
+
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, W>::type length(vecType<W> const & x);
+
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, W>::type distance(vecType<W> const & p0, vecType<W> const & p1);
+
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type normalize(vecType<W> const & x);
+
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type abs(vecType<W> const & x);
+
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type min(vecType<W> const & x, vecType<W> const & y);
+
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type max(vecType<W> const & x, vecType<W> const & y);
+
+	/// Returns min(max(x, minVal), maxVal) for each component.
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type clamp(vecType<W> const & x, typename vecType<W>::component_type const & minVal, typename vecType<W>::component_type const & maxVal);
+
+	/// Returns min(max(x, minVal), maxVal) for each component.
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type clamp(vecType<W> const & x, vecType<W> const & minVal, vecType<W> const & maxVal);
+
+	/// Returns x + a * (y - x), a being the same for the components of a lane.
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type mix(vecType<W> const & x, vecType<W> const & y, W const & a);
+
+	/// Returns x + a * (y - x) for each component.
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type mix(vecType<W> const & x, vecType<W> const & y, typename W::value_type a);
+
+	/// Returns y in the lanes where a is true, x otherwise.
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<W> >::type mix(vecType<W> const & x, vecType<W> const & y, typename W::mask_type const & a);
+
+	/// Component wise comparisons returning a lane mask per component.
+	/// From GLM_GTX_wide extension.
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type lessThan(vecType<W> const & x, vecType<W> const & y);
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type lessThanEqual(vecType<W> const & x, vecType<W> const & y);
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type greaterThan(vecType<W> const & x, vecType<W> const & y);
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type greaterThanEqual(vecType<W> const & x, vecType<W> const & y);
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type equal(vecType<W> const & x, vecType<W> const & y);
+	template <typename W, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<W>, vecType<typename W::mask_type> >::type notEqual(vecType<W> const & x, vecType<W> const & y);
+
+	/// Returns the lanes where any component of v is true.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<twmask<T, L> >, twmask<T, L> >::type any(vecType<twmask<T, L> > const & v);
+
+	/// Returns the lanes where all the components of v are true.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L, template <typename> class vecType>
+	GLM_FUNC_DECL typename detail::wide_vec_enable<vecType<twmask<T, L> >, twmask<T, L> >::type all(vecType<twmask<T, L> > const & v);
+
+	/// Loads L vectors from an array of structures, p[i] going to lane i.
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_DECL void load(twvec2<twide<T, L> > & v, tvec2<T, P> const * p);
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_DECL void load(twvec3<twide<T, L> > & v, tvec3<T, P> const * p);
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_DECL void load(twvec4<twide<T, L> > & v, tvec4<T, P> const * p);
+
+	/// Stores the L lanes of v to an array of structures, lane i going to p[i].
+	/// From GLM_GTX_wide extension.
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_DECL void store(twvec2<twide<T, L> > const & v, tvec2<T, P> * p);
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_DECL void store(twvec3<twide<T, L> > const & v, tvec3<T, P> * p);
+	template <typename T, length_t L, precision P>
+	GLM_FUNC_DECL void store(twvec4<twide<T, L> > const & v, tvec4<T, P> * p);
+
+	/// @}
+}// namespace glm
+
+#include "wide.inl"
@@ -3,6 +3,209 @@
 
 #pragma once
 
+#include "platform.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// Rounds half away from zero like std::round, for |x| < 2^31
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_round_epi32(glm_vec4 x)
+{
+	glm_ivec4 const t = _mm_cvttps_epi32(x);
+	glm_vec4 const f = _mm_sub_ps(x, _mm_cvtepi32_ps(t));
+	glm_ivec4 const up = _mm_castps_si128(_mm_cmpge_ps(f, _mm_set1_ps(0.5f)));
+	glm_ivec4 const down = _mm_castps_si128(_mm_cmple_ps(f, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(t, up), down);
+}
+
+// round(clamp(v, 0, 1) * scale)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_pack_unorm(glm_vec4 v, glm_vec4 scale)
+{
+	glm_vec4 const c = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+	return glm_vec4_round_epi32(_mm_mul_ps(c, scale));
+}
+
+// round(clamp(v, -1, 1) * scale)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_pack_snorm(glm_vec4 v, glm_vec4 scale)
+{
+	glm_vec4 const c = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+	return glm_vec4_round_epi32(_mm_mul_ps(c, scale));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_unorm(glm_ivec4 i, glm_vec4 scale)
+{
+	return _mm_mul_ps(_mm_cvtepi32_ps(i), scale);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_unpack_snorm(glm_ivec4 i, glm_vec4 scale)
+{
+	glm_vec4 const v = _mm_mul_ps(_mm_cvtepi32_ps(i), scale);
+	return _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+}
+
+// 32 bits lanes to the 8 or 16 bits lanes of the low 32 or 64 bits and back
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_to_u8(glm_ivec4 i)
+{
+	glm_ivec4 const w = _mm_packs_epi32(i, i);
+	return _mm_packus_epi16(w, w);
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_to_i8(glm_ivec4 i)
+{
+	glm_ivec4 const w = _mm_packs_epi32(i, i);
+	return _mm_packs_epi16(w, w);
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_to_u16(glm_ivec4 i)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_packus_epi32(i, i);
+#	else
+		// Signed saturation on the range shifted by 32768
+		glm_ivec4 const s = _mm_sub_epi32(i, _mm_set1_epi32(32768));
+		return _mm_xor_si128(_mm_packs_epi32(s, s), _mm_set1_epi16(static_cast<short>(0x8000)));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_to_i16(glm_ivec4 i)
+{
+	return _mm_packs_epi32(i, i);
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_from_u8(glm_ivec4 p)
+{
+	glm_ivec4 const Zero = _mm_setzero_si128();
+	return _mm_unpacklo_epi16(_mm_unpacklo_epi8(p, Zero), Zero);
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_from_i8(glm_ivec4 p)
+{
+	glm_ivec4 const Zero = _mm_setzero_si128();
+	return _mm_srai_epi32(_mm_unpacklo_epi16(Zero, _mm_unpacklo_epi8(Zero, p)), 24);
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_from_u16(glm_ivec4 p)
+{
+	return _mm_unpacklo_epi16(p, _mm_setzero_si128());
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_from_i16(glm_ivec4 p)
+{
+	return _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), p), 16);
+}
+
+// Four floats to halves in the low 64 bits, rounding to nearest even like F16C.
+// NaNs become the quiet NaN 0x7e00 without F16C.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_half(glm_vec4 v)
+{
+#	if GLM_HAS_F16C
+		return _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#	else
+		glm_ivec4 const f = _mm_castps_si128(v);
+		glm_ivec4 const Sign = _mm_and_si128(f, _mm_set1_epi32(static_cast<int>(0x80000000)));
+		glm_ivec4 const u = _mm_xor_si128(f, Sign);
+
+		// Too large for a half: infinity or NaN
+		glm_ivec4 const Infty = _mm_set1_epi32(255 << 23);
+		glm_ivec4 const InRange = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), u);
+		glm_ivec4 const Big = _mm_or_si128(
+			_mm_set1_epi32(0x7c00),
+			_mm_and_si128(_mm_cmpgt_epi32(u, Infty), _mm_set1_epi32(0x0200)));
+
+		// Below the smallest normal half: the float adder rounds the denormal for us
+		glm_ivec4 const DenormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		glm_ivec4 const Denorm = _mm_sub_epi32(
+			_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_castsi128_ps(DenormMagic))), DenormMagic);
+
+		// Normal: rebias the exponent and round the mantissa to nearest even
+		glm_ivec4 const MantOdd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+		glm_ivec4 Normal = _mm_add_epi32(u, _mm_set1_epi32(-((127 - 15) << 23) + 0xfff));
+		Normal = _mm_srli_epi32(_mm_add_epi32(Normal, MantOdd), 13);
+
+		glm_ivec4 const IsNormal = _mm_cmpgt_epi32(u, _mm_set1_epi32((113 << 23) - 1));
+		glm_ivec4 h = _mm_or_si128(_mm_and_si128(IsNormal, Normal), _mm_andnot_si128(IsNormal, Denorm));
+		h = _mm_or_si128(_mm_and_si128(InRange, h), _mm_andnot_si128(InRange, Big));
+		h = _mm_or_si128(h, _mm_srli_epi32(Sign, 16));
+
+		// Sign extend so that the saturating pack keeps the 16 bits
+		h = _mm_srai_epi32(_mm_slli_epi32(h, 16), 16);
+		return _mm_packs_epi32(h, h);
+#	endif
+}
+
+// The four halves of the low 64 bits to floats, exact for every half
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_from_half(glm_ivec4 p)
+{
+#	if GLM_HAS_F16C
+		return _mm_cvtph_ps(p);
+#	else
+		glm_ivec4 const h = glm_ivec4_from_u16(p);
+		glm_ivec4 const ShiftedExp = _mm_set1_epi32(0x7c00 << 13);
+
+		glm_ivec4 o = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+		glm_ivec4 const Exp = _mm_and_si128(o, ShiftedExp);
+		o = _mm_add_epi32(o, _mm_set1_epi32((127 - 15) << 23));
+
+		// Infinity and NaN: one more exponent adjustment
+		glm_ivec4 const InfNan = _mm_cmpeq_epi32(Exp, ShiftedExp);
+		o = _mm_add_epi32(o, _mm_and_si128(InfNan, _mm_set1_epi32((128 - 16) << 23)));
+
+		// Zero and denormals: renormalize through the float subtraction
+		glm_ivec4 const Magic = _mm_set1_epi32(113 << 23);
+		glm_ivec4 const Denorm = _mm_castps_si128(_mm_sub_ps(
+			_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(1 << 23))), _mm_castsi128_ps(Magic)));
+		glm_ivec4 const IsDenorm = _mm_cmpeq_epi32(Exp, _mm_setzero_si128());
+		o = _mm_or_si128(_mm_and_si128(IsDenorm, Denorm), _mm_andnot_si128(IsDenorm, o));
+
+		o = _mm_or_si128(o, _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16));
+		return _mm_castsi128_ps(o);
+#	endif
+}
+
+// Packs the low bits of each lane at the bit offsets 0, 10, 20 and 30
+GLM_FUNC_QUALIFIER glm::uint32 glm_ivec4_pack_3x10_1x2(glm_ivec4 i)
+{
+	glm_ivec4 const Fields = _mm_and_si128(i, _mm_set_epi32(0x3, 0x3ff, 0x3ff, 0x3ff));
+
+	// Lanes 0 and 2 times 1 and 2^20, lanes 1 and 3 times 2^10 and 2^30, in 64 bits products
+	glm_ivec4 const Even = _mm_mul_epu32(Fields, _mm_set_epi32(0, 1 << 20, 0, 1));
+	glm_ivec4 const Odd = _mm_mul_epu32(_mm_srli_epi64(Fields, 32), _mm_set_epi32(0, 1 << 30, 0, 1 << 10));
+	glm_ivec4 const Halves = _mm_or_si128(Even, Odd);
+	return static_cast<glm::uint32>(_mm_cvtsi128_si32(_mm_or_si128(Halves, _mm_srli_si128(Halves, 8))));
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_unpack_u3x10_1x2(glm::uint32 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm_and_si128(
+			_mm_srlv_epi32(_mm_set1_epi32(static_cast<int>(v)), _mm_set_epi32(30, 20, 10, 0)),
+			_mm_set_epi32(0x3, 0x3ff, 0x3ff, 0x3ff));
+#	else
+		return _mm_set_epi32(
+			static_cast<int>(v >> 30),
+			static_cast<int>((v >> 20) & 0x3ff),
+			static_cast<int>((v >> 10) & 0x3ff),
+			static_cast<int>(v & 0x3ff));
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_unpack_i3x10_1x2(glm::uint32 v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm_srav_epi32(
+			_mm_sllv_epi32(_mm_set1_epi32(static_cast<int>(v)), _mm_set_epi32(0, 2, 12, 22)),
+			_mm_set_epi32(30, 22, 22, 22));
+#	else
+		// Each field moved to the top bits and shifted back arithmetically
+		glm_ivec4 const Top = _mm_set_epi32(
+			static_cast<int>(v),
+			static_cast<int>(v << 2),
+			static_cast<int>(v << 12),
+			static_cast<int>(v << 22));
+		glm_ivec4 const Fields = _mm_srai_epi32(Top, 22);
+		glm_ivec4 const W = _mm_srai_epi32(Top, 30);
+		glm_ivec4 const WMask = _mm_set_epi32(-1, 0, 0, 0);
+		return _mm_or_si128(_mm_andnot_si128(WMask, Fields), _mm_and_si128(WMask, W));
+#	endif
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
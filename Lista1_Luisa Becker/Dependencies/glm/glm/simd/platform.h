@@ -405,7 +405,14 @@
 #	include <intrin.h>
 #endif
 
-#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_COMPILER & GLM_COMPILER_GCC)
+	// GCC 12.2 and older report the self initialized _mm512_undefined_ps of their unmasked AVX-512 intrinsics as uninitialized once inlined
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wuninitialized"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#	include <immintrin.h>
+#	pragma GCC diagnostic pop
+#elif GLM_ARCH & GLM_ARCH_AVX2_BIT
 #	include <immintrin.h>
 #elif GLM_ARCH & GLM_ARCH_AVX_BIT
 #	include <immintrin.h>
@@ -421,6 +428,20 @@
 #	include <emmintrin.h>
 #endif//GLM_ARCH
 
+// FMA3 ships with every AVX2 CPU, but GCC and Clang only emit it with -mfma (or -march=haswell and later)
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__FMA__) || (GLM_COMPILER & (GLM_COMPILER_VC | GLM_COMPILER_INTEL)))
+#	define GLM_HAS_FMA 1
+#else
+#	define GLM_HAS_FMA 0
+#endif
+
+// F16C arrived after the first AVX CPUs, GCC and Clang only emit it with -mf16c (or -march=ivybridge and later)
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || ((GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_COMPILER & (GLM_COMPILER_VC | GLM_COMPILER_INTEL))))
+#	define GLM_HAS_F16C 1
+#else
+#	define GLM_HAS_F16C 0
+#endif
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 	typedef __m128		glm_vec4;
 	typedef __m128i		glm_ivec4;
@@ -140,6 +140,65 @@ int test_packDouble2x32()
 	return Error;
 }
 
+static float half_distance(glm::uint a, glm::uint b, float x)
+{
+	float const A = glm::unpackHalf2x16(a).x;
+	float const B = glm::unpackHalf2x16(b).x;
+	return glm::abs(glm::abs(x - A) - glm::abs(x - B));
+}
+
+// The SIMD paths must match the scalar code they replace
+int test_packSimd()
+{
+	int Error = 0;
+
+	for(int i = -70000; i <= 70000; ++i)
+	{
+		float const x = static_cast<float>(i) / 65535.f;
+		glm::vec2 const v2(x, -x * 0.5f);
+		glm::vec4 const v4(x, -x, x * 0.25f, 1.0f - x);
+
+		Error += glm::detail::compute_unorm2x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v2) == glm::detail::compute_unorm2x16<false>::pack(v2) ? 0 : 1;
+		Error += glm::detail::compute_snorm2x16<GLM_ARCH != GLM_ARCH_PURE>::pack(v2) == glm::detail::compute_snorm2x16<false>::pack(v2) ? 0 : 1;
+		Error += glm::detail::compute_unorm4x8<GLM_ARCH != GLM_ARCH_PURE>::pack(v4) == glm::detail::compute_unorm4x8<false>::pack(v4) ? 0 : 1;
+		Error += glm::detail::compute_snorm4x8<GLM_ARCH != GLM_ARCH_PURE>::pack(v4) == glm::detail::compute_snorm4x8<false>::pack(v4) ? 0 : 1;
+	}
+
+	for(glm::uint i = 0; i < 0x10000; ++i)
+	{
+		glm::uint const p = i | (((i * 2654435761u) >> 16) << 16);
+
+		Error += glm::unpackUnorm2x16(p) == glm::detail::compute_unorm2x16<false>::unpack(p) ? 0 : 1;
+		Error += glm::unpackSnorm2x16(p) == glm::detail::compute_snorm2x16<false>::unpack(p) ? 0 : 1;
+		Error += glm::unpackUnorm4x8(p) == glm::detail::compute_unorm4x8<false>::unpack(p) ? 0 : 1;
+		Error += glm::unpackSnorm4x8(p) == glm::detail::compute_snorm4x8<false>::unpack(p) ? 0 : 1;
+
+		// Every finite half converts exactly
+		glm::vec2 const Half = glm::unpackHalf2x16(i);
+		glm::vec2 const HalfRef = glm::detail::compute_half2x16<false>::unpack(i);
+		if((i & 0x7c00) != 0x7c00)
+			Error += Half.x == HalfRef.x ? 0 : 1;
+		else
+			Error += glm::isnan(Half.x) == glm::isnan(HalfRef.x) && (glm::isnan(Half.x) || Half.x == HalfRef.x) ? 0 : 1;
+	}
+
+	// Halves are rounded to nearest even, so they only differ from the scalar code at exact ties
+	for(int i = -100000; i <= 100000; ++i)
+	{
+		float const x = static_cast<float>(i) * 0.7071f;
+		glm::vec2 const v(x, 1.0f / x);
+		glm::uint const a = glm::packHalf2x16(v);
+		glm::uint const b = glm::detail::compute_half2x16<false>::pack(v);
+		if(a != b)
+		{
+			Error += half_distance(a & 0xffff, b & 0xffff, v.x) == 0.0f ? 0 : 1;
+			Error += half_distance(a >> 16, b >> 16, v.y) == 0.0f ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -150,6 +209,7 @@ int main()
 	Error += test_packUnorm2x16();
 	Error += test_packHalf2x16();
 	Error += test_packDouble2x32();
+	Error += test_packSimd();
 
 	return Error;
 }
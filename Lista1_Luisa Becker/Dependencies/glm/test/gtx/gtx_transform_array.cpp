@@ -0,0 +1,167 @@
+#include <glm/gtx/transform_array.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <vector>
+
+static float const Epsilon = 0.0001f;
+
+static glm::mat4 make_matrix()
+{
+	glm::mat4 const Projection = glm::perspective(0.8f, 1.5f, 0.1f, 100.0f);
+	glm::mat4 const View = glm::translate(glm::mat4(1.0f), glm::vec3(0.5f, -1.0f, -5.0f));
+	glm::mat4 const Model = glm::scale(glm::rotate(glm::mat4(1.0f), 0.7f, glm::normalize(glm::vec3(1, 2, 3))), glm::vec3(2.0f, 0.5f, 1.5f));
+	return Projection * View * Model;
+}
+
+static float make_value(std::size_t i)
+{
+	return static_cast<float>(static_cast<int>((i * 2654435761u) % 2001u) - 1000) / 100.0f;
+}
+
+template <typename vecType>
+static typename vecType::value_type compMaxOf(vecType const & v)
+{
+	typename vecType::value_type Result = v[0];
+	for(typename vecType::length_type i = 1; i < v.length(); ++i)
+		Result = glm::max(Result, v[i]);
+	return Result;
+}
+
+// Sizes around the 4, 8 and 16 vectors blocks and a large one split in chunks with OpenMP
+static std::size_t const Sizes[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 40000};
+
+static int test_transform_vec4()
+{
+	int Error = 0;
+
+	glm::mat4 const m = make_matrix();
+	for(std::size_t s = 0; s < sizeof(Sizes) / sizeof(Sizes[0]); ++s)
+	{
+		std::size_t const Count = Sizes[s];
+		std::vector<glm::vec4> In(Count + 1);
+		for(std::size_t i = 0; i < In.size(); ++i)
+			In[i] = glm::vec4(make_value(i * 4), make_value(i * 4 + 1), make_value(i * 4 + 2), make_value(i * 4 + 3));
+		std::vector<glm::vec4> Out(Count + 1, glm::vec4(7.0f));
+
+		glm::transform(m, &In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::epsilonEqual(Out[i], m * In[i], Epsilon * (1.0f + compMaxOf(glm::abs(m * In[i]))))) ? 0 : 1;
+		Error += Out[Count] == glm::vec4(7.0f) ? 0 : 1;
+
+		// In place
+		std::vector<glm::vec4> Inplace(In);
+		glm::transform(m, &Inplace[0], &Inplace[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Inplace[i] == Out[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_transform_vec3()
+{
+	int Error = 0;
+
+	glm::mat4 const m = make_matrix();
+	glm::mat3 const m3(m);
+	glm::mat3 const n3(glm::inverseTranspose(m3));
+	for(std::size_t s = 0; s < sizeof(Sizes) / sizeof(Sizes[0]); ++s)
+	{
+		std::size_t const Count = Sizes[s];
+		std::vector<glm::vec3> In(Count + 1);
+		for(std::size_t i = 0; i < In.size(); ++i)
+			In[i] = glm::vec3(make_value(i * 3), make_value(i * 3 + 1), make_value(i * 3 + 2));
+
+		std::vector<glm::vec3> Positions(Count + 1, glm::vec3(7.0f));
+		std::vector<glm::vec4> Clip(Count + 1, glm::vec4(7.0f));
+		std::vector<glm::vec3> Directions(Count + 1, glm::vec3(7.0f));
+		std::vector<glm::vec3> Normals(Count + 1, glm::vec3(7.0f));
+		std::vector<glm::vec3> Normals3(Count + 1, glm::vec3(7.0f));
+
+		glm::transformPositions(m, &In[0], &Positions[0], Count);
+		glm::transformPositions(m, &In[0], &Clip[0], Count);
+		glm::transformDirections(m, &In[0], &Directions[0], Count);
+		glm::transformNormals(m, &In[0], &Normals[0], Count);
+		glm::transformNormals(m3, &In[0], &Normals3[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec4 const Position = m * glm::vec4(In[i], 1.0f);
+			glm::vec3 const Direction = m3 * In[i];
+			glm::vec3 const Normal = n3 * In[i];
+			Error += glm::all(glm::epsilonEqual(Positions[i], glm::vec3(Position), Epsilon * (1.0f + compMaxOf(glm::abs(Position))))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Clip[i], Position, Epsilon * (1.0f + compMaxOf(glm::abs(Position))))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Directions[i], Direction, Epsilon * (1.0f + compMaxOf(glm::abs(Direction))))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Normals[i], Normal, Epsilon * (1.0f + compMaxOf(glm::abs(Normal))))) ? 0 : 1;
+			Error += Normals3[i] == Normals[i] ? 0 : 1;
+		}
+		Error += Positions[Count] == glm::vec3(7.0f) && Clip[Count] == glm::vec4(7.0f) ? 0 : 1;
+		Error += Directions[Count] == glm::vec3(7.0f) && Normals[Count] == glm::vec3(7.0f) ? 0 : 1;
+
+		// In place
+		std::vector<glm::vec3> Inplace(In);
+		glm::transformPositions(m, &Inplace[0], &Inplace[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += Inplace[i] == Positions[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_transform_vec2()
+{
+	int Error = 0;
+
+	glm::mat3 const m(
+		1.5f, 0.5f, 0.0f,
+		-0.25f, 2.0f, 0.0f,
+		3.0f, -4.0f, 1.0f);
+	for(std::size_t s = 0; s < sizeof(Sizes) / sizeof(Sizes[0]); ++s)
+	{
+		std::size_t const Count = Sizes[s];
+		std::vector<glm::vec2> In(Count + 1);
+		for(std::size_t i = 0; i < In.size(); ++i)
+			In[i] = glm::vec2(make_value(i * 2), make_value(i * 2 + 1));
+		std::vector<glm::vec2> Out(Count + 1, glm::vec2(7.0f));
+
+		glm::transformPositions(m, &In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec3 const Position = m * glm::vec3(In[i], 1.0f);
+			Error += glm::all(glm::epsilonEqual(Out[i], glm::vec2(Position), Epsilon * (1.0f + compMaxOf(glm::abs(Position))))) ? 0 : 1;
+		}
+		Error += Out[Count] == glm::vec2(7.0f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_transform_double()
+{
+	int Error = 0;
+
+	glm::dmat4 const m(make_matrix());
+	std::vector<glm::dvec3> In(10);
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = glm::dvec3(make_value(i * 3), make_value(i * 3 + 1), make_value(i * 3 + 2));
+	std::vector<glm::dvec4> Out(In.size());
+
+	glm::transformPositions(m, &In[0], &Out[0], In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Error += Out[i] == m * glm::dvec4(In[i], 1.0) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_transform_vec4();
+	Error += test_transform_vec3();
+	Error += test_transform_vec2();
+	Error += test_transform_double();
+
+	return Error;
+}
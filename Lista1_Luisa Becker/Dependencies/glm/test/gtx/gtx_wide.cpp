@@ -0,0 +1,248 @@
+#include <glm/gtx/wide.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/geometric.hpp>
+#include <glm/vector_relational.hpp>
+#include <vector>
+
+static float make_value(std::size_t i)
+{
+	return static_cast<float>(static_cast<int>((i * 2654435761u) % 2001u) - 1000) / 100.0f;
+}
+
+template <typename T>
+static bool close(T a, T b)
+{
+	return glm::abs(a - b) <= static_cast<T>(0.0001) * (static_cast<T>(1) + glm::abs(b));
+}
+
+template <typename T, glm::length_t L>
+static int test_wide()
+{
+	typedef glm::twide<T, L> wide;
+	typedef glm::twmask<T, L> mask;
+
+	int Error = 0;
+
+	std::vector<T> a(L), b(L), c(L);
+	for(glm::length_t i = 0; i < L; ++i)
+	{
+		a[i] = static_cast<T>(make_value(i));
+		b[i] = static_cast<T>(make_value(i + 100));
+		c[i] = static_cast<T>(0.25) * static_cast<T>(i % 5);
+	}
+
+	wide A, B, C;
+	glm::load(A, &a[0]);
+	glm::load(B, &b[0]);
+	glm::load(C, &c[0]);
+
+	// Lanes by lanes against the scalar functions
+	wide const Add = A + B;
+	wide const Sub = A - 2;
+	wide const Mul = 3 * A * B;
+	wide const Div = A / (glm::abs(B) + 1);
+	wide const Neg = -A;
+	wide const NegZero = -wide(static_cast<T>(0));
+	wide const Min = glm::min(A, B);
+	wide const Max = glm::max(A, static_cast<T>(0));
+	wide const Clamp = glm::clamp(A, wide(static_cast<T>(-1)), B);
+	wide const Mix = glm::mix(A, B, C);
+	wide const MixScalar = glm::mix(A, B, static_cast<T>(0.25));
+	wide const Sqrt = glm::sqrt(glm::abs(A));
+	wide const InverseSqrt = glm::inversesqrt(glm::abs(A) + 1);
+	mask const Less = glm::lessThan(A, B);
+	mask const LessEqual = glm::lessThanEqual(A, wide(static_cast<T>(0)));
+	mask const Greater = glm::greaterThan(A, B);
+	mask const GreaterEqual = glm::greaterThanEqual(A, wide(static_cast<T>(0)));
+	mask const Equal = glm::equal(A, A * 1);
+	mask const NotEqual = glm::notEqual(A, B);
+	wide const Select = glm::mix(A, B, Less);
+
+	for(glm::length_t i = 0; i < L; ++i)
+	{
+		Error += A[i] == a[i] ? 0 : 1;
+		Error += Add[i] == a[i] + b[i] ? 0 : 1;
+		Error += Sub[i] == a[i] - 2 ? 0 : 1;
+		Error += Mul[i] == 3 * a[i] * b[i] ? 0 : 1;
+		Error += Div[i] == a[i] / (glm::abs(b[i]) + 1) ? 0 : 1;
+		Error += Neg[i] == -a[i] ? 0 : 1;
+		Error += static_cast<T>(1) / NegZero[i] < static_cast<T>(0) ? 0 : 1;
+		Error += Min[i] == glm::min(a[i], b[i]) ? 0 : 1;
+		Error += Max[i] == glm::max(a[i], static_cast<T>(0)) ? 0 : 1;
+		Error += Clamp[i] == glm::clamp(a[i], static_cast<T>(-1), b[i]) || b[i] < static_cast<T>(-1) ? 0 : 1;
+		Error += close(Mix[i], glm::mix(a[i], b[i], c[i])) ? 0 : 1;
+		Error += close(MixScalar[i], glm::mix(a[i], b[i], static_cast<T>(0.25))) ? 0 : 1;
+		Error += close(Sqrt[i], glm::sqrt(glm::abs(a[i]))) ? 0 : 1;
+		Error += close(InverseSqrt[i], glm::inversesqrt(glm::abs(a[i]) + 1)) ? 0 : 1;
+		Error += Less[i] == (a[i] < b[i]) ? 0 : 1;
+		Error += LessEqual[i] == (a[i] <= 0) ? 0 : 1;
+		Error += Greater[i] == (a[i] > b[i]) ? 0 : 1;
+		Error += GreaterEqual[i] == (a[i] >= 0) ? 0 : 1;
+		Error += Equal[i] ? 0 : 1;
+		Error += NotEqual[i] == (a[i] != b[i]) ? 0 : 1;
+		Error += Select[i] == (a[i] < b[i] ? b[i] : a[i]) ? 0 : 1;
+		Error += (Less && GreaterEqual)[i] == (a[i] < b[i] && a[i] >= 0) ? 0 : 1;
+		Error += (Less || GreaterEqual)[i] == (a[i] < b[i] || a[i] >= 0) ? 0 : 1;
+		Error += glm::not_(Less)[i] == !(a[i] < b[i]) ? 0 : 1;
+	}
+
+	Error += glm::all(Equal) ? 0 : 1;
+	Error += glm::any(Equal) ? 0 : 1;
+	Error += !glm::any(glm::not_(Equal)) ? 0 : 1;
+	Error += !glm::all(mask(false)) && glm::all(mask(true)) ? 0 : 1;
+	Error += glm::all(Less || glm::not_(Less)) ? 0 : 1;
+
+	std::vector<T> Out(L + 1, static_cast<T>(7));
+	glm::store(Add, &Out[0]);
+	for(glm::length_t i = 0; i < L; ++i)
+		Error += Out[i] == a[i] + b[i] ? 0 : 1;
+	Error += Out[L] == static_cast<T>(7) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T, glm::length_t L>
+static int test_wide_vec()
+{
+	typedef glm::twide<T, L> wide;
+	typedef glm::twmask<T, L> mask;
+	typedef glm::tvec2<T, glm::defaultp> vec2;
+	typedef glm::tvec3<T, glm::defaultp> vec3;
+	typedef glm::tvec4<T, glm::defaultp> vec4;
+
+	int Error = 0;
+
+	std::vector<vec2> a2(L), b2(L);
+	std::vector<vec3> a3(L), b3(L);
+	std::vector<vec4> a4(L), b4(L);
+	std::vector<T> t(L);
+	for(glm::length_t i = 0; i < L; ++i)
+	{
+		std::size_t const j = static_cast<std::size_t>(i) * 8;
+		a4[i] = vec4(make_value(j + 0), make_value(j + 1), make_value(j + 2), make_value(j + 3));
+		b4[i] = vec4(make_value(j + 4), make_value(j + 5), make_value(j + 6), make_value(j + 7));
+		a3[i] = vec3(a4[i]);
+		b3[i] = vec3(b4[i]);
+		a2[i] = vec2(a4[i]);
+		b2[i] = vec2(b4[i]);
+		t[i] = static_cast<T>(0.125) * static_cast<T>(i % 9);
+	}
+
+	glm::twvec2<wide> A2, B2;
+	glm::twvec3<wide> A3, B3;
+	glm::twvec4<wide> A4, B4;
+	wide Tw;
+	glm::load(A2, &a2[0]);
+	glm::load(B2, &b2[0]);
+	glm::load(A3, &a3[0]);
+	glm::load(B3, &b3[0]);
+	glm::load(A4, &a4[0]);
+	glm::load(B4, &b4[0]);
+	glm::load(Tw, &t[0]);
+
+	// Round trips with sentinels after the L vectors
+	{
+		std::vector<vec2> Out2(L + 1, vec2(7));
+		std::vector<vec3> Out3(L + 1, vec3(7));
+		std::vector<vec4> Out4(L + 1, vec4(7));
+		glm::store(A2, &Out2[0]);
+		glm::store(A3, &Out3[0]);
+		glm::store(A4, &Out4[0]);
+		for(glm::length_t i = 0; i < L; ++i)
+		{
+			Error += Out2[i] == a2[i] ? 0 : 1;
+			Error += Out3[i] == a3[i] ? 0 : 1;
+			Error += Out4[i] == a4[i] ? 0 : 1;
+			Error += A3.x[i] == a3[i].x && A3.y[i] == a3[i].y && A3.z[i] == a3[i].z ? 0 : 1;
+		}
+		Error += Out2[L] == vec2(7) && Out3[L] == vec3(7) && Out4[L] == vec4(7) ? 0 : 1;
+	}
+
+	glm::twvec3<wide> const Add3 = A3 + B3 * 2;
+	glm::twvec3<wide> const Scale3 = (A3 - 1) / Tw.length();
+	glm::twvec3<wide> const Cross = glm::cross(A3, B3);
+	glm::twvec3<wide> const Normalize3 = glm::normalize(A3);
+	glm::twvec3<wide> const Mix3 = glm::mix(A3, B3, Tw);
+	glm::twvec3<wide> const MixScalar3 = glm::mix(A3, B3, static_cast<T>(0.5));
+	glm::twvec3<wide> const Clamp3 = glm::clamp(A3, static_cast<T>(-2), static_cast<T>(2));
+	glm::twvec3<wide> const ClampVec3 = glm::clamp(A3, -glm::abs(B3), glm::abs(B3));
+	glm::twvec3<wide> const Min3 = glm::min(A3, B3);
+	glm::twvec3<wide> const Max3 = glm::max(A3, B3);
+	wide const Dot2 = glm::dot(A2, B2);
+	wide const Dot3 = glm::dot(A3, B3);
+	wide const Dot4 = glm::dot(A4, B4);
+	wide const Length3 = glm::length(A3);
+	wide const Distance4 = glm::distance(A4, B4);
+	glm::twvec4<wide> const Normalize4 = glm::normalize(A4);
+	glm::twvec2<wide> const Normalize2 = glm::normalize(A2);
+	glm::twvec3<mask> const Less3 = glm::lessThan(A3, B3);
+	glm::twvec4<mask> const Equal4 = glm::equal(A4, -(-A4));
+	glm::twvec4<mask> const NotEqual4 = glm::notEqual(A4, B4);
+	mask const AllLess = glm::all(Less3);
+	mask const AnyLess = glm::any(Less3);
+	glm::twvec3<wide> const Select3 = glm::mix(A3, B3, AllLess);
+
+	glm::twvec4<wide> Compound4(A4);
+	Compound4 += B4;
+	Compound4 *= wide(static_cast<T>(2));
+	Compound4 -= A4;
+	Compound4 /= B4 * B4 + 1;
+
+	for(glm::length_t i = 0; i < L; ++i)
+	{
+		vec3 const a = a3[i];
+		vec3 const b = b3[i];
+
+		Error += glm::all(glm::equal(vec3(Add3.x[i], Add3.y[i], Add3.z[i]), a + b * static_cast<T>(2))) ? 0 : 1;
+		Error += glm::all(glm::equal(vec3(Scale3.x[i], Scale3.y[i], Scale3.z[i]), (a - static_cast<T>(1)) / static_cast<T>(L))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(vec3(Cross.x[i], Cross.y[i], Cross.z[i]), glm::cross(a, b), static_cast<T>(0.001))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(vec3(Normalize3.x[i], Normalize3.y[i], Normalize3.z[i]), glm::normalize(a), static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(vec3(Mix3.x[i], Mix3.y[i], Mix3.z[i]), glm::mix(a, b, t[i]), static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(vec3(MixScalar3.x[i], MixScalar3.y[i], MixScalar3.z[i]), glm::mix(a, b, static_cast<T>(0.5)), static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(vec3(Clamp3.x[i], Clamp3.y[i], Clamp3.z[i]), glm::clamp(a, static_cast<T>(-2), static_cast<T>(2)))) ? 0 : 1;
+		Error += glm::all(glm::equal(vec3(ClampVec3.x[i], ClampVec3.y[i], ClampVec3.z[i]), glm::clamp(a, -glm::abs(b), glm::abs(b)))) ? 0 : 1;
+		Error += glm::all(glm::equal(vec3(Min3.x[i], Min3.y[i], Min3.z[i]), glm::min(a, b))) ? 0 : 1;
+		Error += glm::all(glm::equal(vec3(Max3.x[i], Max3.y[i], Max3.z[i]), glm::max(a, b))) ? 0 : 1;
+		Error += close(Dot2[i], glm::dot(a2[i], b2[i])) ? 0 : 1;
+		Error += close(Dot3[i], glm::dot(a, b)) ? 0 : 1;
+		Error += close(Dot4[i], glm::dot(a4[i], b4[i])) ? 0 : 1;
+		Error += close(Length3[i], glm::length(a)) ? 0 : 1;
+		Error += close(Distance4[i], glm::distance(a4[i], b4[i])) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(vec4(Normalize4.x[i], Normalize4.y[i], Normalize4.z[i], Normalize4.w[i]), glm::normalize(a4[i]), static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(vec2(Normalize2.x[i], Normalize2.y[i]), glm::normalize(a2[i]), static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::tvec3<bool, glm::defaultp>(Less3.x[i], Less3.y[i], Less3.z[i]), glm::lessThan(a, b))) ? 0 : 1;
+		Error += Equal4.x[i] && Equal4.y[i] && Equal4.z[i] && Equal4.w[i] ? 0 : 1;
+		Error += NotEqual4.w[i] == (a4[i].w != b4[i].w) ? 0 : 1;
+		Error += AllLess[i] == glm::all(glm::lessThan(a, b)) ? 0 : 1;
+		Error += AnyLess[i] == glm::any(glm::lessThan(a, b)) ? 0 : 1;
+		Error += glm::all(glm::equal(vec3(Select3.x[i], Select3.y[i], Select3.z[i]), glm::all(glm::lessThan(a, b)) ? b : a)) ? 0 : 1;
+
+		vec4 const Compound = (((a4[i] + b4[i]) * static_cast<T>(2)) - a4[i]) / (b4[i] * b4[i] + static_cast<T>(1));
+		Error += glm::all(glm::epsilonEqual(vec4(Compound4.x[i], Compound4.y[i], Compound4.z[i], Compound4.w[i]), Compound, static_cast<T>(0.0001))) ? 0 : 1;
+	}
+
+	// Broadcast of a vector to every lane
+	glm::twvec3<wide> const Broadcast(vec3(1, 2, 3));
+	Error += glm::all(glm::all(glm::equal(Broadcast, glm::twvec3<wide>(wide(1), wide(2), wide(3))))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dot(Broadcast, Broadcast), wide(14))) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_wide<float, 4>();
+	Error += test_wide<float, 8>();
+	Error += test_wide<float, 16>();
+	Error += test_wide<double, 4>();
+	Error += test_wide<float, 3>();
+
+	Error += test_wide_vec<float, 4>();
+	Error += test_wide_vec<float, 8>();
+	Error += test_wide_vec<float, 16>();
+	Error += test_wide_vec<double, 4>();
+
+	return Error;
+}
@@ -19,6 +19,8 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
+// Janela, modo headless e benchmark por frame (Common/include)
+#include "AppWindow.h"
 
 // Protótipo da função de callback de teclado
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode);
@@ -49,10 +51,10 @@ const GLchar* fragmentShaderSource = "#version 400\n"
 "}\n\0";
 
 // Função MAIN
-int main()
+int main(int argc, char** argv)
 {
-	// Inicialização da GLFW
-	glfwInit();
+	// Inicialização da GLFW (ou do contexto sem janela, com --headless)
+	AppWindow app(argc, argv, "Ex5C");
 
 	//Muita atenção aqui: alguns ambientes não aceitam essas configurações
 	//Você deve adaptar para a versão do OpenGL suportada por sua placa
@@ -68,18 +70,11 @@ int main()
 //#endif
 
 	// Criação da janela GLFW
-	GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "Lista 1 - 5.C -- Luisa Becker", nullptr, nullptr);
-	glfwMakeContextCurrent(window);
+	if (!app.create(WIDTH, HEIGHT, "Lista 1 - 5.C -- Luisa Becker"))
+		return -1;
 
 	// Fazendo o registro da função de callback para a janela GLFW
-	glfwSetKeyCallback(window, key_callback);
-
-	// GLAD: carrega todos os ponteiros d funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-	{
-		std::cout << "Failed to initialize GLAD" << std::endl;
-
-	}
+	app.setKeyCallback(key_callback);
 
 	// Obtendo as informações de versão
 	const GLubyte* renderer = glGetString(GL_RENDERER); /* get renderer string */
@@ -89,7 +84,7 @@ int main()
 
 	// Definindo as dimensões da viewport com as mesmas dimensões da janela da aplicação
 	int width, height;
-	glfwGetFramebufferSize(window, &width, &height);
+	app.getFramebufferSize(&width, &height);
 	glViewport(0, 0, width, height);
 
 
@@ -109,10 +104,10 @@ int main()
 	
 
 	// Loop da aplicação - "game loop"
-	while (!glfwWindowShouldClose(window))
+	while (app.running())
 	{
 		// Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funções de callback correspondentes
-		glfwPollEvents();
+		app.pollEvents();
 
 		// Limpa o buffer de cor
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f); //cor de fundo
@@ -132,12 +127,12 @@ int main()
 		glBindVertexArray(0); //Desconectando o buffer de geometria
 
 		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		app.swapBuffers();
 	}
 	// Pede pra OpenGL desalocar os buffers
 	glDeleteVertexArrays(1, &VAO);
 	// Finaliza a execução da GLFW, limpando os recursos alocados por ela
-	glfwTerminate();
+	app.terminate();
 	return 0;
 }
 
@@ -157,6 +152,11 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
 // A função retorna o identificador do programa de shader
 int setupShader()
 {
+	// Programa já linkado em uma execução anterior (cache de binários em disco)
+	GLuint cachedProgram = sharedProgramCache().load(vertexShaderSource, fragmentShaderSource);
+	if (cachedProgram)
+		return cachedProgram;
+
 	// Vertex shader
 	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
 	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
@@ -185,6 +185,7 @@ int setupShader()
 	GLuint shaderProgram = glCreateProgram();
 	glAttachShader(shaderProgram, vertexShader);
 	glAttachShader(shaderProgram, fragmentShader);
+	sharedProgramCache().prepare(shaderProgram);
 	glLinkProgram(shaderProgram);
 	// Checando por erros de linkagem
 	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
@@ -195,6 +196,9 @@ int setupShader()
 	glDeleteShader(vertexShader);
 	glDeleteShader(fragmentShader);
 
+	// Guarda o binário para a próxima execução
+	sharedProgramCache().store(shaderProgram, vertexShaderSource, fragmentShaderSource);
+
 	return shaderProgram;
 }
 
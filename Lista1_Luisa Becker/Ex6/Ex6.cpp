@@ -11,6 +11,8 @@
 #include <string>
 #include <assert.h>
 #include <cmath>
+#include <cstring>
+#include <cstdlib>
 
 using namespace std;
 
@@ -20,17 +22,23 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
-// Para Círculo
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+// Janela, modo headless e benchmark por frame (Common/include)
+#include "AppWindow.h"
+
+// Formas paramétricas (Common/include)
+#include "Shapes.h"
+#include "InstancedShapes.h"
+#include "ProceduralShapes.h"
+
+// Compilação dos shaders sem bloquear, em paralelo quando o driver permite (Common/include)
+#include "ShaderBuildQueue.h"
 
 // Protótipo da função de callback de teclado
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode);
 
 // Protótipos das funções
-int setupShader();
-int setupGeometry();
+ShapeMesh setupGeometry();
+void setupInstancedScene(ShapeBatch& batch, int count);
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 800, HEIGHT = 600;
@@ -54,10 +62,24 @@ const GLchar* fragmentShaderSource = "#version 400\n"
 "}\n\0";
 
 // Função MAIN
-int main()
+// Uso: Ex6 [--instanced N | --procedural]
+// Com --instanced, desenha N formas da família do exercício 6 (círculos, polígonos,
+// Pac-Men, fatias de pizza e estrelas) com uma chamada instanciada por tipo de forma
+// Com --procedural, o círculo é gerado no vertex shader (gl_VertexID), sem VBO
+int main(int argc, char** argv)
 {
-	// Inicialização da GLFW
-	glfwInit();
+	int instancedCount = 0;
+	bool procedural = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--instanced") == 0)
+			instancedCount = (i + 1 < argc) ? atoi(argv[++i]) : 10000;
+		else if (strcmp(argv[i], "--procedural") == 0)
+			procedural = true;
+	}
+
+	// Inicialização da GLFW (ou do contexto sem janela, com --headless)
+	AppWindow app(argc, argv, "Ex6");
 
 	//Muita atenção aqui: alguns ambientes não aceitam essas configurações
 	//Você deve adaptar para a versão do OpenGL suportada por sua placa
@@ -73,18 +95,11 @@ int main()
 //#endif
 
 	// Criação da janela GLFW
-	GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "Lista 1 - 6 -- Luisa Becker", nullptr, nullptr);
-	glfwMakeContextCurrent(window);
+	if (!app.create(WIDTH, HEIGHT, "Lista 1 - 6 -- Luisa Becker"))
+		return -1;
 
 	// Fazendo o registro da função de callback para a janela GLFW
-	glfwSetKeyCallback(window, key_callback);
-
-	// GLAD: carrega todos os ponteiros d funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-	{
-		std::cout << "Failed to initialize GLAD" << std::endl;
-
-	}
+	app.setKeyCallback(key_callback);
 
 	// Obtendo as informações de versão
 	const GLubyte* renderer = glGetString(GL_RENDERER); /* get renderer string */
@@ -94,16 +109,39 @@ int main()
 
 	// Definindo as dimensões da viewport com as mesmas dimensões da janela da aplicação
 	int width, height;
-	glfwGetFramebufferSize(window, &width, &height);
+	app.getFramebufferSize(&width, &height);
 	glViewport(0, 0, width, height);
 
 
-	// Compilando e buildando o programa de shader
-	GLuint shaderID = setupShader();
+	// Enviando todos os programas de shader para compilação de uma vez: o driver
+	// compila (em paralelo, com GL_KHR_parallel_shader_compile) enquanto a
+	// geometria é montada, e o status só é conferido em finish()
+	ShaderBuildQueue shaders(app.getProcLoader());
+	int mainProgram = shaders.add(vertexShaderSource, fragmentShaderSource);
+	int instancedProgram = instancedCount > 0 ? shaders.add(instancedVertexShaderSource, instancedFragmentShaderSource) : -1;
+	int proceduralProgramID = procedural ? shaders.add(proceduralVertexShaderSource, proceduralFragmentShaderSource) : -1;
+
+	// Gerando um buffer simples, com a geometria do círculo
+	// Os modos instanciado e procedural não desenham essa malha: nenhum VBO é criado
+	bool meshMode = instancedCount <= 0 && !procedural;
+	ShapeMesh shape;
+	if (meshMode)
+		shape = setupGeometry();
+
+	// Modo instanciado: as formas e suas cores ficam no buffer de instâncias
+	ShapeBatch batch;
+	if (instancedCount > 0)
+	{
+		setupInstancedScene(batch, instancedCount);
+		cout << "Instanced mode: " << batch.instanceCount() << " shapes in " << batch.drawCalls() << " draw calls" << endl;
+	}
 
-	// Gerando um buffer simples, com a geometria de um triângulo
-	GLuint VAO = setupGeometry();
-	
+	// Esperando os programas que ainda não terminaram
+	shaders.finish();
+	if (app.benchmark().enabled())
+		shaders.printStats(cout);
+	GLuint shaderID = shaders.program(mainProgram);
+	GLuint instancedShaderID = instancedCount > 0 ? shaders.program(instancedProgram) : 0;
 
 	// Enviando a cor desejada (vec4) para o fragment shader
 	// Utilizamos a variáveis do tipo uniform em GLSL para armazenar esse tipo de info
@@ -111,13 +149,17 @@ int main()
 	GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
 	
 	glUseProgram(shaderID);
-	
+
+	// Modo procedural: só os parâmetros da forma vão para a GPU, como uniforms
+	ProceduralProgram proceduralProgram;
+	if (procedural)
+		proceduralProgram = setupProceduralProgram(shaders.program(proceduralProgramID));
 
 	// Loop da aplicação - "game loop"
-	while (!glfwWindowShouldClose(window))
+	while (app.running())
 	{
 		// Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funções de callback correspondentes
-		glfwPollEvents();
+		app.pollEvents();
 
 		// Limpa o buffer de cor
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f); //cor de fundo
@@ -126,24 +168,43 @@ int main()
 		glLineWidth(10);
 		glPointSize(20);
 
-		glBindVertexArray(VAO); //Conectando ao buffer de geometria
-
-		glUniform4f(colorLoc, 1.0f, 0.0f, 1.0f, 1.0f); //enviando cor para variável uniform inputColor
-
-		// Chamada de desenho - drawcall
-		// Poligono Preenchido - GL_TRIANGLES
-		const int numVertices = 36;
-		glDrawArrays(GL_TRIANGLE_FAN, 0, numVertices + 2);
-		
-		glBindVertexArray(0); //Desconectando o buffer de geometria
+		if (instancedCount > 0)
+		{
+			// Todas as formas: uma chamada instanciada por tipo de forma
+			glUseProgram(instancedShaderID);
+			batch.draw();
+		}
+		else if (procedural)
+		{
+			// O mesmo círculo, com os vértices calculados no vertex shader
+			glUseProgram(proceduralProgram.program);
+			glUniform4f(proceduralProgram.colorLoc, 1.0f, 0.0f, 1.0f, 1.0f);
+			drawProceduralShape(proceduralProgram, circleShape(0.5f, 36));
+		}
+		else
+		{
+			glBindVertexArray(shape.VAO); //Conectando ao buffer de geometria
+
+			glUniform4f(colorLoc, 1.0f, 0.0f, 1.0f, 1.0f); //enviando cor para variável uniform inputColor
+
+			// Chamada de desenho - drawcall
+			// Poligono Preenchido - GL_TRIANGLES
+			drawShape(shape);
+
+			glBindVertexArray(0); //Desconectando o buffer de geometria
+		}
 
 		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		app.swapBuffers();
 	}
 	// Pede pra OpenGL desalocar os buffers
-	glDeleteVertexArrays(1, &VAO);
+	if (meshMode)
+		deleteShape(shape);
+	batch.release();
+	if (procedural)
+		deleteProceduralProgram(proceduralProgram);
 	// Finaliza a execução da GLFW, limpando os recursos alocados por ela
-	glfwTerminate();
+	app.terminate();
 	return 0;
 }
 
@@ -156,90 +217,46 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
 		glfwSetWindowShouldClose(window, GL_TRUE);
 }
 
-//Esta função está basntante hardcoded - objetivo é compilar e "buildar" um programa de
-// shader simples e único neste exemplo de código
-// O código fonte do vertex e fragment shader está nos arrays vertexShaderSource e
-// fragmentShader source no iniçio deste arquivo
-// A função retorna o identificador do programa de shader
-int setupShader()
+// Cria os buffers com a geometria da forma a partir dos parâmetros, usando o
+// gerador de Common/include/Shapes.h
+// Círculo de raio 0.5 com 36 vértices na borda
+// 1 VBO com as coordenadas, 1 EBO com os índices e VAO com apenas 1 ponteiro para atributo
+// A função retorna a malha (VAO, buffers, primitiva e quantidade de índices)
+ShapeMesh setupGeometry()
 {
-	// Vertex shader
-	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-	glCompileShader(vertexShader);
-	// Checando erros de compilação (exibição via log no terminal)
-	GLint success;
-	GLchar infoLog[512];
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-	}
-	// Fragment shader
-	GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-	glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-	glCompileShader(fragmentShader);
-	// Checando erros de compilação (exibição via log no terminal)
-	glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-	}
-	// Linkando os shaders e criando o identificador do programa de shader
-	GLuint shaderProgram = glCreateProgram();
-	glAttachShader(shaderProgram, vertexShader);
-	glAttachShader(shaderProgram, fragmentShader);
-	glLinkProgram(shaderProgram);
-	// Checando por erros de linkagem
-	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-	if (!success) {
-		glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-	}
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader);
-
-	return shaderProgram;
+	return uploadShape(circleShape(0.5f, 36));
 }
 
-// Esta função está bastante harcoded - objetivo é criar os buffers que armazenam a 
-// geometria de um triângulo
-// Apenas atributo coordenada nos vértices
-// 1 VBO com as coordenadas, VAO com apenas 1 ponteiro para atributo
-// A função retorna o identificador do VAO
-
-int setupGeometry()
+// Monta a cena do modo instanciado: count formas distribuídas em uma grade que
+// cobre a janela, alternando entre os tipos de forma da lista 6
+// Cada tipo é uma malha de raio 1; a escala de cada instância ajusta o tamanho à célula
+void setupInstancedScene(ShapeBatch& batch, int count)
 {
-	const int numVertices = 36;  // Quantidade de vértices para a borda
-    const float radius = 0.5f;   // Raio do círculo
-    GLfloat vertices[(numVertices + 2) * 3]; // +2 para o centro e um vértice extra para fechar o círculo
-    
-	vertices[0] = 0.0f; // Vértice central x
-    vertices[1] = 0.0f; // Vértice central y
-    vertices[2] = 0.0f; // Vértice central z
-
-    for (int i = 1; i <= numVertices + 1; ++i) // +1 para repetir o primeiro ponto na borda
-    {
-        float angle = 2.0f * M_PI * (i - 1) / numVertices;
-        vertices[3 * i] = radius * cos(angle); // x
-        vertices[3 * i + 1] = radius * sin(angle); // y
-        vertices[3 * i + 2] = 0.0f; // z
-    }
-
-    GLuint VBO, VAO;
-    glGenBuffers(1, &VBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0); 
-    glBindVertexArray(0); 
-
-    return VAO;
+	int kinds[] = {
+		batch.addShape(circleShape(1.0f, 36)),
+		batch.addShape(polygonShape(8, 1.0f)),
+		batch.addShape(polygonShape(5, 1.0f)),
+		batch.addShape(pacmanShape(1.0f, 30)),
+		batch.addShape(pizzaSliceShape(1.0f, 30)),
+		batch.addShape(starShape(5, 1.0f, 0.4f))
+	};
+	const int numKinds = sizeof(kinds) / sizeof(kinds[0]);
+
+	int columns = (int)ceil(sqrt((double)count));
+	float cell = 2.0f / columns;
+	for (int i = 0; i < count; ++i)
+	{
+		int row = i / columns, column = i % columns;
+		ShapeInstance instance;
+		instance.x = -1.0f + cell * (column + 0.5f);
+		instance.y = -1.0f + cell * (row + 0.5f);
+		instance.scale = cell * 0.45f;
+		instance.rotation = 0.1f * i;
+		instance.r = (float)column / columns;
+		instance.g = (float)row / columns;
+		instance.b = 1.0f - instance.r;
+		instance.a = 1.0f;
+		batch.addInstance(kinds[i % numKinds], instance);
+	}
+	batch.upload();
 }
-
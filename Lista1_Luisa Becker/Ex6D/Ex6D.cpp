@@ -20,17 +20,18 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
-// Para PAC-MAN
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+// Janela, modo headless e benchmark por frame (Common/include)
+#include "AppWindow.h"
+
+// Formas paramétricas (Common/include)
+#include "Shapes.h"
 
 // Protótipo da função de callback de teclado
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode);
 
 // Protótipos das funções
 int setupShader();
-int setupGeometry();
+ShapeMesh setupGeometry();
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 800, HEIGHT = 600;
@@ -54,10 +55,10 @@ const GLchar* fragmentShaderSource = "#version 400\n"
 "}\n\0";
 
 // Função MAIN
-int main()
+int main(int argc, char** argv)
 {
-	// Inicialização da GLFW
-	glfwInit();
+	// Inicialização da GLFW (ou do contexto sem janela, com --headless)
+	AppWindow app(argc, argv, "Ex6D");
 
 	//Muita atenção aqui: alguns ambientes não aceitam essas configurações
 	//Você deve adaptar para a versão do OpenGL suportada por sua placa
@@ -73,18 +74,11 @@ int main()
 //#endif
 
 	// Criação da janela GLFW
-	GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "Lista 1 - 6.D -- Luisa Becker", nullptr, nullptr);
-	glfwMakeContextCurrent(window);
+	if (!app.create(WIDTH, HEIGHT, "Lista 1 - 6.D -- Luisa Becker"))
+		return -1;
 
 	// Fazendo o registro da função de callback para a janela GLFW
-	glfwSetKeyCallback(window, key_callback);
-
-	// GLAD: carrega todos os ponteiros d funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-	{
-		std::cout << "Failed to initialize GLAD" << std::endl;
-
-	}
+	app.setKeyCallback(key_callback);
 
 	// Obtendo as informações de versão
 	const GLubyte* renderer = glGetString(GL_RENDERER); /* get renderer string */
@@ -94,7 +88,7 @@ int main()
 
 	// Definindo as dimensões da viewport com as mesmas dimensões da janela da aplicação
 	int width, height;
-	glfwGetFramebufferSize(window, &width, &height);
+	app.getFramebufferSize(&width, &height);
 	glViewport(0, 0, width, height);
 
 
@@ -102,7 +96,7 @@ int main()
 	GLuint shaderID = setupShader();
 
 	// Gerando um buffer simples, com a geometria de um triângulo
-	GLuint VAO = setupGeometry();
+	ShapeMesh shape = setupGeometry();
 	
 
 	// Enviando a cor desejada (vec4) para o fragment shader
@@ -114,10 +108,10 @@ int main()
 	
 
 	// Loop da aplicação - "game loop"
-	while (!glfwWindowShouldClose(window))
+	while (app.running())
 	{
 		// Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funções de callback correspondentes
-		glfwPollEvents();
+		app.pollEvents();
 
 		// Limpa o buffer de cor
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f); //cor de fundo
@@ -126,25 +120,24 @@ int main()
 		glLineWidth(10);
 		glPointSize(20);
 
-		glBindVertexArray(VAO); //Conectando ao buffer de geometria
+		glBindVertexArray(shape.VAO); //Conectando ao buffer de geometria
 
 		// Amarelo para o queijo
 		glUniform4f(colorLoc, 1.0f, 1.0f, 0.0f, 1.0f); //enviando cor para variável uniform inputColor
 
 		// Chamada de desenho - drawcall
 		// Fatia de Pizza - GL_TRIANGLES
-		const int numVertices = 30; // Numero de vertices para arco
-		glDrawArrays(GL_TRIANGLE_FAN, 0, numVertices + 2);
+		drawShape(shape);
 		
 		glBindVertexArray(0); //Desconectando o buffer de geometria
 
 		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		app.swapBuffers();
 	}
 	// Pede pra OpenGL desalocar os buffers
-	glDeleteVertexArrays(1, &VAO);
+	deleteShape(shape);
 	// Finaliza a execução da GLFW, limpando os recursos alocados por ela
-	glfwTerminate();
+	app.terminate();
 	return 0;
 }
 
@@ -164,6 +157,11 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
 // A função retorna o identificador do programa de shader
 int setupShader()
 {
+	// Programa já linkado em uma execução anterior (cache de binários em disco)
+	GLuint cachedProgram = sharedProgramCache().load(vertexShaderSource, fragmentShaderSource);
+	if (cachedProgram)
+		return cachedProgram;
+
 	// Vertex shader
 	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
 	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
@@ -192,6 +190,7 @@ int setupShader()
 	GLuint shaderProgram = glCreateProgram();
 	glAttachShader(shaderProgram, vertexShader);
 	glAttachShader(shaderProgram, fragmentShader);
+	sharedProgramCache().prepare(shaderProgram);
 	glLinkProgram(shaderProgram);
 	// Checando por erros de linkagem
 	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
@@ -202,47 +201,18 @@ int setupShader()
 	glDeleteShader(vertexShader);
 	glDeleteShader(fragmentShader);
 
+	// Guarda o binário para a próxima execução
+	sharedProgramCache().store(shaderProgram, vertexShaderSource, fragmentShaderSource);
+
 	return shaderProgram;
 }
 
-// Esta função está bastante hardcoded - objetivo é criar os buffers que armazenam a 
-// geometria de uma fatia de pizza
-// Apenas atributo coordenada nos vértices
-// 1 VBO com as coordenadas, VAO com apenas 1 ponteiro para atributo
-// A função retorna o identificador do VAO
-
-int setupGeometry()
+// Cria os buffers com a geometria da forma a partir dos parâmetros, usando o
+// gerador de Common/include/Shapes.h
+// Fatia de pizza: setor de 60 graus com 30 divisões
+// 1 VBO com as coordenadas, 1 EBO com os índices e VAO com apenas 1 ponteiro para atributo
+// A função retorna a malha (VAO, buffers, primitiva e quantidade de índices)
+ShapeMesh setupGeometry()
 {
-	const int numVertices = 30;  // Definimos o número de vértices para o arco
-    const float radius = 0.5f;   // Raio da fatia de pizza
-    GLfloat vertices[(numVertices + 2) * 3]; // +2 para o centro e para fechar o arco
-    vertices[0] = 0.0f; // Vértice central x
-    vertices[1] = 0.0f; // Vértice central y
-    vertices[2] = 0.0f; // Vértice central z
-
-    // Definimos o ângulo do arco (60 graus para uma fatia de pizza)
-    float startAngle = -M_PI / 6.0f;  // Início da fatia de pizza (em radianos)
-    float endAngle = M_PI / 6.0f;     // Fim da fatia de pizza (60 graus)
-
-    for (int i = 1; i <= numVertices + 1; ++i) // +1 para fechar o arco
-    {
-        float angle = startAngle + (endAngle - startAngle) * (i - 1) / numVertices;
-        vertices[3 * i] = radius * cos(angle); // x
-        vertices[3 * i + 1] = radius * sin(angle); // y
-        vertices[3 * i + 2] = 0.0f; // z
-    }
-
-    GLuint VBO, VAO;
-    glGenBuffers(1, &VBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0); 
-    glBindVertexArray(0); 
-
-    return VAO;
+	return uploadShape(pizzaSliceShape(0.5f, 30));
 }
@@ -11,6 +11,8 @@
 #include <string>
 #include <assert.h>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 using namespace std;
 
@@ -20,17 +22,32 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
-// Para desenhar a espiral
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+// Janela, modo headless e benchmark por frame (Common/include)
+#include "AppWindow.h"
+
+// Curvas com tesselação adaptativa (Common/include)
+#include "Curves.h"
+
+// Anel de buffers para a geometria animada (Common/include)
+#include "StreamBuffer.h"
+
+// Simulação em passo fixo em outra thread (Common/include)
+#include "FrameLoop.h"
 
 // Protótipo da função de callback de teclado
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode);
 
 // Protótipos das funções
 int setupShader();
-int setupGeometry();
+CurveTessOptions setupTessOptions(int width, int height);
+CurveMesh setupGeometry(int width, int height);
+
+// Estado da simulação no modo --threaded: a espiral já tesselada
+struct SpiralState
+{
+	std::vector<GLfloat> vertices;
+};
+void updateSpiral(SpiralState& state, double t, const CurveTessOptions& options);
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 800, HEIGHT = 600;
@@ -53,23 +70,32 @@ const GLchar* fragmentShaderSource = "#version 400\n"
 "}\n\0";
 
 // Função MAIN
-int main()
+// Uso: Ex7 [--animate] [--threaded]
+// Com --animate, a espiral cresce até as 5 voltas em 4 segundos e recomeça: ela é
+// tesselada de novo a cada frame direto no anel de buffers (StreamBuffer.h)
+// Com --threaded (implica --animate), a tesselação roda na thread de simulação
+// (FrameLoop.h) a 120 Hz, e o laço de desenho só copia a espiral mais recente
+// para o anel
+int main(int argc, char** argv)
 {
-	// Inicialização da GLFW
-	glfwInit();
+	bool animate = false, threaded = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "--animate") == 0)
+			animate = true;
+		else if (strcmp(argv[i], "--threaded") == 0)
+			animate = threaded = true;
+	}
+
+	// Inicialização da GLFW (ou do contexto sem janela, com --headless)
+	AppWindow app(argc, argv, "Ex7");
 
 	// Criação da janela GLFW
-	GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "Lista 1 - 7 -- Luisa Becker", nullptr, nullptr);
-	glfwMakeContextCurrent(window);
+	if (!app.create(WIDTH, HEIGHT, "Lista 1 - 7 -- Luisa Becker"))
+		return -1;
 
 	// Fazendo o registro da função de callback para a janela GLFW
-	glfwSetKeyCallback(window, key_callback);
-
-	// GLAD: carrega todos os ponteiros das funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-	{
-		std::cout << "Failed to initialize GLAD" << std::endl;
-	}
+	app.setKeyCallback(key_callback);
 
 	// Obtendo as informações de versão
 	const GLubyte* renderer = glGetString(GL_RENDERER); /* get renderer string */
@@ -79,25 +105,44 @@ int main()
 
 	// Definindo as dimensões da viewport com as mesmas dimensões da janela da aplicação
 	int width, height;
-	glfwGetFramebufferSize(window, &width, &height);
+	app.getFramebufferSize(&width, &height);
 	glViewport(0, 0, width, height);
 
 	// Compilando e buildando o programa de shader
 	GLuint shaderID = setupShader();
 
 	// Gerando um buffer simples, com a geometria de uma espiral
-	GLuint VAO = setupGeometry();
+	CurveMesh shape = setupGeometry(width, height);
+	cout << "Spiral: " << shape.vertexCount << " vertices" << endl;
 
 	// Enviando a cor desejada (vec4) para o fragment shader
 	GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
 
 	glUseProgram(shaderID);
 
+	// Modo animado: cada região do anel comporta a espiral inteira
+	CurveTessOptions options = setupTessOptions(width, height);
+	StreamBuffer stream;
+	GLuint streamVAO = 0;
+	if (animate)
+	{
+		stream.init(app.getProcLoader(), (GLsizeiptr)shape.vertexCount * 3 * sizeof(GLfloat));
+		streamVAO = createStreamPositionVAO(stream);
+	}
+	FixedStepSimulation<SpiralState> simulation;
+	if (threaded)
+	{
+		simulation.start(120.0, [options](SpiralState& state, double t, double dt)
+		{
+			updateSpiral(state, t + dt, options);
+		});
+	}
+
 	// Loop da aplicação - "game loop"
-	while (!glfwWindowShouldClose(window))
+	while (app.running())
 	{
 		// Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funções de callback correspondentes
-		glfwPollEvents();
+		app.pollEvents();
 
 		// Limpa o buffer de cor
 		glClearColor(0.0f, 0.0f, 0.0f, 1.0f); //cor de fundo
@@ -105,24 +150,68 @@ int main()
 
 		glLineWidth(2);
 
-		glBindVertexArray(VAO); //Conectando ao buffer de geometria
-
 		// Cor vermelha para a espiral
 		glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f); // Enviando cor para variável uniform inputColor
 
-		// Desenha a espiral - GL_LINE_STRIP
-		const int numVertices = 1000; // Número de pontos para a espiral
-		glDrawArrays(GL_LINE_STRIP, 0, numVertices); // Desenhar a espiral como uma linha conectada
-		
-		glBindVertexArray(0); // Desconectando o buffer de geometria
+		if (threaded)
+		{
+			// Espiral mais recente publicada pela simulação (nenhuma antes do primeiro passo)
+			const SimSnapshot<SpiralState>* snapshot = simulation.latest();
+			stream.beginFrame();
+			if (snapshot && !snapshot->state.vertices.empty())
+			{
+				const std::vector<GLfloat>& vertices = snapshot->state.vertices;
+				StreamedDraw spiral = streamVertices(stream, vertices.data(), (GLsizei)(vertices.size() / 3), GL_LINE_STRIP);
+				glBindVertexArray(streamVAO);
+				drawStreamed(spiral);
+				glBindVertexArray(0);
+			}
+			stream.endFrame();
+		}
+		else if (animate)
+		{
+			// Ângulo final cresce de 0 a 10 pi em 4 segundos, e fica 1 segundo completo
+			double progress = std::min(1.0, fmod(app.time(), 5.0) / 4.0);
+			stream.beginFrame();
+			StreamedDraw spiral = streamCurve(stream, spiralCurve(0.05f, 0.1f), 0.0, 10.0 * M_PI * progress, options);
+			glBindVertexArray(streamVAO);
+			drawStreamed(spiral);
+			glBindVertexArray(0);
+			stream.endFrame();
+		}
+		else
+		{
+			glBindVertexArray(shape.VAO); //Conectando ao buffer de geometria
+
+			// Desenha a espiral - GL_LINE_STRIP
+			drawCurve(shape);
+
+			glBindVertexArray(0); // Desconectando o buffer de geometria
+		}
 
 		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		app.swapBuffers();
+
+		// Animação: próximo frame em 1/60 s (sem isso, a janela só redesenha em eventos)
+		if (animate)
+			app.invalidateAfter(1.0 / 60.0);
 	}
 	// Pede para OpenGL desalocar os buffers
-	glDeleteVertexArrays(1, &VAO);
+	deleteCurve(shape);
+	simulation.stop();
+	if (animate)
+	{
+		if (app.benchmark().enabled())
+		{
+			stream.printStats(cout);
+			if (threaded)
+				simulation.printStats(cout);
+		}
+		glDeleteVertexArrays(1, &streamVAO);
+		stream.release();
+	}
 	// Finaliza a execução da GLFW, limpando os recursos alocados por ela
-	glfwTerminate();
+	app.terminate();
 	return 0;
 }
 
@@ -142,6 +231,11 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
 // A função retorna o identificador do programa de shader
 int setupShader()
 {
+	// Programa já linkado em uma execução anterior (cache de binários em disco)
+	GLuint cachedProgram = sharedProgramCache().load(vertexShaderSource, fragmentShaderSource);
+	if (cachedProgram)
+		return cachedProgram;
+
 	// Vertex shader
 	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
 	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
@@ -170,6 +264,7 @@ int setupShader()
 	GLuint shaderProgram = glCreateProgram();
 	glAttachShader(shaderProgram, vertexShader);
 	glAttachShader(shaderProgram, fragmentShader);
+	sharedProgramCache().prepare(shaderProgram);
 	glLinkProgram(shaderProgram);
 	// Checando por erros de linkagem
 	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
@@ -180,45 +275,44 @@ int setupShader()
 	glDeleteShader(vertexShader);
 	glDeleteShader(fragmentShader);
 
+	// Guarda o binário para a próxima execução
+	sharedProgramCache().store(shaderProgram, vertexShaderSource, fragmentShaderSource);
+
 	return shaderProgram;
 }
 
-// Esta função está bastante hardcoded - objetivo é criar os buffers que armazenam a 
-// geometria de uma espiral
-// Apenas atributo coordenada nos vértices
-// 1 VBO com as coordenadas, VAO com apenas 1 ponteiro para atributo
-// A função retorna o identificador do VAO
+// Cria os buffers com a geometria da espiral, usando a tesselação adaptativa
+// de Common/include/Curves.h
+// Espiral r = a + b * theta com a = 0.05, b = 0.1 e 5 voltas
+// A quantidade de pontos depende do tamanho da tela: cada segmento fica a no
+// máximo 0.25 pixel da curva (antes eram sempre 1000 pontos)
+// 1 VBO com as coordenadas e VAO com apenas 1 ponteiro para atributo
+// A função retorna a malha (VAO, VBO e quantidade de vértices)
+CurveMesh setupGeometry(int width, int height)
+{
+	return uploadCurve(spiralCurve(0.05f, 0.1f), 0.0, 10.0 * M_PI, setupTessOptions(width, height));
+}
 
-int setupGeometry()
+// Passo da simulação: tessela a espiral do instante t (mesma animação do --animate)
+void updateSpiral(SpiralState& state, double t, const CurveTessOptions& options)
 {
-	const int numVertices = 1000;  // Definimos um número elevado de vértices para suavizar a espiral
-    const float a = 0.05f;         // Constante a, define a distância inicial
-    const float b = 0.1f;          // Constante b, define a taxa de crescimento da espiral
-    const float maxTheta = 10.0f * M_PI;  // Máximo valor de θ, 5 voltas completas
-
-    GLfloat vertices[numVertices * 3]; // Cada vértice terá coordenadas (x, y, z)
-
-    for (int i = 0; i < numVertices; ++i)
-    {
-        float theta = maxTheta * (i / static_cast<float>(numVertices - 1)); // θ variando de 0 até maxTheta
-        float r = a + b * theta; // Definindo o raio de acordo com θ
-
-        vertices[3 * i] = r * cos(theta); // x
-        vertices[3 * i + 1] = r * sin(theta); // y
-        vertices[3 * i + 2] = 0.0f; // z, como estamos desenhando no plano xy
-    }
-
-    GLuint VBO, VAO;
-    glGenBuffers(1, &VBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0); 
-    glBindVertexArray(0); 
-
-    return VAO;
-}
\ No newline at end of file
+	double progress = std::min(1.0, fmod(t, 5.0) / 4.0);
+	std::vector<GLfloat>& vertices = state.vertices;
+	vertices.clear();
+	tessellateCurve(spiralCurve(0.05f, 0.1f), 0.0, 10.0 * M_PI * progress, options,
+		[&vertices](const GLfloat* chunk, GLuint n, GLuint first)
+	{
+		vertices.resize(((size_t)first + n) * 3);
+		std::copy(chunk, chunk + n * 3, vertices.begin() + (size_t)first * 3);
+	});
+}
+
+// Tolerância da tesselação (0.25 pixel) para uma tela de width x height pixels
+CurveTessOptions setupTessOptions(int width, int height)
+{
+	CurveTessOptions options;
+	options.tolerance = 0.25f;
+	options.viewportWidth = width;
+	options.viewportHeight = height;
+	return options;
+}
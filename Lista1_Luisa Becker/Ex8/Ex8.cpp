@@ -21,8 +21,10 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 #include <assert.h>
 #include <cmath>
+#include <cstring>
 
 using namespace std;
 
@@ -32,12 +34,18 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
+// Janela, modo headless e benchmark por frame (Common/include)
+#include "AppWindow.h"
+
+// Formatos de vértice compactos (Common/include)
+#include "VertexFormat.h"
+
 // Protótipo da função de callback de teclado
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode);
 
 // Protótipos das funções
 int setupShader();
-int setupGeometry();
+int setupGeometry(const VertexFormat& format, GLADloadproc loader);
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 800, HEIGHT = 600;
@@ -63,24 +71,30 @@ const GLchar* fragmentShaderSource = "#version 400 core\n"
 "}\n\0";
 
 // Função MAIN
-int main()
+// Uso: Ex8 [--vertex-format F]
+// Com --vertex-format, os vértices ficam no VBO como float, float2, half ou snorm16
+// (padrão: float, 24 bytes por vértice; half e snorm16 usam 8 - VertexFormat.h)
+int main(int argc, char** argv)
 {
-    // Inicialização da GLFW
-    glfwInit();
+    VertexFormat vertexFormat = floatVertexFormat();
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--vertex-format") == 0 && i + 1 < argc)
+        {
+            if (!findVertexFormat(argv[++i], &vertexFormat))
+                return -1;
+        }
+    }
+
+    // Inicialização da GLFW (ou do contexto sem janela, com --headless)
+    AppWindow app(argc, argv, "Ex8");
 
     // Criação da janela GLFW
-    GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "Lista 1 - 8 -- Luisa Becker", nullptr, nullptr);
-    glfwMakeContextCurrent(window);
+    if (!app.create(WIDTH, HEIGHT, "Lista 1 - 8 -- Luisa Becker"))
+        return -1;
 
     // Fazendo o registro da função de callback para a janela GLFW
-    glfwSetKeyCallback(window, key_callback);
-
-    // GLAD: carrega todos os ponteiros das funções da OpenGL
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-    {
-        std::cout << "Failed to initialize GLAD" << std::endl;
-        return -1;
-    }
+    app.setKeyCallback(key_callback);
 
     // Obtendo as informações de versão
     const GLubyte* renderer = glGetString(GL_RENDERER); /* get renderer string */
@@ -90,20 +104,20 @@ int main()
 
     // Definindo as dimensões da viewport com as mesmas dimensões da janela da aplicação
     int width, height;
-    glfwGetFramebufferSize(window, &width, &height);
+    app.getFramebufferSize(&width, &height);
     glViewport(0, 0, width, height);
 
     // Compilando e buildando o programa de shader
     GLuint shaderID = setupShader();
 
     // Gerando um buffer simples, com a geometria de um triângulo
-    GLuint VAO = setupGeometry();
+    GLuint VAO = setupGeometry(vertexFormat, app.getProcLoader());
 
     // Loop da aplicação - "game loop"
-    while (!glfwWindowShouldClose(window))
+    while (app.running())
     {
         // Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funções de callback correspondentes
-        glfwPollEvents();
+        app.pollEvents();
 
         // Limpa o buffer de cor
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f); //cor de fundo
@@ -122,14 +136,14 @@ int main()
         glBindVertexArray(0);
 
         // Troca os buffers da tela
-        glfwSwapBuffers(window);
+        app.swapBuffers();
     }
 
     // Pede para OpenGL desalocar os buffers
     glDeleteVertexArrays(1, &VAO);
 
     // Finaliza a execução da GLFW, limpando os recursos alocados por ela
-    glfwTerminate();
+    app.terminate();
     return 0;
 }
 
@@ -143,6 +157,11 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
 // Função que compila e linka o Vertex e Fragment Shader em um Shader Program
 int setupShader()
 {
+    // Programa já linkado em uma execução anterior (cache de binários em disco)
+    GLuint cachedProgram = sharedProgramCache().load(vertexShaderSource, fragmentShaderSource);
+    if (cachedProgram)
+        return cachedProgram;
+
     // Vertex shader
     GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
@@ -175,6 +194,7 @@ int setupShader()
     GLuint shaderProgram = glCreateProgram();
     glAttachShader(shaderProgram, vertexShader);
     glAttachShader(shaderProgram, fragmentShader);
+    sharedProgramCache().prepare(shaderProgram);
     glLinkProgram(shaderProgram);
 
     // Checando por erros de linkagem
@@ -189,11 +209,14 @@ int setupShader()
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    // Guarda o binário para a próxima execução
+    sharedProgramCache().store(shaderProgram, vertexShaderSource, fragmentShaderSource);
+
     return shaderProgram;
 }
 
 // Função para configurar o VBO e VAO
-int setupGeometry()
+int setupGeometry(const VertexFormat& format, GLADloadproc loader)
 {
     // Definição dos vértices com suas posições e cores
     GLfloat vertices[] = {
@@ -203,6 +226,12 @@ int setupGeometry()
         1.0f, -1.0f, 0.0f, 0.0f, 0.0f, 1.0f   // P3 (Azul)
     };
 
+    // No VBO cada vértice vai no formato escolhido (--vertex-format); com half ou
+    // snorm16, posição (x, y) e cor RGBA8 ocupam 8 bytes em vez de 24 (o z é
+    // sempre 0 e o shader o recebe assim)
+    vector<char> packed(3 * format.stride);
+    packVertices(format, vertices, 3, packed.data());
+
     GLuint VAO, VBO;
 
     // Gera os buffers e o VAO
@@ -214,15 +243,10 @@ int setupGeometry()
 
     // Bind do VBO e configuração do buffer de vértices
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    // Atributo de posição (layout = 0 no vertex shader)
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
+    glBufferData(GL_ARRAY_BUFFER, packed.size(), packed.data(), GL_STATIC_DRAW);
 
-    // Atributo de cor (layout = 1 no vertex shader)
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
+    // Atributos de posição (layout = 0) e cor (layout = 1) no vertex shader
+    setupVertexAttributes(format, VBO, 0, loader);
 
     // Desvincula o VBO e VAO
     glBindBuffer(GL_ARRAY_BUFFER, 0);
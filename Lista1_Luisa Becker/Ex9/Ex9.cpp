@@ -11,6 +11,8 @@
 #include <string>
 #include <assert.h>
 #include <cmath>
+#include <cstring>
+#include <cstdlib>
 
 using namespace std;
 
@@ -20,12 +22,26 @@ using namespace std;
 // GLFW
 #include <GLFW/glfw3.h>
 
+// Janela, modo headless e benchmark por frame (Common/include)
+#include "AppWindow.h"
+
+// Cena em lote: um VBO, um VAO e glMultiDrawArrays (Common/include)
+#include "SceneBatch.h"
+
+// Grade gerada no vertex shader, sem VBO (Common/include)
+#include "ProceduralShapes.h"
+
+// Compilação dos shaders sem bloquear, em paralelo quando o driver permite (Common/include)
+#include "ShaderBuildQueue.h"
+
 // Protótipo da função de callback de teclado
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mode);
 
 // Protótipos das funções
-int setupShader();
-void setupHouse(GLuint &VAO1, GLuint &VAO2, GLuint &VAO3, GLuint &VAO4, GLuint &VAO5, GLuint &VAOGrid);
+void setupGrid(SceneBatch& scene);
+void setupHouse(SceneBatch& scene, int houseId, float dx, float dy, float scale);
+void setupScene(SceneBatch& scene, int numHouses, bool withGrid = true);
+int renderSoftware(SceneBatch& scene, const char* path, unsigned threads);
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 800, HEIGHT = 600;
@@ -51,24 +67,58 @@ const GLchar* fragmentShaderSource = "#version 400 core\n"
 "}\n\0";
 
 // Função MAIN
-int main()
+// Uso: Ex9 [--houses N] [--procedural] [--vertex-format F] [--indexed] [--software IMAGEM.ppm [--threads N]]
+// Com --houses, a cena é replicada em uma grade de N casas, todas no mesmo lote
+// Com --vertex-format, os vértices ficam no VBO como float, float2, half ou snorm16
+// (padrão: float, 24 bytes por vértice; half e snorm16 usam 8 - VertexFormat.h)
+// Com --indexed, os vértices repetidos viram índices em um EBO (MeshOptimizer.h)
+// Com --procedural, a grade quadriculada é gerada no vertex shader (gl_VertexID), sem VBO
+// Com --software, a cena é desenhada na CPU (SoftRasterizer.h), sem janela nem OpenGL
+int main(int argc, char** argv)
 {
-    // Inicialização da GLFW
-    glfwInit();
+    int numHouses = 1;
+    const char* softwareImage = NULL;
+    unsigned softwareThreads = 0;
+    bool procedural = false;
+    bool indexed = false;
+    VertexFormat vertexFormat = floatVertexFormat();
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--houses") == 0 && i + 1 < argc)
+            numHouses = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--software") == 0 && i + 1 < argc)
+            softwareImage = argv[++i];
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            softwareThreads = (unsigned)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--procedural") == 0)
+            procedural = true;
+        else if (strcmp(argv[i], "--indexed") == 0)
+            indexed = true;
+        else if (strcmp(argv[i], "--vertex-format") == 0 && i + 1 < argc)
+        {
+            if (!findVertexFormat(argv[++i], &vertexFormat))
+                return -1;
+        }
+    }
+    if (numHouses < 1)
+        numHouses = 1;
 
-    // Criação da janela GLFW
-    GLFWwindow* window = glfwCreateWindow(WIDTH, HEIGHT, "Lista 1 - 9 -- Luisa Becker", nullptr, nullptr);
-    glfwMakeContextCurrent(window);
+    if (softwareImage)
+    {
+        SceneBatch scene;
+        setupScene(scene, numHouses);
+        return renderSoftware(scene, softwareImage, softwareThreads);
+    }
 
-    // Fazendo o registro da função de callback para a janela GLFW
-    glfwSetKeyCallback(window, key_callback);
+    // Inicialização da GLFW (ou do contexto sem janela, com --headless)
+    AppWindow app(argc, argv, "Ex9");
 
-    // GLAD: carrega todos os ponteiros das funções da OpenGL
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-    {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+    // Criação da janela GLFW
+    if (!app.create(WIDTH, HEIGHT, "Lista 1 - 9 -- Luisa Becker"))
         return -1;
-    }
+
+    // Fazendo o registro da função de callback para a janela GLFW
+    app.setKeyCallback(key_callback);
 
     // Obtendo as informações de versão
     const GLubyte* renderer = glGetString(GL_RENDERER); /* get renderer string */
@@ -78,59 +128,76 @@ int main()
 
     // Definindo as dimensões da viewport com as mesmas dimensões da janela da aplicação
     int width, height;
-    glfwGetFramebufferSize(window, &width, &height);
+    app.getFramebufferSize(&width, &height);
     glViewport(0, 0, width, height);
 
-    // Compilando e buildando o programa de shader
-    GLuint shaderID = setupShader();
+    // Enviando os programas de shader para compilação antes de montar a cena:
+    // o driver compila enquanto a geometria é gerada e enviada
+    ShaderBuildQueue shaders(app.getProcLoader());
+    int mainProgram = shaders.add(vertexShaderSource, fragmentShaderSource);
+    int proceduralProgramID = procedural ? shaders.add(proceduralVertexShaderSource, proceduralFragmentShaderSource) : -1;
 
-    // Gerar e configurar os VAOs
-    GLuint VAO1, VAO2, VAO3, VAO4, VAO5, VAOGrid;
-    setupHouse(VAO1, VAO2, VAO3, VAO4, VAO5, VAOGrid);
+    // Monta a cena (grade + casas) em um único VBO/VAO
+    // No modo procedural a grade fica de fora do lote: ela sai do vertex shader
+    SceneBatch scene;
+    {
+        ProfileScope scope("scene setup");
+        setupScene(scene, numHouses, !procedural);
+        scene.setVertexFormat(vertexFormat);
+        scene.setIndexed(indexed);
+        scene.upload(app.getProcLoader());
+    }
+    scene.printStats(cout);
+
+    // Esperando os programas que ainda não terminaram
+    {
+        ProfileScope scope("shader wait");
+        shaders.finish();
+    }
+    if (app.benchmark().enabled())
+        shaders.printStats(cout);
+    GLuint shaderID = shaders.program(mainProgram);
+
+    ProceduralProgram proceduralProgram;
+    if (procedural)
+        proceduralProgram = setupProceduralProgram(shaders.program(proceduralProgramID));
 
     // Loop da aplicação - "game loop"
-    while (!glfwWindowShouldClose(window))
+    while (app.running())
     {
         // Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funções de callback correspondentes
-        glfwPollEvents();
+        app.pollEvents();
 
         // Limpa o buffer de cor
         glClearColor(1.0f, 1.0f, 1.0f, 1.0f); // Cor de fundo (branco)
         glClear(GL_COLOR_BUFFER_BIT);
 
+        // Grade procedural: 21 linhas em cada direção, de -1 a 1 a cada 0.1 (cinza claro)
+        if (procedural)
+        {
+            GpuProfileScope scope("procedural grid");
+            glUseProgram(proceduralProgram.program);
+            glUniform4f(proceduralProgram.colorLoc, 0.9f, 0.9f, 0.9f, 1.0f);
+            drawProceduralGrid(proceduralProgram, 21, -1.0f, 0.1f, 2.0f);
+        }
+
         // Usando o shader program
         glUseProgram(shaderID);
 
-        // Desenha a grade quadriculada
-        glBindVertexArray(VAOGrid);
-        glDrawArrays(GL_LINES, 0, 44); // Desenha as linhas da grade
-
-        // Desenha a casa
-        glBindVertexArray(VAO1); // Desenho do telhado
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-
-        glBindVertexArray(VAO2); // Desenho das paredes
-        glDrawArrays(GL_LINES, 0, 4);
-
-        glBindVertexArray(VAO3); // Desenho da porta
-        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-
-        glBindVertexArray(VAO4); // Desenho da janela
-        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-        glDrawArrays(GL_LINES, 4, 8); // Cruz da janela
-
-        glBindVertexArray(VAO5); // Desenho da base
-        glDrawArrays(GL_LINES, 0, 2);
-
-        // Desvincula o VAO
-        glBindVertexArray(0);
+        // Desenha a grade e as casas: 1 VAO e um glMultiDrawArrays por grupo (camada + primitiva)
+        scene.draw();
 
         // Troca os buffers da tela
-        glfwSwapBuffers(window);
+        app.swapBuffers();
     }
 
+    // Pede para OpenGL desalocar os buffers
+    scene.release();
+    if (procedural)
+        deleteProceduralProgram(proceduralProgram);
+
     // Finaliza a execução da GLFW, limpando os recursos alocados por ela
-    glfwTerminate();
+    app.terminate();
     return 0;
 }
 
@@ -141,203 +208,123 @@ void key_callback(GLFWwindow* window, int key, int scancode, int action, int mod
         glfwSetWindowShouldClose(window, GL_TRUE);
 }
 
-// Função que compila e linka o Vertex e Fragment Shader em um Shader Program
-int setupShader()
+// Partes da casa: posição (x, y, z) e cor (r, g, b) de cada vértice
+
+// Telhado (vermelho)
+const GLfloat roof[] = {
+    0.0f,  0.5f, 0.0f, 1.0f, 0.0f, 0.0f,  // Ponto superior
+   -0.5f,  0.0f, 0.0f, 1.0f, 0.0f, 0.0f,  // Inferior esquerdo
+    0.5f,  0.0f, 0.0f, 1.0f, 0.0f, 0.0f   // Inferior direito
+};
+
+// Paredes (preto)
+const GLfloat walls[] = {
+   -0.5f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.5f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+// Porta (marrom)
+const GLfloat door[] = {
+   -0.15f, -0.5f, 0.0f, 0.5f, 0.25f, 0.0f,
+   -0.15f, -0.3f, 0.0f, 0.5f, 0.25f, 0.0f,
+    0.15f, -0.5f, 0.0f, 0.5f, 0.25f, 0.0f,
+    0.15f, -0.3f, 0.0f, 0.5f, 0.25f, 0.0f
+};
+
+// Janela (amarelo e cruz preta)
+const GLfloat houseWindow[] = {
+   -0.25f,  0.0f, 0.0f, 1.0f, 1.0f, 0.0f,  // Inferior esquerdo
+   -0.25f,  0.2f, 0.0f, 1.0f, 1.0f, 0.0f,  // Superior esquerdo
+    0.05f,  0.0f, 0.0f, 1.0f, 1.0f, 0.0f,  // Inferior direito
+    0.05f,  0.2f, 0.0f, 1.0f, 1.0f, 0.0f,  // Superior direito
+   -0.25f,  0.1f, 0.0f, 0.0f, 0.0f, 0.0f,  // Linha horizontal
+    0.05f,  0.1f, 0.0f, 0.0f, 0.0f, 0.0f,
+   -0.10f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,  // Linha vertical
+   -0.10f,  0.2f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+// Base (laranja)
+const GLfloat base[] = {
+   -1.0f, -0.5f, 0.0f, 1.0f, 0.5f, 0.0f,
+    1.0f, -0.5f, 0.0f, 1.0f, 0.5f, 0.0f
+};
+
+// Camadas de desenho: a grade fica atrás de tudo, os contornos na frente dos preenchimentos
+const int LAYER_GRID = 0, LAYER_FILL = 1, LAYER_OUTLINE = 2;
+
+// Adiciona a grade quadriculada (linhas a cada 0.1, de -1 a 1) na cena
+void setupGrid(SceneBatch& scene)
 {
-    // Vertex shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-
-    // Checando erros de compilação
-    GLint success;
-    GLchar infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-
-    // Fragment shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-
-    // Checando erros de compilação
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
+    const int numLines = 21; // Linhas em cada direção
+    const float step = 0.1f;
+    GLfloat gridLines[numLines * 2 * 2 * 6]; // 2 direções, 2 vértices por linha, 6 componentes (x, y, z, r, g, b)
+    int index = 0;
+    for (int i = 0; i < numLines; ++i)
     {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+        // Posição calculada a partir do índice, sem acumular erro de ponto flutuante
+        float p = -1.0f + step * i;
+        GLfloat lines[4][2] = { { p, -1.0f }, { p, 1.0f }, { -1.0f, p }, { 1.0f, p } };
+        for (int v = 0; v < 4; ++v)
+        {
+            gridLines[index++] = lines[v][0];
+            gridLines[index++] = lines[v][1];
+            gridLines[index++] = 0.0f;
+            gridLines[index++] = 0.9f; // Cinza claro
+            gridLines[index++] = 0.9f;
+            gridLines[index++] = 0.9f;
+        }
     }
+    scene.addPart(LAYER_GRID, GL_LINES, gridLines, numLines * 4, 0.0f, 0.0f, 1.0f, -2);
+}
 
-    // Linkando os shaders e criando o programa de shader
-    GLuint shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
+// Adiciona uma casa na cena, escalada por scale e deslocada por (dx, dy)
+// Cada parte recebe o identificador do VAO que teria no desenho separado (6 por casa)
+void setupHouse(SceneBatch& scene, int houseId, float dx, float dy, float scale)
+{
+    int id = houseId * 6;
+    scene.addPart(LAYER_FILL, GL_TRIANGLES, roof, 3, dx, dy, scale, id + 0);
+    scene.addPart(LAYER_OUTLINE, GL_LINES, walls, 4, dx, dy, scale, id + 1);
+    scene.addPart(LAYER_FILL, GL_TRIANGLE_STRIP, door, 4, dx, dy, scale, id + 2);
+    scene.addPart(LAYER_FILL, GL_TRIANGLE_STRIP, houseWindow, 4, dx, dy, scale, id + 3);
+    scene.addPart(LAYER_OUTLINE, GL_LINES, houseWindow + 4 * 6, 4, dx, dy, scale, id + 3); // Cruz da janela
+    scene.addPart(LAYER_OUTLINE, GL_LINES, base, 2, dx, dy, scale, id + 4);
+}
 
-    // Checando por erros de linkagem
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success)
+// Monta a cena completa: a grade (se withGrid) e numHouses casas
+void setupScene(SceneBatch& scene, int numHouses, bool withGrid)
+{
+    if (withGrid)
+        setupGrid(scene);
+    int columns = (int)ceil(sqrt((double)numHouses));
+    float cell = 2.0f / columns;
+    for (int i = 0; i < numHouses; ++i)
     {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+        // Com uma casa só, a escala é 1 e a casa fica no centro, como no exercício original
+        float dx = numHouses == 1 ? 0.0f : -1.0f + cell * (i % columns + 0.5f);
+        float dy = numHouses == 1 ? 0.0f : -1.0f + cell * (i / columns + 0.5f);
+        setupHouse(scene, i, dx, dy, numHouses == 1 ? 1.0f : cell * 0.45f);
     }
 
-    // Limpando os shaders, já que não são mais necessários após o linking
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    return shaderProgram;
+    // Nomes dos grupos de desenho no trace (--trace)
+    scene.setGroupName(LAYER_GRID, GL_LINES, "grid");
+    scene.setGroupName(LAYER_FILL, GL_TRIANGLES, "roof");
+    scene.setGroupName(LAYER_FILL, GL_TRIANGLE_STRIP, "door and window");
+    scene.setGroupName(LAYER_OUTLINE, GL_LINES, "walls and outlines");
 }
 
-// Função para configurar os VAOs da casa e a grade quadriculada
-void setupHouse(GLuint &VAO1, GLuint &VAO2, GLuint &VAO3, GLuint &VAO4, GLuint &VAO5, GLuint &VAOGrid)
+// Desenha a cena com o rasterizador em software e grava a imagem em path
+int renderSoftware(SceneBatch& scene, const char* path, unsigned threads)
 {
-    // Definição dos vértices e cores para cada parte da casa
-
-    // Telhado (vermelho)
-    GLfloat roof[] = {
-        0.0f,  0.5f, 0.0f, 1.0f, 0.0f, 0.0f,  // Ponto superior
-       -0.5f,  0.0f, 0.0f, 1.0f, 0.0f, 0.0f,  // Inferior esquerdo
-        0.5f,  0.0f, 0.0f, 1.0f, 0.0f, 0.0f   // Inferior direito
-    };
-
-    // Paredes (preto)
-    GLfloat walls[] = {
-       -0.5f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
-       -0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 0.0f,
-        0.5f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
-        0.5f, -0.5f, 0.0f, 0.0f, 0.0f, 0.0f
-    };
-
-    // Porta (marrom)
-    GLfloat door[] = {
-       -0.15f, -0.5f, 0.0f, 0.5f, 0.25f, 0.0f,
-       -0.15f, -0.3f, 0.0f, 0.5f, 0.25f, 0.0f,
-        0.15f, -0.5f, 0.0f, 0.5f, 0.25f, 0.0f,
-        0.15f, -0.3f, 0.0f, 0.5f, 0.25f, 0.0f
-    };
-
-    // Janela (amarelo e cruz preta)
-    GLfloat window[] = {
-       -0.25f,  0.0f, 0.0f, 1.0f, 1.0f, 0.0f,  // Inferior esquerdo
-       -0.25f,  0.2f, 0.0f, 1.0f, 1.0f, 0.0f,  // Superior esquerdo
-        0.05f,  0.0f, 0.0f, 1.0f, 1.0f, 0.0f,  // Inferior direito
-        0.05f,  0.2f, 0.0f, 1.0f, 1.0f, 0.0f,  // Superior direito
-       -0.25f,  0.1f, 0.0f, 0.0f, 0.0f, 0.0f,  // Linha horizontal
-        0.05f,  0.1f, 0.0f, 0.0f, 0.0f, 0.0f,
-       -0.10f,  0.0f, 0.0f, 0.0f, 0.0f, 0.0f,  // Linha vertical
-       -0.10f,  0.2f, 0.0f, 0.0f, 0.0f, 0.0f
-    };
-
-    // Base (laranja)
-    GLfloat base[] = {
-       -1.0f, -0.5f, 0.0f, 1.0f, 0.5f, 0.0f,
-        1.0f, -0.5f, 0.0f, 1.0f, 0.5f, 0.0f
-    };
-
-    // Configuração da grade
-    GLfloat gridLines[44 * 6]; // 44 linhas, 6 componentes (x, y, z, r, g, b)
-    int index = 0;
-    float step = 0.1f;
-    for (float x = -1.0f; x <= 1.0f; x += step) {
-        gridLines[index++] = x;
-        gridLines[index++] = -1.0f;
-        gridLines[index++] = 0.0f;
-        gridLines[index++] = 0.9f; // Cinza claro
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = x;
-        gridLines[index++] = 1.0f;
-        gridLines[index++] = 0.0f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 0.9f;
-    }
-    for (float y = -1.0f; y <= 1.0f; y += step) {
-        gridLines[index++] = -1.0f;
-        gridLines[index++] = y;
-        gridLines[index++] = 0.0f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 1.0f;
-        gridLines[index++] = y;
-        gridLines[index++] = 0.0f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 0.9f;
-        gridLines[index++] = 0.9f;
-    }
-
-    // Gerar buffers e configurar VAOs para cada parte
-    GLuint VBO1, VBO2, VBO3, VBO4, VBO5, VBOGrid;
-
-    // Telhado
-    glGenVertexArrays(1, &VAO1);
-    glGenBuffers(1, &VBO1);
-    glBindVertexArray(VAO1);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO1);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(roof), roof, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
-
-    // Paredes
-    glGenVertexArrays(1, &VAO2);
-    glGenBuffers(1, &VBO2);
-    glBindVertexArray(VAO2);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO2);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(walls), walls, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
-
-    // Porta
-    glGenVertexArrays(1, &VAO3);
-    glGenBuffers(1, &VBO3);
-    glBindVertexArray(VAO3);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO3);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(door), door, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
-
-    // Janela
-    glGenVertexArrays(1, &VAO4);
-    glGenBuffers(1, &VBO4);
-    glBindVertexArray(VAO4);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO4);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(window), window, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
-
-    // Base
-    glGenVertexArrays(1, &VAO5);
-    glGenBuffers(1, &VBO5);
-    glBindVertexArray(VAO5);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO5);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(base), base, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
-
-    // Grade quadriculada
-    glGenVertexArrays(1, &VAOGrid);
-    glGenBuffers(1, &VBOGrid);
-    glBindVertexArray(VAOGrid);
-    glBindBuffer(GL_ARRAY_BUFFER, VBOGrid);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(gridLines), gridLines, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid*)(3 * sizeof(GLfloat)));
-    glEnableVertexAttribArray(1);
+    SoftRasterizer raster(WIDTH, HEIGHT, threads);
+    raster.clear(1.0f, 1.0f, 1.0f, 1.0f); // Cor de fundo (branco)
+    scene.rasterize(raster);
+    raster.finish();
+
+    const SoftRasterStats& stats = raster.stats();
+    cout << "Software rasterizer: " << stats.triangles << " triangles, " << stats.binEntries
+         << " tile entries (" << stats.fullTiles << " full) in " << stats.tiles << " tiles" << endl;
+    cout << "  " << stats.threads << " threads, " << stats.finishMs << " ms" << endl;
+    return raster.writePPM(path) ? 0 : -1;
 }
@@ -0,0 +1,81 @@
+/* Reprodutor de traces de chamadas OpenGL (Common/include/GLTrace.h)
+ *
+ * Grave o trace com qualquer exercício:
+ *   Ex9 --gl-record ex9.gltrace
+ * e reproduza sem janela e sem loop de eventos, o mais rápido possível:
+ *   GLReplay ex9.gltrace [--benchmark-json ARQ] [--no-state-cache] ...
+ *
+ * As opções depois do arquivo vão para a AppWindow: o relatório por frame é o
+ * mesmo do --benchmark dos exercícios, e o custo de cada função aparece no fim.
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// GLAD
+#include <glad/glad.h>
+
+// GLFW
+#include <GLFW/glfw3.h>
+
+// Janela, modo headless e benchmark por frame (Common/include)
+#include "AppWindow.h"
+
+// Gravação e reprodução de chamadas OpenGL (Common/include)
+#include "GLTrace.h"
+
+// Função MAIN
+// Uso: GLReplay ARQ.gltrace [opções da AppWindow]
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		cout << "Uso: GLReplay ARQ.gltrace [--benchmark-json ARQ] [--no-state-cache] ..." << endl;
+		return -1;
+	}
+
+	GLTraceReplayer replay;
+	if (!replay.load(argv[1]))
+		return -1;
+	cout << "Trace: " << argv[1] << ", " << replay.frameCount() << " frames, "
+		<< replay.width() << " x " << replay.height() << endl;
+
+	// Contexto sem janela com um frame de benchmark para cada frame do trace;
+	// as opções da linha de comando vêm depois e podem mudar o padrão
+	string frames = to_string(replay.frameCount());
+	vector<char*> args;
+	args.push_back(argv[0]);
+	args.push_back((char*)"--headless");
+	args.push_back((char*)"--benchmark");
+	args.push_back((char*)frames.c_str());
+	for (int i = 2; i < argc; ++i)
+		args.push_back(argv[i]);
+
+	AppWindow app((int)args.size(), args.data(), "GLReplay");
+	if (!app.create(replay.width(), replay.height(), "GLReplay"))
+		return -1;
+
+	// Shaders, buffers e demais preparações do exercício
+	if (!replay.replaySetup())
+	{
+		cout << "ERROR::GL_REPLAY::SETUP_FAILED " << argv[1] << endl;
+		app.terminate();
+		return -1;
+	}
+
+	// Um frame do trace por volta do loop, sem eventos
+	while (app.running())
+	{
+		if (!replay.replayFrame())
+			break;
+		app.swapBuffers();
+	}
+
+	replay.printStats(cout);
+	app.terminate();
+	return replay.failed() ? -1 : 0;
+}